@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/cpp-lox/aot_main.cpp" "cpp-lox/CMakeFiles/cpp-lox-aot.dir/aot_main.cpp.o" "gcc" "cpp-lox/CMakeFiles/cpp-lox-aot.dir/aot_main.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_asan_build/cpp-lox/CMakeFiles/cpp-lox-core.dir/DependInfo.cmake"
+  "/root/repo/_asan_build/cpp-lox/CMakeFiles/cpp-lox-runtime.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cpp-lox-aot.dir/aot_main.cpp.o"
+  "CMakeFiles/cpp-lox-aot.dir/aot_main.cpp.o.d"
+  "cpp-lox-aot"
+  "cpp-lox-aot.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cpp-lox-aot.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
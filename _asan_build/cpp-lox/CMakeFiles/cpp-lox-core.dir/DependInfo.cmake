@@ -0,0 +1,42 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/cpp-lox/src/arena_memory_pool.cpp" "cpp-lox/CMakeFiles/cpp-lox-core.dir/src/arena_memory_pool.cpp.o" "gcc" "cpp-lox/CMakeFiles/cpp-lox-core.dir/src/arena_memory_pool.cpp.o.d"
+  "/root/repo/cpp-lox/src/ast_printer.cpp" "cpp-lox/CMakeFiles/cpp-lox-core.dir/src/ast_printer.cpp.o" "gcc" "cpp-lox/CMakeFiles/cpp-lox-core.dir/src/ast_printer.cpp.o.d"
+  "/root/repo/cpp-lox/src/char_scan.cpp" "cpp-lox/CMakeFiles/cpp-lox-core.dir/src/char_scan.cpp.o" "gcc" "cpp-lox/CMakeFiles/cpp-lox-core.dir/src/char_scan.cpp.o.d"
+  "/root/repo/cpp-lox/src/chunk.cpp" "cpp-lox/CMakeFiles/cpp-lox-core.dir/src/chunk.cpp.o" "gcc" "cpp-lox/CMakeFiles/cpp-lox-core.dir/src/chunk.cpp.o.d"
+  "/root/repo/cpp-lox/src/compiler.cpp" "cpp-lox/CMakeFiles/cpp-lox-core.dir/src/compiler.cpp.o" "gcc" "cpp-lox/CMakeFiles/cpp-lox-core.dir/src/compiler.cpp.o.d"
+  "/root/repo/cpp-lox/src/cpplox_app.cpp" "cpp-lox/CMakeFiles/cpp-lox-core.dir/src/cpplox_app.cpp.o" "gcc" "cpp-lox/CMakeFiles/cpp-lox-core.dir/src/cpplox_app.cpp.o.d"
+  "/root/repo/cpp-lox/src/debug_timer.cpp" "cpp-lox/CMakeFiles/cpp-lox-core.dir/src/debug_timer.cpp.o" "gcc" "cpp-lox/CMakeFiles/cpp-lox-core.dir/src/debug_timer.cpp.o.d"
+  "/root/repo/cpp-lox/src/expressions.cpp" "cpp-lox/CMakeFiles/cpp-lox-core.dir/src/expressions.cpp.o" "gcc" "cpp-lox/CMakeFiles/cpp-lox-core.dir/src/expressions.cpp.o.d"
+  "/root/repo/cpp-lox/src/interpreter.cpp" "cpp-lox/CMakeFiles/cpp-lox-core.dir/src/interpreter.cpp.o" "gcc" "cpp-lox/CMakeFiles/cpp-lox-core.dir/src/interpreter.cpp.o.d"
+  "/root/repo/cpp-lox/src/jit.cpp" "cpp-lox/CMakeFiles/cpp-lox-core.dir/src/jit.cpp.o" "gcc" "cpp-lox/CMakeFiles/cpp-lox-core.dir/src/jit.cpp.o.d"
+  "/root/repo/cpp-lox/src/lexer.cpp" "cpp-lox/CMakeFiles/cpp-lox-core.dir/src/lexer.cpp.o" "gcc" "cpp-lox/CMakeFiles/cpp-lox-core.dir/src/lexer.cpp.o.d"
+  "/root/repo/cpp-lox/src/logger.cpp" "cpp-lox/CMakeFiles/cpp-lox-core.dir/src/logger.cpp.o" "gcc" "cpp-lox/CMakeFiles/cpp-lox-core.dir/src/logger.cpp.o.d"
+  "/root/repo/cpp-lox/src/optimizer.cpp" "cpp-lox/CMakeFiles/cpp-lox-core.dir/src/optimizer.cpp.o" "gcc" "cpp-lox/CMakeFiles/cpp-lox-core.dir/src/optimizer.cpp.o.d"
+  "/root/repo/cpp-lox/src/parser.cpp" "cpp-lox/CMakeFiles/cpp-lox-core.dir/src/parser.cpp.o" "gcc" "cpp-lox/CMakeFiles/cpp-lox-core.dir/src/parser.cpp.o.d"
+  "/root/repo/cpp-lox/src/program_image.cpp" "cpp-lox/CMakeFiles/cpp-lox-core.dir/src/program_image.cpp.o" "gcc" "cpp-lox/CMakeFiles/cpp-lox-core.dir/src/program_image.cpp.o.d"
+  "/root/repo/cpp-lox/src/quickening.cpp" "cpp-lox/CMakeFiles/cpp-lox-core.dir/src/quickening.cpp.o" "gcc" "cpp-lox/CMakeFiles/cpp-lox-core.dir/src/quickening.cpp.o.d"
+  "/root/repo/cpp-lox/src/resolver.cpp" "cpp-lox/CMakeFiles/cpp-lox-core.dir/src/resolver.cpp.o" "gcc" "cpp-lox/CMakeFiles/cpp-lox-core.dir/src/resolver.cpp.o.d"
+  "/root/repo/cpp-lox/src/statements.cpp" "cpp-lox/CMakeFiles/cpp-lox-core.dir/src/statements.cpp.o" "gcc" "cpp-lox/CMakeFiles/cpp-lox-core.dir/src/statements.cpp.o.d"
+  "/root/repo/cpp-lox/src/transpiler.cpp" "cpp-lox/CMakeFiles/cpp-lox-core.dir/src/transpiler.cpp.o" "gcc" "cpp-lox/CMakeFiles/cpp-lox-core.dir/src/transpiler.cpp.o.d"
+  "/root/repo/cpp-lox/src/user_function.cpp" "cpp-lox/CMakeFiles/cpp-lox-core.dir/src/user_function.cpp.o" "gcc" "cpp-lox/CMakeFiles/cpp-lox-core.dir/src/user_function.cpp.o.d"
+  "/root/repo/cpp-lox/src/vm.cpp" "cpp-lox/CMakeFiles/cpp-lox-core.dir/src/vm.cpp.o" "gcc" "cpp-lox/CMakeFiles/cpp-lox-core.dir/src/vm.cpp.o.d"
+  "/root/repo/cpp-lox/src/vm_types.cpp" "cpp-lox/CMakeFiles/cpp-lox-core.dir/src/vm_types.cpp.o" "gcc" "cpp-lox/CMakeFiles/cpp-lox-core.dir/src/vm_types.cpp.o.d"
+  "/root/repo/cpp-lox/src/x64_assembler.cpp" "cpp-lox/CMakeFiles/cpp-lox-core.dir/src/x64_assembler.cpp.o" "gcc" "cpp-lox/CMakeFiles/cpp-lox-core.dir/src/x64_assembler.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_asan_build/cpp-lox/CMakeFiles/cpp-lox-runtime.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
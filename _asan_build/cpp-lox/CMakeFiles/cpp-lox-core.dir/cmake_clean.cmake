@@ -0,0 +1,55 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cpp-lox-core.dir/src/arena_memory_pool.cpp.o"
+  "CMakeFiles/cpp-lox-core.dir/src/arena_memory_pool.cpp.o.d"
+  "CMakeFiles/cpp-lox-core.dir/src/ast_printer.cpp.o"
+  "CMakeFiles/cpp-lox-core.dir/src/ast_printer.cpp.o.d"
+  "CMakeFiles/cpp-lox-core.dir/src/char_scan.cpp.o"
+  "CMakeFiles/cpp-lox-core.dir/src/char_scan.cpp.o.d"
+  "CMakeFiles/cpp-lox-core.dir/src/chunk.cpp.o"
+  "CMakeFiles/cpp-lox-core.dir/src/chunk.cpp.o.d"
+  "CMakeFiles/cpp-lox-core.dir/src/compiler.cpp.o"
+  "CMakeFiles/cpp-lox-core.dir/src/compiler.cpp.o.d"
+  "CMakeFiles/cpp-lox-core.dir/src/cpplox_app.cpp.o"
+  "CMakeFiles/cpp-lox-core.dir/src/cpplox_app.cpp.o.d"
+  "CMakeFiles/cpp-lox-core.dir/src/debug_timer.cpp.o"
+  "CMakeFiles/cpp-lox-core.dir/src/debug_timer.cpp.o.d"
+  "CMakeFiles/cpp-lox-core.dir/src/expressions.cpp.o"
+  "CMakeFiles/cpp-lox-core.dir/src/expressions.cpp.o.d"
+  "CMakeFiles/cpp-lox-core.dir/src/interpreter.cpp.o"
+  "CMakeFiles/cpp-lox-core.dir/src/interpreter.cpp.o.d"
+  "CMakeFiles/cpp-lox-core.dir/src/jit.cpp.o"
+  "CMakeFiles/cpp-lox-core.dir/src/jit.cpp.o.d"
+  "CMakeFiles/cpp-lox-core.dir/src/lexer.cpp.o"
+  "CMakeFiles/cpp-lox-core.dir/src/lexer.cpp.o.d"
+  "CMakeFiles/cpp-lox-core.dir/src/logger.cpp.o"
+  "CMakeFiles/cpp-lox-core.dir/src/logger.cpp.o.d"
+  "CMakeFiles/cpp-lox-core.dir/src/optimizer.cpp.o"
+  "CMakeFiles/cpp-lox-core.dir/src/optimizer.cpp.o.d"
+  "CMakeFiles/cpp-lox-core.dir/src/parser.cpp.o"
+  "CMakeFiles/cpp-lox-core.dir/src/parser.cpp.o.d"
+  "CMakeFiles/cpp-lox-core.dir/src/program_image.cpp.o"
+  "CMakeFiles/cpp-lox-core.dir/src/program_image.cpp.o.d"
+  "CMakeFiles/cpp-lox-core.dir/src/quickening.cpp.o"
+  "CMakeFiles/cpp-lox-core.dir/src/quickening.cpp.o.d"
+  "CMakeFiles/cpp-lox-core.dir/src/resolver.cpp.o"
+  "CMakeFiles/cpp-lox-core.dir/src/resolver.cpp.o.d"
+  "CMakeFiles/cpp-lox-core.dir/src/statements.cpp.o"
+  "CMakeFiles/cpp-lox-core.dir/src/statements.cpp.o.d"
+  "CMakeFiles/cpp-lox-core.dir/src/transpiler.cpp.o"
+  "CMakeFiles/cpp-lox-core.dir/src/transpiler.cpp.o.d"
+  "CMakeFiles/cpp-lox-core.dir/src/user_function.cpp.o"
+  "CMakeFiles/cpp-lox-core.dir/src/user_function.cpp.o.d"
+  "CMakeFiles/cpp-lox-core.dir/src/vm.cpp.o"
+  "CMakeFiles/cpp-lox-core.dir/src/vm.cpp.o.d"
+  "CMakeFiles/cpp-lox-core.dir/src/vm_types.cpp.o"
+  "CMakeFiles/cpp-lox-core.dir/src/vm_types.cpp.o.d"
+  "CMakeFiles/cpp-lox-core.dir/src/x64_assembler.cpp.o"
+  "CMakeFiles/cpp-lox-core.dir/src/x64_assembler.cpp.o.d"
+  "libcpp-lox-core.a"
+  "libcpp-lox-core.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cpp-lox-core.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
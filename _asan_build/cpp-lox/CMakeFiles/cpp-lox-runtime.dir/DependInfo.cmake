@@ -0,0 +1,29 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/cpp-lox/src/aot_runtime.cpp" "cpp-lox/CMakeFiles/cpp-lox-runtime.dir/src/aot_runtime.cpp.o" "gcc" "cpp-lox/CMakeFiles/cpp-lox-runtime.dir/src/aot_runtime.cpp.o.d"
+  "/root/repo/cpp-lox/src/console_io.cpp" "cpp-lox/CMakeFiles/cpp-lox-runtime.dir/src/console_io.cpp.o" "gcc" "cpp-lox/CMakeFiles/cpp-lox-runtime.dir/src/console_io.cpp.o.d"
+  "/root/repo/cpp-lox/src/cpplox_types.cpp" "cpp-lox/CMakeFiles/cpp-lox-runtime.dir/src/cpplox_types.cpp.o" "gcc" "cpp-lox/CMakeFiles/cpp-lox-runtime.dir/src/cpplox_types.cpp.o.d"
+  "/root/repo/cpp-lox/src/environment.cpp" "cpp-lox/CMakeFiles/cpp-lox-runtime.dir/src/environment.cpp.o" "gcc" "cpp-lox/CMakeFiles/cpp-lox-runtime.dir/src/environment.cpp.o.d"
+  "/root/repo/cpp-lox/src/exceptions.cpp" "cpp-lox/CMakeFiles/cpp-lox-runtime.dir/src/exceptions.cpp.o" "gcc" "cpp-lox/CMakeFiles/cpp-lox-runtime.dir/src/exceptions.cpp.o.d"
+  "/root/repo/cpp-lox/src/inline_cache.cpp" "cpp-lox/CMakeFiles/cpp-lox-runtime.dir/src/inline_cache.cpp.o" "gcc" "cpp-lox/CMakeFiles/cpp-lox-runtime.dir/src/inline_cache.cpp.o.d"
+  "/root/repo/cpp-lox/src/memory_manager.cpp" "cpp-lox/CMakeFiles/cpp-lox-runtime.dir/src/memory_manager.cpp.o" "gcc" "cpp-lox/CMakeFiles/cpp-lox-runtime.dir/src/memory_manager.cpp.o.d"
+  "/root/repo/cpp-lox/src/shape.cpp" "cpp-lox/CMakeFiles/cpp-lox-runtime.dir/src/shape.cpp.o" "gcc" "cpp-lox/CMakeFiles/cpp-lox-runtime.dir/src/shape.cpp.o.d"
+  "/root/repo/cpp-lox/src/source_manager.cpp" "cpp-lox/CMakeFiles/cpp-lox-runtime.dir/src/source_manager.cpp.o" "gcc" "cpp-lox/CMakeFiles/cpp-lox-runtime.dir/src/source_manager.cpp.o.d"
+  "/root/repo/cpp-lox/src/symbol_table.cpp" "cpp-lox/CMakeFiles/cpp-lox-runtime.dir/src/symbol_table.cpp.o" "gcc" "cpp-lox/CMakeFiles/cpp-lox-runtime.dir/src/symbol_table.cpp.o.d"
+  "/root/repo/cpp-lox/src/tokens.cpp" "cpp-lox/CMakeFiles/cpp-lox-runtime.dir/src/tokens.cpp.o" "gcc" "cpp-lox/CMakeFiles/cpp-lox-runtime.dir/src/tokens.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
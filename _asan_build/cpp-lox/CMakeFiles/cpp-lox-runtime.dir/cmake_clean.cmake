@@ -0,0 +1,31 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cpp-lox-runtime.dir/src/aot_runtime.cpp.o"
+  "CMakeFiles/cpp-lox-runtime.dir/src/aot_runtime.cpp.o.d"
+  "CMakeFiles/cpp-lox-runtime.dir/src/console_io.cpp.o"
+  "CMakeFiles/cpp-lox-runtime.dir/src/console_io.cpp.o.d"
+  "CMakeFiles/cpp-lox-runtime.dir/src/cpplox_types.cpp.o"
+  "CMakeFiles/cpp-lox-runtime.dir/src/cpplox_types.cpp.o.d"
+  "CMakeFiles/cpp-lox-runtime.dir/src/environment.cpp.o"
+  "CMakeFiles/cpp-lox-runtime.dir/src/environment.cpp.o.d"
+  "CMakeFiles/cpp-lox-runtime.dir/src/exceptions.cpp.o"
+  "CMakeFiles/cpp-lox-runtime.dir/src/exceptions.cpp.o.d"
+  "CMakeFiles/cpp-lox-runtime.dir/src/inline_cache.cpp.o"
+  "CMakeFiles/cpp-lox-runtime.dir/src/inline_cache.cpp.o.d"
+  "CMakeFiles/cpp-lox-runtime.dir/src/memory_manager.cpp.o"
+  "CMakeFiles/cpp-lox-runtime.dir/src/memory_manager.cpp.o.d"
+  "CMakeFiles/cpp-lox-runtime.dir/src/shape.cpp.o"
+  "CMakeFiles/cpp-lox-runtime.dir/src/shape.cpp.o.d"
+  "CMakeFiles/cpp-lox-runtime.dir/src/source_manager.cpp.o"
+  "CMakeFiles/cpp-lox-runtime.dir/src/source_manager.cpp.o.d"
+  "CMakeFiles/cpp-lox-runtime.dir/src/symbol_table.cpp.o"
+  "CMakeFiles/cpp-lox-runtime.dir/src/symbol_table.cpp.o.d"
+  "CMakeFiles/cpp-lox-runtime.dir/src/tokens.cpp.o"
+  "CMakeFiles/cpp-lox-runtime.dir/src/tokens.cpp.o.d"
+  "libcpp-lox-runtime.a"
+  "libcpp-lox-runtime.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cpp-lox-runtime.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
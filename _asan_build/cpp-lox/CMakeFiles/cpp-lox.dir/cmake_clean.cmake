@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cpp-lox.dir/main.cpp.o"
+  "CMakeFiles/cpp-lox.dir/main.cpp.o.d"
+  "cpp-lox"
+  "cpp-lox.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cpp-lox.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tests/lexer_tests.cpp" "tests/CMakeFiles/lexer-tests.dir/lexer_tests.cpp.o" "gcc" "tests/CMakeFiles/lexer-tests.dir/lexer_tests.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_asan_build/cpp-lox/CMakeFiles/cpp-lox-core.dir/DependInfo.cmake"
+  "/root/repo/_asan_build/cpp-lox/CMakeFiles/cpp-lox-runtime.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
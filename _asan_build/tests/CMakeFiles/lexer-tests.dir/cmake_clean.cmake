@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/lexer-tests.dir/lexer_tests.cpp.o"
+  "CMakeFiles/lexer-tests.dir/lexer_tests.cpp.o.d"
+  "lexer-tests"
+  "lexer-tests.pdb"
+  "lexer-tests_tests-b12d07c.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/lexer-tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
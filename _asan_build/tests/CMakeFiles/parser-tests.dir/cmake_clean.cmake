@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/parser-tests.dir/parser_tests.cpp.o"
+  "CMakeFiles/parser-tests.dir/parser_tests.cpp.o.d"
+  "parser-tests"
+  "parser-tests.pdb"
+  "parser-tests_tests-b12d07c.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/parser-tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
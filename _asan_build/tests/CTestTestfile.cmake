@@ -0,0 +1,736 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests
+# Build directory: /root/repo/_asan_build/tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+include("/root/repo/_asan_build/tests/lexer-tests_include-b12d07c.cmake")
+include("/root/repo/_asan_build/tests/parser-tests_include-b12d07c.cmake")
+add_test([=[readme_tests]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=" "-DSOURCE=/root/repo/tests/readme_tests.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/readme_tests" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[readme_tests]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;31;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[readme_tests_vm]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm" "-DSOURCE=/root/repo/tests/readme_tests.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/readme_tests_vm" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[readme_tests_vm]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;32;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[readme_tests_stream]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--stream" "-DSOURCE=/root/repo/tests/readme_tests.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/readme_tests_stream" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[readme_tests_stream]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;33;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[readme_tests_vm_stream]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--stream" "-DSOURCE=/root/repo/tests/readme_tests.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/readme_tests_vm_stream" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[readme_tests_vm_stream]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;34;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[readme_tests_dump_ast]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--dump-ast" "-DSOURCE=/root/repo/tests/readme_tests.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=OFF" "-DWORK_DIR=/root/repo/_asan_build/tests/output/readme_tests_dump_ast" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[readme_tests_dump_ast]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;35;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[readme_tests_jit]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--jit" "-DSOURCE=/root/repo/tests/readme_tests.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/readme_tests_jit" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[readme_tests_jit]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;36;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[readme_tests_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--gc-threshold=0;--gc-growth=1" "-DSOURCE=/root/repo/tests/readme_tests.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/readme_tests_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[readme_tests_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;38;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[readme_tests_vm_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--gc-threshold=0;--gc-growth=1" "-DSOURCE=/root/repo/tests/readme_tests.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/readme_tests_vm_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[readme_tests_vm_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;39;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[readme_tests_minor_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--gc-nursery=0" "-DSOURCE=/root/repo/tests/readme_tests.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/readme_tests_minor_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[readme_tests_minor_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;40;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[readme_tests_vm_minor_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--gc-nursery=0" "-DSOURCE=/root/repo/tests/readme_tests.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/readme_tests_vm_minor_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[readme_tests_vm_minor_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;41;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[readme_tests_incremental_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--gc-nursery=0;--gc-threshold=0;--gc-pause-budget=0" "-DSOURCE=/root/repo/tests/readme_tests.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/readme_tests_incremental_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[readme_tests_incremental_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;42;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[readme_tests_vm_incremental_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--gc-nursery=0;--gc-threshold=0;--gc-pause-budget=0" "-DSOURCE=/root/repo/tests/readme_tests.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/readme_tests_vm_incremental_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[readme_tests_vm_incremental_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;43;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[readme_tests_image]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DSOURCE=/root/repo/tests/readme_tests.cpplox" "-DWORK_DIR=/root/repo/_asan_build/tests/image" "-P" "/root/repo/tests/image_test.cmake")
+set_tests_properties([=[readme_tests_image]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;45;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[readme_tests_aot]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DAOT_COMPILER=/root/repo/_asan_build/cpp-lox/cpp-lox-aot" "-DSOURCE=/root/repo/tests/readme_tests.cpplox" "-DWORK_DIR=/root/repo/_asan_build/tests/aot" "-P" "/root/repo/tests/aot_test.cmake")
+set_tests_properties([=[readme_tests_aot]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;49;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test1]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=" "-DSOURCE=/root/repo/tests/test1.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test1" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test1]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;31;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test1_vm]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm" "-DSOURCE=/root/repo/tests/test1.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test1_vm" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test1_vm]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;32;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test1_stream]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--stream" "-DSOURCE=/root/repo/tests/test1.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test1_stream" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test1_stream]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;33;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test1_vm_stream]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--stream" "-DSOURCE=/root/repo/tests/test1.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test1_vm_stream" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test1_vm_stream]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;34;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test1_dump_ast]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--dump-ast" "-DSOURCE=/root/repo/tests/test1.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=OFF" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test1_dump_ast" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test1_dump_ast]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;35;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test1_jit]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--jit" "-DSOURCE=/root/repo/tests/test1.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test1_jit" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test1_jit]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;36;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test1_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--gc-threshold=0;--gc-growth=1" "-DSOURCE=/root/repo/tests/test1.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test1_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test1_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;38;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test1_vm_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--gc-threshold=0;--gc-growth=1" "-DSOURCE=/root/repo/tests/test1.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test1_vm_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test1_vm_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;39;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test1_minor_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--gc-nursery=0" "-DSOURCE=/root/repo/tests/test1.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test1_minor_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test1_minor_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;40;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test1_vm_minor_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--gc-nursery=0" "-DSOURCE=/root/repo/tests/test1.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test1_vm_minor_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test1_vm_minor_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;41;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test1_incremental_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--gc-nursery=0;--gc-threshold=0;--gc-pause-budget=0" "-DSOURCE=/root/repo/tests/test1.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test1_incremental_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test1_incremental_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;42;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test1_vm_incremental_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--gc-nursery=0;--gc-threshold=0;--gc-pause-budget=0" "-DSOURCE=/root/repo/tests/test1.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test1_vm_incremental_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test1_vm_incremental_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;43;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test1_image]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DSOURCE=/root/repo/tests/test1.cpplox" "-DWORK_DIR=/root/repo/_asan_build/tests/image" "-P" "/root/repo/tests/image_test.cmake")
+set_tests_properties([=[test1_image]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;45;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test1_aot]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DAOT_COMPILER=/root/repo/_asan_build/cpp-lox/cpp-lox-aot" "-DSOURCE=/root/repo/tests/test1.cpplox" "-DWORK_DIR=/root/repo/_asan_build/tests/aot" "-P" "/root/repo/tests/aot_test.cmake")
+set_tests_properties([=[test1_aot]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;49;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test10]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=" "-DSOURCE=/root/repo/tests/test10.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test10" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test10]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;31;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test10_vm]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm" "-DSOURCE=/root/repo/tests/test10.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test10_vm" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test10_vm]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;32;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test10_stream]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--stream" "-DSOURCE=/root/repo/tests/test10.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test10_stream" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test10_stream]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;33;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test10_vm_stream]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--stream" "-DSOURCE=/root/repo/tests/test10.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test10_vm_stream" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test10_vm_stream]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;34;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test10_dump_ast]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--dump-ast" "-DSOURCE=/root/repo/tests/test10.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=OFF" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test10_dump_ast" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test10_dump_ast]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;35;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test10_jit]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--jit" "-DSOURCE=/root/repo/tests/test10.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test10_jit" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test10_jit]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;36;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test10_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--gc-threshold=0;--gc-growth=1" "-DSOURCE=/root/repo/tests/test10.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test10_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test10_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;38;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test10_vm_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--gc-threshold=0;--gc-growth=1" "-DSOURCE=/root/repo/tests/test10.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test10_vm_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test10_vm_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;39;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test10_minor_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--gc-nursery=0" "-DSOURCE=/root/repo/tests/test10.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test10_minor_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test10_minor_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;40;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test10_vm_minor_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--gc-nursery=0" "-DSOURCE=/root/repo/tests/test10.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test10_vm_minor_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test10_vm_minor_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;41;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test10_incremental_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--gc-nursery=0;--gc-threshold=0;--gc-pause-budget=0" "-DSOURCE=/root/repo/tests/test10.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test10_incremental_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test10_incremental_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;42;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test10_vm_incremental_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--gc-nursery=0;--gc-threshold=0;--gc-pause-budget=0" "-DSOURCE=/root/repo/tests/test10.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test10_vm_incremental_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test10_vm_incremental_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;43;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test10_image]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DSOURCE=/root/repo/tests/test10.cpplox" "-DWORK_DIR=/root/repo/_asan_build/tests/image" "-P" "/root/repo/tests/image_test.cmake")
+set_tests_properties([=[test10_image]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;45;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test10_aot]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DAOT_COMPILER=/root/repo/_asan_build/cpp-lox/cpp-lox-aot" "-DSOURCE=/root/repo/tests/test10.cpplox" "-DWORK_DIR=/root/repo/_asan_build/tests/aot" "-P" "/root/repo/tests/aot_test.cmake")
+set_tests_properties([=[test10_aot]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;49;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test11]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=" "-DSOURCE=/root/repo/tests/test11.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test11" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test11]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;31;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test11_vm]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm" "-DSOURCE=/root/repo/tests/test11.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test11_vm" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test11_vm]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;32;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test11_stream]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--stream" "-DSOURCE=/root/repo/tests/test11.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test11_stream" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test11_stream]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;33;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test11_vm_stream]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--stream" "-DSOURCE=/root/repo/tests/test11.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test11_vm_stream" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test11_vm_stream]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;34;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test11_dump_ast]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--dump-ast" "-DSOURCE=/root/repo/tests/test11.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=OFF" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test11_dump_ast" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test11_dump_ast]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;35;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test11_jit]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--jit" "-DSOURCE=/root/repo/tests/test11.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test11_jit" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test11_jit]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;36;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test11_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--gc-threshold=0;--gc-growth=1" "-DSOURCE=/root/repo/tests/test11.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test11_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test11_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;38;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test11_vm_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--gc-threshold=0;--gc-growth=1" "-DSOURCE=/root/repo/tests/test11.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test11_vm_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test11_vm_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;39;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test11_minor_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--gc-nursery=0" "-DSOURCE=/root/repo/tests/test11.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test11_minor_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test11_minor_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;40;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test11_vm_minor_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--gc-nursery=0" "-DSOURCE=/root/repo/tests/test11.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test11_vm_minor_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test11_vm_minor_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;41;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test11_incremental_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--gc-nursery=0;--gc-threshold=0;--gc-pause-budget=0" "-DSOURCE=/root/repo/tests/test11.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test11_incremental_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test11_incremental_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;42;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test11_vm_incremental_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--gc-nursery=0;--gc-threshold=0;--gc-pause-budget=0" "-DSOURCE=/root/repo/tests/test11.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test11_vm_incremental_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test11_vm_incremental_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;43;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test11_image]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DSOURCE=/root/repo/tests/test11.cpplox" "-DWORK_DIR=/root/repo/_asan_build/tests/image" "-P" "/root/repo/tests/image_test.cmake")
+set_tests_properties([=[test11_image]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;45;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test11_aot]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DAOT_COMPILER=/root/repo/_asan_build/cpp-lox/cpp-lox-aot" "-DSOURCE=/root/repo/tests/test11.cpplox" "-DWORK_DIR=/root/repo/_asan_build/tests/aot" "-P" "/root/repo/tests/aot_test.cmake")
+set_tests_properties([=[test11_aot]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;49;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test12]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=" "-DSOURCE=/root/repo/tests/test12.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test12" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test12]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;31;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test12_vm]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm" "-DSOURCE=/root/repo/tests/test12.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test12_vm" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test12_vm]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;32;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test12_stream]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--stream" "-DSOURCE=/root/repo/tests/test12.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test12_stream" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test12_stream]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;33;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test12_vm_stream]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--stream" "-DSOURCE=/root/repo/tests/test12.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test12_vm_stream" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test12_vm_stream]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;34;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test12_dump_ast]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--dump-ast" "-DSOURCE=/root/repo/tests/test12.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=OFF" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test12_dump_ast" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test12_dump_ast]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;35;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test12_jit]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--jit" "-DSOURCE=/root/repo/tests/test12.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test12_jit" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test12_jit]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;36;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test12_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--gc-threshold=0;--gc-growth=1" "-DSOURCE=/root/repo/tests/test12.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test12_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test12_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;38;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test12_vm_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--gc-threshold=0;--gc-growth=1" "-DSOURCE=/root/repo/tests/test12.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test12_vm_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test12_vm_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;39;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test12_minor_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--gc-nursery=0" "-DSOURCE=/root/repo/tests/test12.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test12_minor_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test12_minor_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;40;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test12_vm_minor_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--gc-nursery=0" "-DSOURCE=/root/repo/tests/test12.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test12_vm_minor_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test12_vm_minor_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;41;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test12_incremental_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--gc-nursery=0;--gc-threshold=0;--gc-pause-budget=0" "-DSOURCE=/root/repo/tests/test12.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test12_incremental_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test12_incremental_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;42;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test12_vm_incremental_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--gc-nursery=0;--gc-threshold=0;--gc-pause-budget=0" "-DSOURCE=/root/repo/tests/test12.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test12_vm_incremental_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test12_vm_incremental_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;43;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test12_image]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DSOURCE=/root/repo/tests/test12.cpplox" "-DWORK_DIR=/root/repo/_asan_build/tests/image" "-P" "/root/repo/tests/image_test.cmake")
+set_tests_properties([=[test12_image]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;45;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test12_aot]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DAOT_COMPILER=/root/repo/_asan_build/cpp-lox/cpp-lox-aot" "-DSOURCE=/root/repo/tests/test12.cpplox" "-DWORK_DIR=/root/repo/_asan_build/tests/aot" "-P" "/root/repo/tests/aot_test.cmake")
+set_tests_properties([=[test12_aot]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;49;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test13]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=" "-DSOURCE=/root/repo/tests/test13.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test13" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test13]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;31;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test13_vm]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm" "-DSOURCE=/root/repo/tests/test13.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test13_vm" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test13_vm]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;32;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test13_stream]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--stream" "-DSOURCE=/root/repo/tests/test13.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test13_stream" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test13_stream]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;33;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test13_vm_stream]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--stream" "-DSOURCE=/root/repo/tests/test13.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test13_vm_stream" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test13_vm_stream]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;34;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test13_dump_ast]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--dump-ast" "-DSOURCE=/root/repo/tests/test13.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=OFF" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test13_dump_ast" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test13_dump_ast]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;35;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test13_jit]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--jit" "-DSOURCE=/root/repo/tests/test13.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test13_jit" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test13_jit]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;36;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test13_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--gc-threshold=0;--gc-growth=1" "-DSOURCE=/root/repo/tests/test13.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test13_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test13_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;38;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test13_vm_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--gc-threshold=0;--gc-growth=1" "-DSOURCE=/root/repo/tests/test13.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test13_vm_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test13_vm_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;39;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test13_minor_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--gc-nursery=0" "-DSOURCE=/root/repo/tests/test13.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test13_minor_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test13_minor_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;40;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test13_vm_minor_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--gc-nursery=0" "-DSOURCE=/root/repo/tests/test13.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test13_vm_minor_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test13_vm_minor_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;41;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test13_incremental_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--gc-nursery=0;--gc-threshold=0;--gc-pause-budget=0" "-DSOURCE=/root/repo/tests/test13.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test13_incremental_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test13_incremental_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;42;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test13_vm_incremental_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--gc-nursery=0;--gc-threshold=0;--gc-pause-budget=0" "-DSOURCE=/root/repo/tests/test13.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test13_vm_incremental_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test13_vm_incremental_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;43;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test13_image]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DSOURCE=/root/repo/tests/test13.cpplox" "-DWORK_DIR=/root/repo/_asan_build/tests/image" "-P" "/root/repo/tests/image_test.cmake")
+set_tests_properties([=[test13_image]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;45;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test13_aot]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DAOT_COMPILER=/root/repo/_asan_build/cpp-lox/cpp-lox-aot" "-DSOURCE=/root/repo/tests/test13.cpplox" "-DWORK_DIR=/root/repo/_asan_build/tests/aot" "-P" "/root/repo/tests/aot_test.cmake")
+set_tests_properties([=[test13_aot]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;49;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test14]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=" "-DSOURCE=/root/repo/tests/test14.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test14" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test14]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;31;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test14_vm]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm" "-DSOURCE=/root/repo/tests/test14.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test14_vm" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test14_vm]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;32;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test14_stream]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--stream" "-DSOURCE=/root/repo/tests/test14.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test14_stream" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test14_stream]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;33;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test14_vm_stream]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--stream" "-DSOURCE=/root/repo/tests/test14.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test14_vm_stream" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test14_vm_stream]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;34;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test14_dump_ast]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--dump-ast" "-DSOURCE=/root/repo/tests/test14.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=OFF" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test14_dump_ast" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test14_dump_ast]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;35;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test14_jit]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--jit" "-DSOURCE=/root/repo/tests/test14.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test14_jit" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test14_jit]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;36;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test14_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--gc-threshold=0;--gc-growth=1" "-DSOURCE=/root/repo/tests/test14.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test14_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test14_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;38;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test14_vm_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--gc-threshold=0;--gc-growth=1" "-DSOURCE=/root/repo/tests/test14.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test14_vm_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test14_vm_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;39;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test14_minor_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--gc-nursery=0" "-DSOURCE=/root/repo/tests/test14.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test14_minor_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test14_minor_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;40;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test14_vm_minor_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--gc-nursery=0" "-DSOURCE=/root/repo/tests/test14.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test14_vm_minor_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test14_vm_minor_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;41;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test14_incremental_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--gc-nursery=0;--gc-threshold=0;--gc-pause-budget=0" "-DSOURCE=/root/repo/tests/test14.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test14_incremental_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test14_incremental_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;42;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test14_vm_incremental_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--gc-nursery=0;--gc-threshold=0;--gc-pause-budget=0" "-DSOURCE=/root/repo/tests/test14.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test14_vm_incremental_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test14_vm_incremental_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;43;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test14_image]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DSOURCE=/root/repo/tests/test14.cpplox" "-DWORK_DIR=/root/repo/_asan_build/tests/image" "-P" "/root/repo/tests/image_test.cmake")
+set_tests_properties([=[test14_image]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;45;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test14_aot]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DAOT_COMPILER=/root/repo/_asan_build/cpp-lox/cpp-lox-aot" "-DSOURCE=/root/repo/tests/test14.cpplox" "-DWORK_DIR=/root/repo/_asan_build/tests/aot" "-P" "/root/repo/tests/aot_test.cmake")
+set_tests_properties([=[test14_aot]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;49;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test15]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=" "-DSOURCE=/root/repo/tests/test15.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test15" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test15]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;31;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test15_vm]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm" "-DSOURCE=/root/repo/tests/test15.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test15_vm" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test15_vm]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;32;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test15_stream]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--stream" "-DSOURCE=/root/repo/tests/test15.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test15_stream" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test15_stream]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;33;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test15_vm_stream]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--stream" "-DSOURCE=/root/repo/tests/test15.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test15_vm_stream" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test15_vm_stream]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;34;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test15_dump_ast]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--dump-ast" "-DSOURCE=/root/repo/tests/test15.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=OFF" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test15_dump_ast" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test15_dump_ast]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;35;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test15_jit]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--jit" "-DSOURCE=/root/repo/tests/test15.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test15_jit" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test15_jit]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;36;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test15_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--gc-threshold=0;--gc-growth=1" "-DSOURCE=/root/repo/tests/test15.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test15_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test15_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;38;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test15_vm_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--gc-threshold=0;--gc-growth=1" "-DSOURCE=/root/repo/tests/test15.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test15_vm_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test15_vm_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;39;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test15_minor_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--gc-nursery=0" "-DSOURCE=/root/repo/tests/test15.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test15_minor_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test15_minor_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;40;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test15_vm_minor_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--gc-nursery=0" "-DSOURCE=/root/repo/tests/test15.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test15_vm_minor_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test15_vm_minor_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;41;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test15_incremental_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--gc-nursery=0;--gc-threshold=0;--gc-pause-budget=0" "-DSOURCE=/root/repo/tests/test15.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test15_incremental_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test15_incremental_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;42;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test15_vm_incremental_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--gc-nursery=0;--gc-threshold=0;--gc-pause-budget=0" "-DSOURCE=/root/repo/tests/test15.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test15_vm_incremental_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test15_vm_incremental_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;43;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test15_image]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DSOURCE=/root/repo/tests/test15.cpplox" "-DWORK_DIR=/root/repo/_asan_build/tests/image" "-P" "/root/repo/tests/image_test.cmake")
+set_tests_properties([=[test15_image]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;45;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test15_aot]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DAOT_COMPILER=/root/repo/_asan_build/cpp-lox/cpp-lox-aot" "-DSOURCE=/root/repo/tests/test15.cpplox" "-DWORK_DIR=/root/repo/_asan_build/tests/aot" "-P" "/root/repo/tests/aot_test.cmake")
+set_tests_properties([=[test15_aot]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;49;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test16]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=" "-DSOURCE=/root/repo/tests/test16.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test16" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test16]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;31;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test16_vm]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm" "-DSOURCE=/root/repo/tests/test16.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test16_vm" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test16_vm]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;32;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test16_stream]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--stream" "-DSOURCE=/root/repo/tests/test16.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test16_stream" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test16_stream]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;33;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test16_vm_stream]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--stream" "-DSOURCE=/root/repo/tests/test16.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test16_vm_stream" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test16_vm_stream]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;34;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test16_dump_ast]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--dump-ast" "-DSOURCE=/root/repo/tests/test16.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=OFF" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test16_dump_ast" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test16_dump_ast]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;35;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test16_jit]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--jit" "-DSOURCE=/root/repo/tests/test16.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test16_jit" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test16_jit]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;36;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test16_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--gc-threshold=0;--gc-growth=1" "-DSOURCE=/root/repo/tests/test16.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test16_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test16_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;38;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test16_vm_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--gc-threshold=0;--gc-growth=1" "-DSOURCE=/root/repo/tests/test16.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test16_vm_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test16_vm_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;39;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test16_minor_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--gc-nursery=0" "-DSOURCE=/root/repo/tests/test16.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test16_minor_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test16_minor_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;40;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test16_vm_minor_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--gc-nursery=0" "-DSOURCE=/root/repo/tests/test16.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test16_vm_minor_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test16_vm_minor_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;41;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test16_incremental_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--gc-nursery=0;--gc-threshold=0;--gc-pause-budget=0" "-DSOURCE=/root/repo/tests/test16.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test16_incremental_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test16_incremental_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;42;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test16_vm_incremental_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--gc-nursery=0;--gc-threshold=0;--gc-pause-budget=0" "-DSOURCE=/root/repo/tests/test16.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test16_vm_incremental_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test16_vm_incremental_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;43;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test16_image]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DSOURCE=/root/repo/tests/test16.cpplox" "-DWORK_DIR=/root/repo/_asan_build/tests/image" "-P" "/root/repo/tests/image_test.cmake")
+set_tests_properties([=[test16_image]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;45;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test16_aot]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DAOT_COMPILER=/root/repo/_asan_build/cpp-lox/cpp-lox-aot" "-DSOURCE=/root/repo/tests/test16.cpplox" "-DWORK_DIR=/root/repo/_asan_build/tests/aot" "-P" "/root/repo/tests/aot_test.cmake")
+set_tests_properties([=[test16_aot]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;49;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test17]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=" "-DSOURCE=/root/repo/tests/test17.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test17" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test17]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;31;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test17_vm]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm" "-DSOURCE=/root/repo/tests/test17.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test17_vm" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test17_vm]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;32;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test17_stream]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--stream" "-DSOURCE=/root/repo/tests/test17.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test17_stream" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test17_stream]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;33;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test17_vm_stream]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--stream" "-DSOURCE=/root/repo/tests/test17.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test17_vm_stream" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test17_vm_stream]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;34;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test17_dump_ast]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--dump-ast" "-DSOURCE=/root/repo/tests/test17.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=OFF" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test17_dump_ast" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test17_dump_ast]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;35;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test17_jit]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--jit" "-DSOURCE=/root/repo/tests/test17.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test17_jit" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test17_jit]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;36;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test17_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--gc-threshold=0;--gc-growth=1" "-DSOURCE=/root/repo/tests/test17.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test17_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test17_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;38;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test17_vm_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--gc-threshold=0;--gc-growth=1" "-DSOURCE=/root/repo/tests/test17.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test17_vm_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test17_vm_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;39;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test17_minor_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--gc-nursery=0" "-DSOURCE=/root/repo/tests/test17.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test17_minor_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test17_minor_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;40;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test17_vm_minor_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--gc-nursery=0" "-DSOURCE=/root/repo/tests/test17.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test17_vm_minor_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test17_vm_minor_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;41;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test17_incremental_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--gc-nursery=0;--gc-threshold=0;--gc-pause-budget=0" "-DSOURCE=/root/repo/tests/test17.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test17_incremental_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test17_incremental_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;42;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test17_vm_incremental_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--gc-nursery=0;--gc-threshold=0;--gc-pause-budget=0" "-DSOURCE=/root/repo/tests/test17.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test17_vm_incremental_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test17_vm_incremental_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;43;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test17_image]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DSOURCE=/root/repo/tests/test17.cpplox" "-DWORK_DIR=/root/repo/_asan_build/tests/image" "-P" "/root/repo/tests/image_test.cmake")
+set_tests_properties([=[test17_image]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;45;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test17_aot]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DAOT_COMPILER=/root/repo/_asan_build/cpp-lox/cpp-lox-aot" "-DSOURCE=/root/repo/tests/test17.cpplox" "-DWORK_DIR=/root/repo/_asan_build/tests/aot" "-P" "/root/repo/tests/aot_test.cmake")
+set_tests_properties([=[test17_aot]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;49;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test18]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=" "-DSOURCE=/root/repo/tests/test18.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test18" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test18]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;31;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test18_vm]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm" "-DSOURCE=/root/repo/tests/test18.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test18_vm" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test18_vm]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;32;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test18_stream]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--stream" "-DSOURCE=/root/repo/tests/test18.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test18_stream" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test18_stream]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;33;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test18_vm_stream]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--stream" "-DSOURCE=/root/repo/tests/test18.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test18_vm_stream" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test18_vm_stream]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;34;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test18_dump_ast]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--dump-ast" "-DSOURCE=/root/repo/tests/test18.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=OFF" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test18_dump_ast" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test18_dump_ast]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;35;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test18_jit]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--jit" "-DSOURCE=/root/repo/tests/test18.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test18_jit" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test18_jit]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;36;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test18_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--gc-threshold=0;--gc-growth=1" "-DSOURCE=/root/repo/tests/test18.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test18_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test18_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;38;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test18_vm_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--gc-threshold=0;--gc-growth=1" "-DSOURCE=/root/repo/tests/test18.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test18_vm_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test18_vm_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;39;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test18_minor_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--gc-nursery=0" "-DSOURCE=/root/repo/tests/test18.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test18_minor_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test18_minor_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;40;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test18_vm_minor_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--gc-nursery=0" "-DSOURCE=/root/repo/tests/test18.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test18_vm_minor_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test18_vm_minor_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;41;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test18_incremental_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--gc-nursery=0;--gc-threshold=0;--gc-pause-budget=0" "-DSOURCE=/root/repo/tests/test18.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test18_incremental_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test18_incremental_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;42;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test18_vm_incremental_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--gc-nursery=0;--gc-threshold=0;--gc-pause-budget=0" "-DSOURCE=/root/repo/tests/test18.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test18_vm_incremental_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test18_vm_incremental_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;43;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test18_image]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DSOURCE=/root/repo/tests/test18.cpplox" "-DWORK_DIR=/root/repo/_asan_build/tests/image" "-P" "/root/repo/tests/image_test.cmake")
+set_tests_properties([=[test18_image]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;45;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test18_aot]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DAOT_COMPILER=/root/repo/_asan_build/cpp-lox/cpp-lox-aot" "-DSOURCE=/root/repo/tests/test18.cpplox" "-DWORK_DIR=/root/repo/_asan_build/tests/aot" "-P" "/root/repo/tests/aot_test.cmake")
+set_tests_properties([=[test18_aot]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;49;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test19]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=" "-DSOURCE=/root/repo/tests/test19.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test19" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test19]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;31;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test19_vm]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm" "-DSOURCE=/root/repo/tests/test19.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test19_vm" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test19_vm]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;32;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test19_stream]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--stream" "-DSOURCE=/root/repo/tests/test19.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test19_stream" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test19_stream]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;33;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test19_vm_stream]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--stream" "-DSOURCE=/root/repo/tests/test19.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test19_vm_stream" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test19_vm_stream]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;34;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test19_dump_ast]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--dump-ast" "-DSOURCE=/root/repo/tests/test19.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=OFF" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test19_dump_ast" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test19_dump_ast]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;35;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test19_jit]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--jit" "-DSOURCE=/root/repo/tests/test19.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test19_jit" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test19_jit]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;36;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test19_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--gc-threshold=0;--gc-growth=1" "-DSOURCE=/root/repo/tests/test19.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test19_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test19_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;38;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test19_vm_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--gc-threshold=0;--gc-growth=1" "-DSOURCE=/root/repo/tests/test19.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test19_vm_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test19_vm_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;39;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test19_minor_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--gc-nursery=0" "-DSOURCE=/root/repo/tests/test19.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test19_minor_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test19_minor_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;40;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test19_vm_minor_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--gc-nursery=0" "-DSOURCE=/root/repo/tests/test19.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test19_vm_minor_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test19_vm_minor_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;41;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test19_incremental_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--gc-nursery=0;--gc-threshold=0;--gc-pause-budget=0" "-DSOURCE=/root/repo/tests/test19.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test19_incremental_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test19_incremental_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;42;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test19_vm_incremental_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--gc-nursery=0;--gc-threshold=0;--gc-pause-budget=0" "-DSOURCE=/root/repo/tests/test19.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test19_vm_incremental_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test19_vm_incremental_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;43;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test19_image]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DSOURCE=/root/repo/tests/test19.cpplox" "-DWORK_DIR=/root/repo/_asan_build/tests/image" "-P" "/root/repo/tests/image_test.cmake")
+set_tests_properties([=[test19_image]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;45;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test19_aot]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DAOT_COMPILER=/root/repo/_asan_build/cpp-lox/cpp-lox-aot" "-DSOURCE=/root/repo/tests/test19.cpplox" "-DWORK_DIR=/root/repo/_asan_build/tests/aot" "-P" "/root/repo/tests/aot_test.cmake")
+set_tests_properties([=[test19_aot]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;49;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test2]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=" "-DSOURCE=/root/repo/tests/test2.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test2" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test2]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;31;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test2_vm]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm" "-DSOURCE=/root/repo/tests/test2.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test2_vm" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test2_vm]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;32;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test2_stream]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--stream" "-DSOURCE=/root/repo/tests/test2.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test2_stream" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test2_stream]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;33;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test2_vm_stream]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--stream" "-DSOURCE=/root/repo/tests/test2.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test2_vm_stream" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test2_vm_stream]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;34;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test2_dump_ast]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--dump-ast" "-DSOURCE=/root/repo/tests/test2.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=OFF" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test2_dump_ast" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test2_dump_ast]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;35;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test2_jit]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--jit" "-DSOURCE=/root/repo/tests/test2.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test2_jit" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test2_jit]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;36;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test2_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--gc-threshold=0;--gc-growth=1" "-DSOURCE=/root/repo/tests/test2.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test2_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test2_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;38;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test2_vm_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--gc-threshold=0;--gc-growth=1" "-DSOURCE=/root/repo/tests/test2.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test2_vm_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test2_vm_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;39;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test2_minor_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--gc-nursery=0" "-DSOURCE=/root/repo/tests/test2.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test2_minor_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test2_minor_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;40;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test2_vm_minor_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--gc-nursery=0" "-DSOURCE=/root/repo/tests/test2.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test2_vm_minor_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test2_vm_minor_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;41;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test2_incremental_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--gc-nursery=0;--gc-threshold=0;--gc-pause-budget=0" "-DSOURCE=/root/repo/tests/test2.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test2_incremental_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test2_incremental_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;42;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test2_vm_incremental_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--gc-nursery=0;--gc-threshold=0;--gc-pause-budget=0" "-DSOURCE=/root/repo/tests/test2.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test2_vm_incremental_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test2_vm_incremental_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;43;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test2_image]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DSOURCE=/root/repo/tests/test2.cpplox" "-DWORK_DIR=/root/repo/_asan_build/tests/image" "-P" "/root/repo/tests/image_test.cmake")
+set_tests_properties([=[test2_image]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;45;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test2_aot]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DAOT_COMPILER=/root/repo/_asan_build/cpp-lox/cpp-lox-aot" "-DSOURCE=/root/repo/tests/test2.cpplox" "-DWORK_DIR=/root/repo/_asan_build/tests/aot" "-P" "/root/repo/tests/aot_test.cmake")
+set_tests_properties([=[test2_aot]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;49;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test20]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=" "-DSOURCE=/root/repo/tests/test20.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test20" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test20]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;31;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test20_vm]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm" "-DSOURCE=/root/repo/tests/test20.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test20_vm" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test20_vm]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;32;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test20_stream]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--stream" "-DSOURCE=/root/repo/tests/test20.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test20_stream" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test20_stream]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;33;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test20_vm_stream]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--stream" "-DSOURCE=/root/repo/tests/test20.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test20_vm_stream" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test20_vm_stream]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;34;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test20_dump_ast]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--dump-ast" "-DSOURCE=/root/repo/tests/test20.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=OFF" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test20_dump_ast" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test20_dump_ast]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;35;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test20_jit]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--jit" "-DSOURCE=/root/repo/tests/test20.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test20_jit" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test20_jit]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;36;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test20_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--gc-threshold=0;--gc-growth=1" "-DSOURCE=/root/repo/tests/test20.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test20_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test20_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;38;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test20_vm_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--gc-threshold=0;--gc-growth=1" "-DSOURCE=/root/repo/tests/test20.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test20_vm_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test20_vm_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;39;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test20_minor_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--gc-nursery=0" "-DSOURCE=/root/repo/tests/test20.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test20_minor_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test20_minor_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;40;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test20_vm_minor_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--gc-nursery=0" "-DSOURCE=/root/repo/tests/test20.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test20_vm_minor_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test20_vm_minor_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;41;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test20_incremental_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--gc-nursery=0;--gc-threshold=0;--gc-pause-budget=0" "-DSOURCE=/root/repo/tests/test20.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test20_incremental_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test20_incremental_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;42;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test20_vm_incremental_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--gc-nursery=0;--gc-threshold=0;--gc-pause-budget=0" "-DSOURCE=/root/repo/tests/test20.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test20_vm_incremental_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test20_vm_incremental_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;43;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test20_image]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DSOURCE=/root/repo/tests/test20.cpplox" "-DWORK_DIR=/root/repo/_asan_build/tests/image" "-P" "/root/repo/tests/image_test.cmake")
+set_tests_properties([=[test20_image]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;45;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test20_aot]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DAOT_COMPILER=/root/repo/_asan_build/cpp-lox/cpp-lox-aot" "-DSOURCE=/root/repo/tests/test20.cpplox" "-DWORK_DIR=/root/repo/_asan_build/tests/aot" "-P" "/root/repo/tests/aot_test.cmake")
+set_tests_properties([=[test20_aot]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;49;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test21]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=" "-DSOURCE=/root/repo/tests/test21.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test21" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test21]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;31;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test21_vm]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm" "-DSOURCE=/root/repo/tests/test21.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test21_vm" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test21_vm]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;32;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test21_stream]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--stream" "-DSOURCE=/root/repo/tests/test21.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test21_stream" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test21_stream]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;33;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test21_vm_stream]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--stream" "-DSOURCE=/root/repo/tests/test21.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test21_vm_stream" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test21_vm_stream]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;34;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test21_dump_ast]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--dump-ast" "-DSOURCE=/root/repo/tests/test21.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=OFF" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test21_dump_ast" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test21_dump_ast]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;35;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test21_jit]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--jit" "-DSOURCE=/root/repo/tests/test21.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test21_jit" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test21_jit]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;36;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test21_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--gc-threshold=0;--gc-growth=1" "-DSOURCE=/root/repo/tests/test21.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test21_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test21_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;38;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test21_vm_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--gc-threshold=0;--gc-growth=1" "-DSOURCE=/root/repo/tests/test21.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test21_vm_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test21_vm_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;39;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test21_minor_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--gc-nursery=0" "-DSOURCE=/root/repo/tests/test21.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test21_minor_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test21_minor_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;40;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test21_vm_minor_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--gc-nursery=0" "-DSOURCE=/root/repo/tests/test21.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test21_vm_minor_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test21_vm_minor_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;41;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test21_incremental_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--gc-nursery=0;--gc-threshold=0;--gc-pause-budget=0" "-DSOURCE=/root/repo/tests/test21.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test21_incremental_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test21_incremental_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;42;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test21_vm_incremental_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--gc-nursery=0;--gc-threshold=0;--gc-pause-budget=0" "-DSOURCE=/root/repo/tests/test21.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test21_vm_incremental_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test21_vm_incremental_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;43;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test21_image]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DSOURCE=/root/repo/tests/test21.cpplox" "-DWORK_DIR=/root/repo/_asan_build/tests/image" "-P" "/root/repo/tests/image_test.cmake")
+set_tests_properties([=[test21_image]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;45;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test21_aot]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DAOT_COMPILER=/root/repo/_asan_build/cpp-lox/cpp-lox-aot" "-DSOURCE=/root/repo/tests/test21.cpplox" "-DWORK_DIR=/root/repo/_asan_build/tests/aot" "-P" "/root/repo/tests/aot_test.cmake")
+set_tests_properties([=[test21_aot]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;49;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test22]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=" "-DSOURCE=/root/repo/tests/test22.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test22" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test22]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;31;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test22_vm]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm" "-DSOURCE=/root/repo/tests/test22.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test22_vm" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test22_vm]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;32;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test22_stream]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--stream" "-DSOURCE=/root/repo/tests/test22.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test22_stream" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test22_stream]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;33;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test22_vm_stream]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--stream" "-DSOURCE=/root/repo/tests/test22.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test22_vm_stream" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test22_vm_stream]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;34;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test22_dump_ast]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--dump-ast" "-DSOURCE=/root/repo/tests/test22.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=OFF" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test22_dump_ast" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test22_dump_ast]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;35;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test22_jit]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--jit" "-DSOURCE=/root/repo/tests/test22.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test22_jit" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test22_jit]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;36;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test22_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--gc-threshold=0;--gc-growth=1" "-DSOURCE=/root/repo/tests/test22.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test22_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test22_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;38;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test22_vm_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--gc-threshold=0;--gc-growth=1" "-DSOURCE=/root/repo/tests/test22.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test22_vm_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test22_vm_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;39;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test22_minor_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--gc-nursery=0" "-DSOURCE=/root/repo/tests/test22.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test22_minor_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test22_minor_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;40;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test22_vm_minor_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--gc-nursery=0" "-DSOURCE=/root/repo/tests/test22.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test22_vm_minor_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test22_vm_minor_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;41;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test22_incremental_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--gc-nursery=0;--gc-threshold=0;--gc-pause-budget=0" "-DSOURCE=/root/repo/tests/test22.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test22_incremental_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test22_incremental_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;42;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test22_vm_incremental_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--gc-nursery=0;--gc-threshold=0;--gc-pause-budget=0" "-DSOURCE=/root/repo/tests/test22.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test22_vm_incremental_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test22_vm_incremental_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;43;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test22_image]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DSOURCE=/root/repo/tests/test22.cpplox" "-DWORK_DIR=/root/repo/_asan_build/tests/image" "-P" "/root/repo/tests/image_test.cmake")
+set_tests_properties([=[test22_image]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;45;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test22_aot]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DAOT_COMPILER=/root/repo/_asan_build/cpp-lox/cpp-lox-aot" "-DSOURCE=/root/repo/tests/test22.cpplox" "-DWORK_DIR=/root/repo/_asan_build/tests/aot" "-P" "/root/repo/tests/aot_test.cmake")
+set_tests_properties([=[test22_aot]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;49;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test23]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=" "-DSOURCE=/root/repo/tests/test23.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test23" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test23]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;31;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test23_vm]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm" "-DSOURCE=/root/repo/tests/test23.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test23_vm" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test23_vm]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;32;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test23_stream]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--stream" "-DSOURCE=/root/repo/tests/test23.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test23_stream" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test23_stream]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;33;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test23_vm_stream]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--stream" "-DSOURCE=/root/repo/tests/test23.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test23_vm_stream" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test23_vm_stream]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;34;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test23_dump_ast]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--dump-ast" "-DSOURCE=/root/repo/tests/test23.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=OFF" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test23_dump_ast" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test23_dump_ast]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;35;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test23_jit]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--jit" "-DSOURCE=/root/repo/tests/test23.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test23_jit" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test23_jit]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;36;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test23_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--gc-threshold=0;--gc-growth=1" "-DSOURCE=/root/repo/tests/test23.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test23_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test23_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;38;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test23_vm_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--gc-threshold=0;--gc-growth=1" "-DSOURCE=/root/repo/tests/test23.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test23_vm_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test23_vm_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;39;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test23_minor_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--gc-nursery=0" "-DSOURCE=/root/repo/tests/test23.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test23_minor_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test23_minor_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;40;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test23_vm_minor_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--gc-nursery=0" "-DSOURCE=/root/repo/tests/test23.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test23_vm_minor_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test23_vm_minor_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;41;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test23_incremental_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--gc-nursery=0;--gc-threshold=0;--gc-pause-budget=0" "-DSOURCE=/root/repo/tests/test23.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test23_incremental_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test23_incremental_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;42;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test23_vm_incremental_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--gc-nursery=0;--gc-threshold=0;--gc-pause-budget=0" "-DSOURCE=/root/repo/tests/test23.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test23_vm_incremental_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test23_vm_incremental_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;43;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test23_image]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DSOURCE=/root/repo/tests/test23.cpplox" "-DWORK_DIR=/root/repo/_asan_build/tests/image" "-P" "/root/repo/tests/image_test.cmake")
+set_tests_properties([=[test23_image]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;45;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test23_aot]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DAOT_COMPILER=/root/repo/_asan_build/cpp-lox/cpp-lox-aot" "-DSOURCE=/root/repo/tests/test23.cpplox" "-DWORK_DIR=/root/repo/_asan_build/tests/aot" "-P" "/root/repo/tests/aot_test.cmake")
+set_tests_properties([=[test23_aot]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;49;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test24]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=" "-DSOURCE=/root/repo/tests/test24.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test24" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test24]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;31;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test24_vm]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm" "-DSOURCE=/root/repo/tests/test24.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test24_vm" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test24_vm]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;32;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test24_stream]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--stream" "-DSOURCE=/root/repo/tests/test24.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test24_stream" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test24_stream]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;33;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test24_vm_stream]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--stream" "-DSOURCE=/root/repo/tests/test24.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test24_vm_stream" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test24_vm_stream]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;34;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test24_dump_ast]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--dump-ast" "-DSOURCE=/root/repo/tests/test24.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=OFF" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test24_dump_ast" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test24_dump_ast]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;35;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test24_jit]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--jit" "-DSOURCE=/root/repo/tests/test24.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test24_jit" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test24_jit]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;36;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test24_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--gc-threshold=0;--gc-growth=1" "-DSOURCE=/root/repo/tests/test24.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test24_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test24_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;38;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test24_vm_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--gc-threshold=0;--gc-growth=1" "-DSOURCE=/root/repo/tests/test24.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test24_vm_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test24_vm_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;39;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test24_minor_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--gc-nursery=0" "-DSOURCE=/root/repo/tests/test24.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test24_minor_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test24_minor_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;40;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test24_vm_minor_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--gc-nursery=0" "-DSOURCE=/root/repo/tests/test24.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test24_vm_minor_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test24_vm_minor_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;41;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test24_incremental_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--gc-nursery=0;--gc-threshold=0;--gc-pause-budget=0" "-DSOURCE=/root/repo/tests/test24.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test24_incremental_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test24_incremental_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;42;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test24_vm_incremental_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--gc-nursery=0;--gc-threshold=0;--gc-pause-budget=0" "-DSOURCE=/root/repo/tests/test24.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test24_vm_incremental_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test24_vm_incremental_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;43;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test24_image]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DSOURCE=/root/repo/tests/test24.cpplox" "-DWORK_DIR=/root/repo/_asan_build/tests/image" "-P" "/root/repo/tests/image_test.cmake")
+set_tests_properties([=[test24_image]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;45;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test24_aot]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DAOT_COMPILER=/root/repo/_asan_build/cpp-lox/cpp-lox-aot" "-DSOURCE=/root/repo/tests/test24.cpplox" "-DWORK_DIR=/root/repo/_asan_build/tests/aot" "-P" "/root/repo/tests/aot_test.cmake")
+set_tests_properties([=[test24_aot]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;49;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test25]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=" "-DSOURCE=/root/repo/tests/test25.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test25" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test25]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;31;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test25_vm]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm" "-DSOURCE=/root/repo/tests/test25.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test25_vm" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test25_vm]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;32;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test25_stream]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--stream" "-DSOURCE=/root/repo/tests/test25.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test25_stream" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test25_stream]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;33;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test25_vm_stream]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--stream" "-DSOURCE=/root/repo/tests/test25.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test25_vm_stream" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test25_vm_stream]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;34;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test25_dump_ast]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--dump-ast" "-DSOURCE=/root/repo/tests/test25.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=OFF" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test25_dump_ast" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test25_dump_ast]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;35;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test25_jit]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--jit" "-DSOURCE=/root/repo/tests/test25.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test25_jit" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test25_jit]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;36;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test25_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--gc-threshold=0;--gc-growth=1" "-DSOURCE=/root/repo/tests/test25.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test25_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test25_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;38;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test25_vm_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--gc-threshold=0;--gc-growth=1" "-DSOURCE=/root/repo/tests/test25.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test25_vm_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test25_vm_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;39;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test25_minor_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--gc-nursery=0" "-DSOURCE=/root/repo/tests/test25.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test25_minor_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test25_minor_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;40;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test25_vm_minor_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--gc-nursery=0" "-DSOURCE=/root/repo/tests/test25.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test25_vm_minor_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test25_vm_minor_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;41;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test25_incremental_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--gc-nursery=0;--gc-threshold=0;--gc-pause-budget=0" "-DSOURCE=/root/repo/tests/test25.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test25_incremental_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test25_incremental_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;42;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test25_vm_incremental_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--gc-nursery=0;--gc-threshold=0;--gc-pause-budget=0" "-DSOURCE=/root/repo/tests/test25.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test25_vm_incremental_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test25_vm_incremental_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;43;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test25_image]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DSOURCE=/root/repo/tests/test25.cpplox" "-DWORK_DIR=/root/repo/_asan_build/tests/image" "-P" "/root/repo/tests/image_test.cmake")
+set_tests_properties([=[test25_image]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;45;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test25_aot]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DAOT_COMPILER=/root/repo/_asan_build/cpp-lox/cpp-lox-aot" "-DSOURCE=/root/repo/tests/test25.cpplox" "-DWORK_DIR=/root/repo/_asan_build/tests/aot" "-P" "/root/repo/tests/aot_test.cmake")
+set_tests_properties([=[test25_aot]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;49;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test3]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=" "-DSOURCE=/root/repo/tests/test3.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test3" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test3]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;31;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test3_vm]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm" "-DSOURCE=/root/repo/tests/test3.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test3_vm" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test3_vm]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;32;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test3_stream]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--stream" "-DSOURCE=/root/repo/tests/test3.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test3_stream" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test3_stream]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;33;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test3_vm_stream]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--stream" "-DSOURCE=/root/repo/tests/test3.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test3_vm_stream" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test3_vm_stream]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;34;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test3_dump_ast]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--dump-ast" "-DSOURCE=/root/repo/tests/test3.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=OFF" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test3_dump_ast" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test3_dump_ast]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;35;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test3_jit]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--jit" "-DSOURCE=/root/repo/tests/test3.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test3_jit" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test3_jit]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;36;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test3_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--gc-threshold=0;--gc-growth=1" "-DSOURCE=/root/repo/tests/test3.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test3_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test3_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;38;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test3_vm_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--gc-threshold=0;--gc-growth=1" "-DSOURCE=/root/repo/tests/test3.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test3_vm_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test3_vm_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;39;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test3_minor_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--gc-nursery=0" "-DSOURCE=/root/repo/tests/test3.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test3_minor_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test3_minor_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;40;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test3_vm_minor_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--gc-nursery=0" "-DSOURCE=/root/repo/tests/test3.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test3_vm_minor_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test3_vm_minor_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;41;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test3_incremental_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--gc-nursery=0;--gc-threshold=0;--gc-pause-budget=0" "-DSOURCE=/root/repo/tests/test3.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test3_incremental_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test3_incremental_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;42;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test3_vm_incremental_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--gc-nursery=0;--gc-threshold=0;--gc-pause-budget=0" "-DSOURCE=/root/repo/tests/test3.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test3_vm_incremental_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test3_vm_incremental_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;43;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test3_image]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DSOURCE=/root/repo/tests/test3.cpplox" "-DWORK_DIR=/root/repo/_asan_build/tests/image" "-P" "/root/repo/tests/image_test.cmake")
+set_tests_properties([=[test3_image]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;45;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test3_aot]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DAOT_COMPILER=/root/repo/_asan_build/cpp-lox/cpp-lox-aot" "-DSOURCE=/root/repo/tests/test3.cpplox" "-DWORK_DIR=/root/repo/_asan_build/tests/aot" "-P" "/root/repo/tests/aot_test.cmake")
+set_tests_properties([=[test3_aot]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;49;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test4]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=" "-DSOURCE=/root/repo/tests/test4.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test4" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test4]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;31;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test4_vm]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm" "-DSOURCE=/root/repo/tests/test4.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test4_vm" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test4_vm]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;32;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test4_stream]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--stream" "-DSOURCE=/root/repo/tests/test4.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test4_stream" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test4_stream]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;33;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test4_vm_stream]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--stream" "-DSOURCE=/root/repo/tests/test4.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test4_vm_stream" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test4_vm_stream]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;34;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test4_dump_ast]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--dump-ast" "-DSOURCE=/root/repo/tests/test4.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=OFF" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test4_dump_ast" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test4_dump_ast]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;35;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test4_jit]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--jit" "-DSOURCE=/root/repo/tests/test4.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test4_jit" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test4_jit]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;36;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test4_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--gc-threshold=0;--gc-growth=1" "-DSOURCE=/root/repo/tests/test4.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test4_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test4_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;38;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test4_vm_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--gc-threshold=0;--gc-growth=1" "-DSOURCE=/root/repo/tests/test4.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test4_vm_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test4_vm_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;39;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test4_minor_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--gc-nursery=0" "-DSOURCE=/root/repo/tests/test4.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test4_minor_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test4_minor_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;40;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test4_vm_minor_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--gc-nursery=0" "-DSOURCE=/root/repo/tests/test4.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test4_vm_minor_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test4_vm_minor_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;41;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test4_incremental_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--gc-nursery=0;--gc-threshold=0;--gc-pause-budget=0" "-DSOURCE=/root/repo/tests/test4.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test4_incremental_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test4_incremental_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;42;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test4_vm_incremental_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--gc-nursery=0;--gc-threshold=0;--gc-pause-budget=0" "-DSOURCE=/root/repo/tests/test4.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test4_vm_incremental_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test4_vm_incremental_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;43;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test4_image]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DSOURCE=/root/repo/tests/test4.cpplox" "-DWORK_DIR=/root/repo/_asan_build/tests/image" "-P" "/root/repo/tests/image_test.cmake")
+set_tests_properties([=[test4_image]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;45;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test4_aot]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DAOT_COMPILER=/root/repo/_asan_build/cpp-lox/cpp-lox-aot" "-DSOURCE=/root/repo/tests/test4.cpplox" "-DWORK_DIR=/root/repo/_asan_build/tests/aot" "-P" "/root/repo/tests/aot_test.cmake")
+set_tests_properties([=[test4_aot]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;49;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test5]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=" "-DSOURCE=/root/repo/tests/test5.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test5" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test5]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;31;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test5_vm]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm" "-DSOURCE=/root/repo/tests/test5.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test5_vm" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test5_vm]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;32;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test5_stream]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--stream" "-DSOURCE=/root/repo/tests/test5.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test5_stream" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test5_stream]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;33;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test5_vm_stream]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--stream" "-DSOURCE=/root/repo/tests/test5.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test5_vm_stream" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test5_vm_stream]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;34;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test5_dump_ast]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--dump-ast" "-DSOURCE=/root/repo/tests/test5.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=OFF" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test5_dump_ast" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test5_dump_ast]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;35;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test5_jit]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--jit" "-DSOURCE=/root/repo/tests/test5.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test5_jit" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test5_jit]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;36;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test5_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--gc-threshold=0;--gc-growth=1" "-DSOURCE=/root/repo/tests/test5.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test5_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test5_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;38;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test5_vm_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--gc-threshold=0;--gc-growth=1" "-DSOURCE=/root/repo/tests/test5.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test5_vm_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test5_vm_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;39;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test5_minor_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--gc-nursery=0" "-DSOURCE=/root/repo/tests/test5.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test5_minor_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test5_minor_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;40;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test5_vm_minor_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--gc-nursery=0" "-DSOURCE=/root/repo/tests/test5.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test5_vm_minor_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test5_vm_minor_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;41;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test5_incremental_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--gc-nursery=0;--gc-threshold=0;--gc-pause-budget=0" "-DSOURCE=/root/repo/tests/test5.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test5_incremental_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test5_incremental_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;42;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test5_vm_incremental_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--gc-nursery=0;--gc-threshold=0;--gc-pause-budget=0" "-DSOURCE=/root/repo/tests/test5.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test5_vm_incremental_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test5_vm_incremental_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;43;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test5_image]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DSOURCE=/root/repo/tests/test5.cpplox" "-DWORK_DIR=/root/repo/_asan_build/tests/image" "-P" "/root/repo/tests/image_test.cmake")
+set_tests_properties([=[test5_image]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;45;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test5_aot]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DAOT_COMPILER=/root/repo/_asan_build/cpp-lox/cpp-lox-aot" "-DSOURCE=/root/repo/tests/test5.cpplox" "-DWORK_DIR=/root/repo/_asan_build/tests/aot" "-P" "/root/repo/tests/aot_test.cmake")
+set_tests_properties([=[test5_aot]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;49;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test6]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=" "-DSOURCE=/root/repo/tests/test6.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test6" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test6]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;31;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test6_vm]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm" "-DSOURCE=/root/repo/tests/test6.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test6_vm" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test6_vm]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;32;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test6_stream]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--stream" "-DSOURCE=/root/repo/tests/test6.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test6_stream" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test6_stream]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;33;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test6_vm_stream]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--stream" "-DSOURCE=/root/repo/tests/test6.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test6_vm_stream" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test6_vm_stream]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;34;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test6_dump_ast]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--dump-ast" "-DSOURCE=/root/repo/tests/test6.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=OFF" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test6_dump_ast" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test6_dump_ast]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;35;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test6_jit]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--jit" "-DSOURCE=/root/repo/tests/test6.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test6_jit" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test6_jit]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;36;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test6_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--gc-threshold=0;--gc-growth=1" "-DSOURCE=/root/repo/tests/test6.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test6_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test6_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;38;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test6_vm_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--gc-threshold=0;--gc-growth=1" "-DSOURCE=/root/repo/tests/test6.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test6_vm_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test6_vm_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;39;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test6_minor_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--gc-nursery=0" "-DSOURCE=/root/repo/tests/test6.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test6_minor_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test6_minor_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;40;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test6_vm_minor_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--gc-nursery=0" "-DSOURCE=/root/repo/tests/test6.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test6_vm_minor_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test6_vm_minor_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;41;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test6_incremental_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--gc-nursery=0;--gc-threshold=0;--gc-pause-budget=0" "-DSOURCE=/root/repo/tests/test6.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test6_incremental_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test6_incremental_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;42;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test6_vm_incremental_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--gc-nursery=0;--gc-threshold=0;--gc-pause-budget=0" "-DSOURCE=/root/repo/tests/test6.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test6_vm_incremental_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test6_vm_incremental_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;43;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test6_image]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DSOURCE=/root/repo/tests/test6.cpplox" "-DWORK_DIR=/root/repo/_asan_build/tests/image" "-P" "/root/repo/tests/image_test.cmake")
+set_tests_properties([=[test6_image]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;45;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test6_aot]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DAOT_COMPILER=/root/repo/_asan_build/cpp-lox/cpp-lox-aot" "-DSOURCE=/root/repo/tests/test6.cpplox" "-DWORK_DIR=/root/repo/_asan_build/tests/aot" "-P" "/root/repo/tests/aot_test.cmake")
+set_tests_properties([=[test6_aot]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;49;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test7]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=" "-DSOURCE=/root/repo/tests/test7.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test7" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test7]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;31;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test7_vm]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm" "-DSOURCE=/root/repo/tests/test7.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test7_vm" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test7_vm]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;32;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test7_stream]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--stream" "-DSOURCE=/root/repo/tests/test7.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test7_stream" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test7_stream]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;33;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test7_vm_stream]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--stream" "-DSOURCE=/root/repo/tests/test7.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test7_vm_stream" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test7_vm_stream]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;34;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test7_dump_ast]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--dump-ast" "-DSOURCE=/root/repo/tests/test7.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=OFF" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test7_dump_ast" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test7_dump_ast]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;35;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test7_jit]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--jit" "-DSOURCE=/root/repo/tests/test7.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test7_jit" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test7_jit]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;36;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test7_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--gc-threshold=0;--gc-growth=1" "-DSOURCE=/root/repo/tests/test7.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test7_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test7_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;38;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test7_vm_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--gc-threshold=0;--gc-growth=1" "-DSOURCE=/root/repo/tests/test7.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test7_vm_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test7_vm_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;39;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test7_minor_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--gc-nursery=0" "-DSOURCE=/root/repo/tests/test7.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test7_minor_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test7_minor_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;40;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test7_vm_minor_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--gc-nursery=0" "-DSOURCE=/root/repo/tests/test7.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test7_vm_minor_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test7_vm_minor_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;41;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test7_incremental_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--gc-nursery=0;--gc-threshold=0;--gc-pause-budget=0" "-DSOURCE=/root/repo/tests/test7.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test7_incremental_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test7_incremental_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;42;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test7_vm_incremental_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--gc-nursery=0;--gc-threshold=0;--gc-pause-budget=0" "-DSOURCE=/root/repo/tests/test7.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test7_vm_incremental_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test7_vm_incremental_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;43;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test7_image]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DSOURCE=/root/repo/tests/test7.cpplox" "-DWORK_DIR=/root/repo/_asan_build/tests/image" "-P" "/root/repo/tests/image_test.cmake")
+set_tests_properties([=[test7_image]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;45;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test7_aot]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DAOT_COMPILER=/root/repo/_asan_build/cpp-lox/cpp-lox-aot" "-DSOURCE=/root/repo/tests/test7.cpplox" "-DWORK_DIR=/root/repo/_asan_build/tests/aot" "-P" "/root/repo/tests/aot_test.cmake")
+set_tests_properties([=[test7_aot]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;49;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test8]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=" "-DSOURCE=/root/repo/tests/test8.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test8" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test8]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;31;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test8_vm]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm" "-DSOURCE=/root/repo/tests/test8.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test8_vm" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test8_vm]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;32;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test8_stream]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--stream" "-DSOURCE=/root/repo/tests/test8.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test8_stream" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test8_stream]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;33;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test8_vm_stream]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--stream" "-DSOURCE=/root/repo/tests/test8.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test8_vm_stream" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test8_vm_stream]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;34;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test8_dump_ast]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--dump-ast" "-DSOURCE=/root/repo/tests/test8.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=OFF" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test8_dump_ast" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test8_dump_ast]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;35;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test8_jit]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--jit" "-DSOURCE=/root/repo/tests/test8.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test8_jit" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test8_jit]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;36;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test8_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--gc-threshold=0;--gc-growth=1" "-DSOURCE=/root/repo/tests/test8.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test8_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test8_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;38;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test8_vm_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--gc-threshold=0;--gc-growth=1" "-DSOURCE=/root/repo/tests/test8.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test8_vm_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test8_vm_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;39;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test8_minor_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--gc-nursery=0" "-DSOURCE=/root/repo/tests/test8.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test8_minor_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test8_minor_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;40;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test8_vm_minor_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--gc-nursery=0" "-DSOURCE=/root/repo/tests/test8.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test8_vm_minor_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test8_vm_minor_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;41;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test8_incremental_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--gc-nursery=0;--gc-threshold=0;--gc-pause-budget=0" "-DSOURCE=/root/repo/tests/test8.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test8_incremental_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test8_incremental_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;42;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test8_vm_incremental_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--gc-nursery=0;--gc-threshold=0;--gc-pause-budget=0" "-DSOURCE=/root/repo/tests/test8.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test8_vm_incremental_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test8_vm_incremental_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;43;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test8_image]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DSOURCE=/root/repo/tests/test8.cpplox" "-DWORK_DIR=/root/repo/_asan_build/tests/image" "-P" "/root/repo/tests/image_test.cmake")
+set_tests_properties([=[test8_image]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;45;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test8_aot]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DAOT_COMPILER=/root/repo/_asan_build/cpp-lox/cpp-lox-aot" "-DSOURCE=/root/repo/tests/test8.cpplox" "-DWORK_DIR=/root/repo/_asan_build/tests/aot" "-P" "/root/repo/tests/aot_test.cmake")
+set_tests_properties([=[test8_aot]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;49;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test9]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=" "-DSOURCE=/root/repo/tests/test9.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test9" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test9]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;31;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test9_vm]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm" "-DSOURCE=/root/repo/tests/test9.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test9_vm" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test9_vm]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;32;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test9_stream]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--stream" "-DSOURCE=/root/repo/tests/test9.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test9_stream" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test9_stream]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;33;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test9_vm_stream]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--stream" "-DSOURCE=/root/repo/tests/test9.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test9_vm_stream" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test9_vm_stream]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;34;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test9_dump_ast]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--dump-ast" "-DSOURCE=/root/repo/tests/test9.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=OFF" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test9_dump_ast" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test9_dump_ast]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;35;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test9_jit]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--jit" "-DSOURCE=/root/repo/tests/test9.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test9_jit" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test9_jit]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;36;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test9_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--gc-threshold=0;--gc-growth=1" "-DSOURCE=/root/repo/tests/test9.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test9_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test9_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;38;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test9_vm_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--gc-threshold=0;--gc-growth=1" "-DSOURCE=/root/repo/tests/test9.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test9_vm_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test9_vm_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;39;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test9_minor_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--gc-nursery=0" "-DSOURCE=/root/repo/tests/test9.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test9_minor_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test9_minor_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;40;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test9_vm_minor_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--gc-nursery=0" "-DSOURCE=/root/repo/tests/test9.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test9_vm_minor_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test9_vm_minor_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;41;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test9_incremental_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--gc-nursery=0;--gc-threshold=0;--gc-pause-budget=0" "-DSOURCE=/root/repo/tests/test9.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test9_incremental_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test9_incremental_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;42;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test9_vm_incremental_gc_stress]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DARGS=--engine=vm;--gc-nursery=0;--gc-threshold=0;--gc-pause-budget=0" "-DSOURCE=/root/repo/tests/test9.cpplox" "-DEXPECTED_DIR=/root/repo/tests/expected" "-DCHECK_STDERR=ON" "-DWORK_DIR=/root/repo/_asan_build/tests/output/test9_vm_incremental_gc_stress" "-P" "/root/repo/tests/run_test.cmake")
+set_tests_properties([=[test9_vm_incremental_gc_stress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;24;add_test;/root/repo/tests/CMakeLists.txt;43;add_output_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test9_image]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DSOURCE=/root/repo/tests/test9.cpplox" "-DWORK_DIR=/root/repo/_asan_build/tests/image" "-P" "/root/repo/tests/image_test.cmake")
+set_tests_properties([=[test9_image]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;45;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test9_aot]=] "/usr/bin/cmake" "-DINTERPRETER=/root/repo/_asan_build/cpp-lox/cpp-lox" "-DAOT_COMPILER=/root/repo/_asan_build/cpp-lox/cpp-lox-aot" "-DSOURCE=/root/repo/tests/test9.cpplox" "-DWORK_DIR=/root/repo/_asan_build/tests/aot" "-P" "/root/repo/tests/aot_test.cmake")
+set_tests_properties([=[test9_aot]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;49;add_test;/root/repo/tests/CMakeLists.txt;0;")
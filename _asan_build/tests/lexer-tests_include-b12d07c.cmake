@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_asan_build/tests/lexer-tests_tests-b12d07c.cmake")
+  include("/root/repo/_asan_build/tests/lexer-tests_tests-b12d07c.cmake")
+else()
+  add_test(lexer-tests_NOT_BUILT-b12d07c lexer-tests_NOT_BUILT-b12d07c)
+endif()
@@ -0,0 +1,19 @@
+add_test( [==[Lexer handles empty input]==] /root/repo/_asan_build/tests/lexer-tests [==[Lexer handles empty input]==]  )
+set_tests_properties( [==[Lexer handles empty input]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build/tests)
+add_test( [==[Lexer always inserts beginning of file and end of file tokens]==] /root/repo/_asan_build/tests/lexer-tests [==[Lexer always inserts beginning of file and end of file tokens]==]  )
+set_tests_properties( [==[Lexer always inserts beginning of file and end of file tokens]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build/tests)
+add_test( [==[Lexer handles single character tokens]==] /root/repo/_asan_build/tests/lexer-tests [==[Lexer handles single character tokens]==]  )
+set_tests_properties( [==[Lexer handles single character tokens]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build/tests)
+add_test( [==[Lexer handles one or two character tokens]==] /root/repo/_asan_build/tests/lexer-tests [==[Lexer handles one or two character tokens]==]  )
+set_tests_properties( [==[Lexer handles one or two character tokens]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build/tests)
+add_test( [==[Lexer correctly identifies all reserved keywords]==] /root/repo/_asan_build/tests/lexer-tests [==[Lexer correctly identifies all reserved keywords]==]  )
+set_tests_properties( [==[Lexer correctly identifies all reserved keywords]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build/tests)
+add_test( [==[Lexer only recognizes keywords on an exact match]==] /root/repo/_asan_build/tests/lexer-tests [==[Lexer only recognizes keywords on an exact match]==]  )
+set_tests_properties( [==[Lexer only recognizes keywords on an exact match]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build/tests)
+add_test( [==[Lexer correctly get_tokenss various inputs]==] /root/repo/_asan_build/tests/lexer-tests [==[Lexer correctly get_tokenss various inputs]==]  )
+set_tests_properties( [==[Lexer correctly get_tokenss various inputs]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build/tests)
+add_test( [==[Vectorized scanning agrees with the scalar loops]==] /root/repo/_asan_build/tests/lexer-tests [==[Vectorized scanning agrees with the scalar loops]==]  )
+set_tests_properties( [==[Vectorized scanning agrees with the scalar loops]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build/tests)
+add_test( [==[Lexer keeps line and column across long runs]==] /root/repo/_asan_build/tests/lexer-tests [==[Lexer keeps line and column across long runs]==]  )
+set_tests_properties( [==[Lexer keeps line and column across long runs]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build/tests)
+set( lexer-tests_TESTS [==[Lexer handles empty input]==] [==[Lexer always inserts beginning of file and end of file tokens]==] [==[Lexer handles single character tokens]==] [==[Lexer handles one or two character tokens]==] [==[Lexer correctly identifies all reserved keywords]==] [==[Lexer only recognizes keywords on an exact match]==] [==[Lexer correctly get_tokenss various inputs]==] [==[Vectorized scanning agrees with the scalar loops]==] [==[Lexer keeps line and column across long runs]==])
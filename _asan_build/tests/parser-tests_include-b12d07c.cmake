@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_asan_build/tests/parser-tests_tests-b12d07c.cmake")
+  include("/root/repo/_asan_build/tests/parser-tests_tests-b12d07c.cmake")
+else()
+  add_test(parser-tests_NOT_BUILT-b12d07c parser-tests_NOT_BUILT-b12d07c)
+endif()
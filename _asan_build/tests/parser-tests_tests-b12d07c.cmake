@@ -0,0 +1,3 @@
+add_test( [==[Parser test]==] /root/repo/_asan_build/tests/parser-tests [==[Parser test]==]  )
+set_tests_properties( [==[Parser test]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build/tests)
+set( parser-tests_TESTS [==[Parser test]==])
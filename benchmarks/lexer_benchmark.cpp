@@ -0,0 +1,150 @@
+#include "char_scan.h"
+#include "lexer.h"
+#include "typedefs.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+// Lexer throughput in MB/s on generated scripts of a few megabytes, one shaped like ordinary code and
+// one made almost entirely of identifiers and keywords, followed by the scanning loops on their own,
+// vectorized against scalar.  Build the bench-lexer target to run it.
+
+namespace
+{
+    constexpr size_t repetitions = 5;
+
+    template<typename Fn>
+    double best_ms(Fn&& fn)
+    {
+        double best = 0.0;
+
+        for (size_t i = 0; i < repetitions; ++i)
+        {
+            auto start = std::chrono::steady_clock::now();
+            fn();
+            auto end = std::chrono::steady_clock::now();
+            double ms = std::chrono::duration<double, std::milli>(end - start).count();
+            best = i == 0 ? ms : std::min(best, ms);
+        }
+
+        return best;
+    }
+
+    double mb_per_s(size_t bytes, double ms)
+    {
+        return static_cast<double>(bytes) / (1024.0 * 1024.0) / (ms / 1000.0);
+    }
+
+    // Indented code with comments, strings and long identifiers, in the proportions of the test scripts
+    std::string generate_script(size_t functions)
+    {
+        std::string script;
+
+        for (size_t i = 0; i < functions; ++i)
+        {
+            std::string n = std::to_string(i);
+            script += "// Computes the running total for entry " + n + " of the table\n";
+            script += "func compute_running_total_" + n + "(current_value, previous_total) {\n";
+            script += "    /* Values over the limit are clamped\n       before they are added */\n";
+            script += "    var limit = 1000." + n + ";\n";
+            script += "    if (current_value > limit) {\n";
+            script += "        current_value = limit;\n";
+            script += "    }\n";
+            script += "    var message = \"entry " + n + " has been added to the running total\";\n";
+            script += "    return previous_total + current_value * 2;\n";
+            script += "}\n\n";
+        }
+
+        return script;
+    }
+
+    // Short statements with many names, a third of them keywords or near misses of keywords
+    std::string generate_identifier_script(size_t statements)
+    {
+        const char* names[] = { "index", "this", "value", "thistle", "forward", "for", "class_name", "classy",
+            "if", "iffy", "var", "variance", "null", "nullable", "return", "returned", "super", "superb", "x", "y" };
+        constexpr size_t name_count = sizeof(names) / sizeof(names[0]);
+
+        std::string script;
+
+        for (size_t i = 0; i < statements; ++i)
+        {
+            script += names[i % name_count];
+            script += ' ';
+            script += names[(i * 7 + 3) % name_count];
+            script += '.';
+            script += names[(i * 13 + 5) % name_count];
+            script += (i % 4 == 3) ? ";\n" : " ";
+        }
+
+        return script;
+    }
+
+    void time_lexer(const char* name, const std::string& script)
+    {
+        size_t token_count = 0;
+
+        double ms = best_ms([&]() {
+            cpplox::lexer l(script);
+            token_count = l.get_tokens().size();
+        });
+
+        std::printf("%-18s %.1f MB, %zu tokens, %.2f ms, %.0f MB/s, %.1f M tokens/s\n", name,
+            static_cast<double>(script.size()) / (1024.0 * 1024.0), token_count, ms, mb_per_s(script.size(), ms),
+            static_cast<double>(token_count) / (ms * 1000.0));
+    }
+
+    template<typename Scan>
+    const char* run_scan(const std::string& input, Scan scan)
+    {
+        const char* last = input.data() + input.size();
+        const char* result = nullptr;
+
+        for (size_t i = 0; i < 16; ++i)
+            result = scan(input.data(), last);
+
+        return result;
+    }
+
+    void compare_scan(const char* name, const std::string& input, const char* (*vectorized)(const char*, const char*) noexcept,
+        const char* (*scalar)(const char*, const char*) noexcept)
+    {
+        const char* vector_end = nullptr;
+        const char* scalar_end = nullptr;
+        double vector_ms = best_ms([&]() { vector_end = run_scan(input, vectorized); });
+        double scalar_ms = best_ms([&]() { scalar_end = run_scan(input, scalar); });
+
+        std::printf("%-18s %8.0f MB/s  scalar %8.0f MB/s  %s\n", name,
+            mb_per_s(input.size() * 16, vector_ms), mb_per_s(input.size() * 16, scalar_ms),
+            vector_end == scalar_end ? "" : "(results differ)");
+    }
+}
+
+int main()
+{
+    std::printf("instruction set:   %s\n", cpplox::char_scan_instruction_set());
+    time_lexer("code:", generate_script(20000));
+    time_lexer("identifiers:", generate_identifier_script(400000));
+    std::printf("\n");
+
+    // Each input is a single long run, so the numbers show the loops at their best
+    std::string whitespace(64 * 1024, ' ');
+    whitespace.back() = 'x';
+    std::string identifier(64 * 1024, 'a');
+    identifier.back() = ';';
+    std::string digits(64 * 1024, '7');
+    digits.back() = '.';
+    std::string string_body(64 * 1024, 's');
+    string_body.back() = '"';
+
+    compare_scan("skip_whitespace", whitespace, cpplox::skip_whitespace, cpplox::scalar_skip_whitespace);
+    compare_scan("skip_identifier", identifier, cpplox::skip_identifier, cpplox::scalar_skip_identifier);
+    compare_scan("skip_digits", digits, cpplox::skip_digits, cpplox::scalar_skip_digits);
+    compare_scan("find_char", string_body,
+        [](const char* first, const char* last) noexcept { return cpplox::find_char(first, last, '"'); },
+        [](const char* first, const char* last) noexcept { return cpplox::scalar_find_char(first, last, '"'); });
+
+    return 0;
+}
@@ -0,0 +1,101 @@
+#include "cpplox_types.h"
+#include "typedefs.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Printing one million numbers, a mix of integers and doubles, with the old std::to_string based
+// formatting against format_number().  Both write a line per number into a string stream, so the
+// numbers don't include the terminal.  Build the bench-number-format target to run it.
+
+namespace
+{
+    constexpr size_t number_count = 1000000;
+    constexpr size_t repetitions = 5;
+
+    template<typename Fn>
+    double best_ms(Fn&& fn)
+    {
+        double best = 0.0;
+
+        for (size_t i = 0; i < repetitions; ++i)
+        {
+            auto start = std::chrono::steady_clock::now();
+            fn();
+            auto end = std::chrono::steady_clock::now();
+            double ms = std::chrono::duration<double, std::milli>(end - start).count();
+            best = i == 0 ? ms : std::min(best, ms);
+        }
+
+        return best;
+    }
+
+    // What literal_value_to_runtime_string() used to do, which also dropped everything past six decimals
+    std::string to_string_trimmed(double d)
+    {
+        std::string s = std::to_string(d);
+        size_t i = s.find_last_not_of('0');
+        if (s[i] == '.')
+            return s.substr(0, i);
+
+        return s.substr(0, i + 1);
+    }
+
+    // Counters, money amounts and measurements, in the proportions an output-heavy script prints them
+    std::vector<cpplox::literal_value> generate_numbers()
+    {
+        std::vector<cpplox::literal_value> numbers;
+        numbers.reserve(number_count);
+
+        for (size_t i = 0; i < number_count; ++i)
+        {
+            switch (i % 4)
+            {
+                case 0: numbers.emplace_back(static_cast<int64>(i)); break;
+                case 1: numbers.emplace_back(static_cast<int64>(i * 7919 % 100003)); break;
+                case 2: numbers.emplace_back(static_cast<double>(i) / 100.0); break;
+                case 3: numbers.emplace_back(static_cast<double>(i) * 0.37 + 0.001); break;
+            }
+        }
+
+        return numbers;
+    }
+}
+
+int main()
+{
+    std::vector<cpplox::literal_value> numbers = generate_numbers();
+    size_t old_bytes = 0;
+    size_t new_bytes = 0;
+
+    double old_ms = best_ms([&]() {
+        std::ostringstream out;
+        for (const cpplox::literal_value& number : numbers)
+            out << to_string_trimmed(number.as_number()) << '\n';
+        old_bytes = out.str().size();
+    });
+
+    double new_ms = best_ms([&]() {
+        std::ostringstream out;
+        char buffer[cpplox::number_buffer_size + 1];
+        for (const cpplox::literal_value& number : numbers)
+        {
+            char* end = cpplox::format_number(number, buffer, buffer + cpplox::number_buffer_size);
+            *end++ = '\n';
+            out.write(buffer, end - buffer);
+        }
+        new_bytes = out.str().size();
+    });
+
+    std::printf("numbers printed:           %zu\n", number_count);
+    std::printf("std::to_string, trimmed:   %.2f ms, %.1f M numbers/s (%zu bytes)\n", old_ms,
+        static_cast<double>(number_count) / (old_ms * 1000.0), old_bytes);
+    std::printf("format_number:             %.2f ms, %.1f M numbers/s (%zu bytes)\n", new_ms,
+        static_cast<double>(number_count) / (new_ms * 1000.0), new_bytes);
+    std::printf("speedup:                   %.2fx\n", old_ms / new_ms);
+
+    return 0;
+}
@@ -0,0 +1,125 @@
+#include "cpplox_types.h"
+#include "typedefs.h"
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <type_traits>
+#include <variant>
+#include <vector>
+
+// Compares the old std::variant based value layout with the NaN-boxed literal_value on the kind of
+// work the interpreter does the most: copying values around, checking their types and doing arithmetic.
+// Build the bench-values target to run it.
+
+namespace
+{
+    using variant_value = std::variant<
+        double,
+        bool,
+        std::string,
+        cpplox::cpplox_callable*,
+        cpplox::cpplox_instance*,
+        cpplox::cpplox_class*,
+        std::monostate,
+        cpplox::undefined>;
+
+    constexpr size_t value_count = 1024;
+    constexpr size_t iterations = 20000;
+
+    template<typename Fn>
+    double time_ms(Fn&& fn)
+    {
+        auto start = std::chrono::steady_clock::now();
+        fn();
+        auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::milli>(end - start).count();
+    }
+
+    variant_value variant_add(const variant_value& lhs, const variant_value& rhs)
+    {
+        if (std::holds_alternative<double>(lhs) && std::holds_alternative<double>(rhs))
+            return std::get<double>(lhs) + std::get<double>(rhs);
+
+        return std::monostate{};
+    }
+
+    cpplox::literal_value boxed_add(const cpplox::literal_value& lhs, const cpplox::literal_value& rhs)
+    {
+        if (lhs.is_number() && rhs.is_number())
+            return lhs.as_number() + rhs.as_number();
+
+        return std::monostate{};
+    }
+
+    bool variant_is_number(const variant_value& v) { return std::holds_alternative<double>(v); }
+    bool boxed_is_number(const cpplox::literal_value& v) { return v.is_number(); }
+
+    template<typename Value, typename Add, typename IsNumber>
+    double run(std::vector<Value>& values, Add add, IsNumber is_number)
+    {
+        const Value step = 1.0;
+        Value total = 0.0;
+        size_t copied = 0;
+
+        for (size_t i = 0; i < iterations; ++i)
+        {
+            for (size_t j = 0; j < values.size(); ++j)
+            {
+                // Copy the value out the same way an environment lookup returns it to evaluate()
+                Value v = values[j];
+
+                if (is_number(v))
+                {
+                    values[j] = add(v, step);
+                    total = add(total, v);
+                }
+                else
+                {
+                    ++copied;
+                }
+            }
+        }
+
+        if constexpr (std::is_same_v<Value, variant_value>)
+            return std::get<double>(total) + static_cast<double>(copied);
+        else
+            return total.as_number() + static_cast<double>(copied);
+    }
+}
+
+int main()
+{
+    std::vector<variant_value> variant_values;
+    std::vector<cpplox::literal_value> boxed_values;
+
+    // Mostly numbers with the occasional string, as found in a typical program's environments
+    cpplox::cpplox_string shared_string("a string long enough to not fit in the small string buffer");
+
+    for (size_t i = 0; i < value_count; ++i)
+    {
+        if (i % 8 == 0)
+        {
+            variant_values.push_back(shared_string.value());
+            boxed_values.push_back(&shared_string);
+        }
+        else
+        {
+            variant_values.push_back(static_cast<double>(i % 7));
+            boxed_values.push_back(static_cast<double>(i % 7));
+        }
+    }
+
+    double variant_result = 0;
+    double boxed_result = 0;
+
+    double variant_ms = time_ms([&]() { variant_result = run(variant_values, variant_add, variant_is_number); });
+    double boxed_ms = time_ms([&]() { boxed_result = run(boxed_values, boxed_add, boxed_is_number); });
+
+    std::printf("sizeof(std::variant value):  %zu bytes\n", sizeof(variant_value));
+    std::printf("sizeof(literal_value):       %zu bytes\n", sizeof(cpplox::literal_value));
+    std::printf("std::variant arithmetic:     %.2f ms (result %g)\n", variant_ms, variant_result);
+    std::printf("NaN-boxed arithmetic:        %.2f ms (result %g)\n", boxed_ms, boxed_result);
+    std::printf("speedup:                     %.2fx\n", variant_ms / boxed_ms);
+
+    return 0;
+}
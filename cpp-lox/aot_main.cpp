@@ -0,0 +1,246 @@
+#include "arena_memory_pool.h"
+#include "console_io.h"
+#include "interpreter.h"
+#include "lexer.h"
+#include "optimizer.h"
+#include "parser.h"
+#include "resolver.h"
+#include "statements.h"
+#include "transpiler.h"
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <sys/wait.h>
+
+namespace cpplox
+{
+    namespace
+    {
+        const char* usage = "Usage: cpp-lox-aot [-o <output>] [--emit-cpp] [--keep-cpp] [--cxx=<compiler>] "
+            "[--runtime-include=<dir>] [--runtime-library=<file>] file\n";
+
+        // The generated code is compiled the way the build compiled cpp-lox-runtime, and linked against it
+        constexpr const char* build_compiler = CPPLOX_AOT_CXX;
+        constexpr const char* compile_flags = CPPLOX_AOT_FLAGS;
+        constexpr const char* build_include_dir = CPPLOX_AOT_INCLUDE;
+        constexpr const char* build_runtime_library = CPPLOX_AOT_RUNTIME;
+        // Relative to the directory of the installed executable
+        constexpr const char* installed_include_dir = CPPLOX_AOT_INSTALLED_INCLUDE;
+        constexpr const char* installed_runtime_library = CPPLOX_AOT_INSTALLED_RUNTIME;
+
+        // The directory this executable is in, empty if it can't be told
+        std::filesystem::path executable_dir(const char* argv0)
+        {
+            std::error_code ec;
+            std::filesystem::path executable = std::filesystem::read_symlink("/proc/self/exe", ec);
+            if (ec && std::string(argv0).find('/') != std::string::npos)
+                executable = std::filesystem::absolute(argv0, ec);
+
+            return ec ? std::filesystem::path() : executable.parent_path();
+        }
+
+        // The runtime's headers and library where an installed cpp-lox-aot has them, or else where the build left
+        // them.  Either can be given on the command line instead.
+        void find_runtime(const char* argv0, std::string& include_dir, std::string& library)
+        {
+            std::filesystem::path dir = executable_dir(argv0);
+            std::filesystem::path installed_include = dir / installed_include_dir;
+            std::filesystem::path installed_library = dir / installed_runtime_library;
+            bool installed = !dir.empty() && std::filesystem::exists(installed_include / "aot_runtime.h")
+                && std::filesystem::exists(installed_library);
+
+            if (include_dir.empty())
+                include_dir = installed ? installed_include.lexically_normal().string() : build_include_dir;
+            if (library.empty())
+                library = installed ? installed_library.lexically_normal().string() : build_runtime_library;
+        }
+
+        // Runs a shell command and collects what it prints on stdout and stderr, returns its exit status
+        int run_command(const std::string& command, std::string& output)
+        {
+            FILE* pipe = popen((command + " 2>&1").c_str(), "r");
+            if (!pipe)
+                return -1;
+
+            char buffer[4096];
+            size_t read;
+            while ((read = std::fread(buffer, 1, sizeof(buffer), pipe)) > 0)
+                output.append(buffer, read);
+
+            int status = pclose(pipe);
+            return status != -1 && WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+        }
+
+        std::string shell_quote(const std::string& arg)
+        {
+            std::string quoted = "'";
+            for (char c : arg)
+            {
+                if (c == '\'')
+                    quoted += "'\\''";
+                else
+                    quoted += c;
+            }
+
+            return quoted + "'";
+        }
+
+        // The file name without its directory and extension
+        std::string default_output(const std::string& filepath)
+        {
+            size_t name_start = filepath.find_last_of('/');
+            std::string name = name_start == std::string::npos ? filepath : filepath.substr(name_start + 1);
+            size_t extension = name.find_last_of('.');
+            if (extension != std::string::npos && extension > 0)
+                name.resize(extension);
+
+            return name;
+        }
+    }
+
+    int main(int argc, char* argv[])
+    {
+        std::string filepath;
+        std::string output;
+        std::string compiler;
+        std::string include_dir;
+        std::string runtime_library;
+        bool emit_cpp = false;
+        bool keep_cpp = false;
+
+        for (int i = 1; i < argc; ++i)
+        {
+            std::string arg = argv[i];
+
+            if (arg == "-o" && i + 1 < argc)
+            {
+                output = argv[++i];
+            }
+            else if (arg == "--emit-cpp")
+            {
+                emit_cpp = true;
+            }
+            else if (arg == "--keep-cpp")
+            {
+                keep_cpp = true;
+            }
+            else if (arg.rfind("--cxx=", 0) == 0)
+            {
+                compiler = arg.substr(arg.find('=') + 1);
+            }
+            else if (arg.rfind("--runtime-include=", 0) == 0)
+            {
+                include_dir = arg.substr(arg.find('=') + 1);
+            }
+            else if (arg.rfind("--runtime-library=", 0) == 0)
+            {
+                runtime_library = arg.substr(arg.find('=') + 1);
+            }
+            else if (arg.rfind("-", 0) == 0 || !filepath.empty())
+            {
+                std::cerr << "Unknown option [" << arg << "]\n" << usage;
+                return 1;
+            }
+            else
+            {
+                filepath = arg;
+            }
+        }
+
+        if (filepath.empty())
+        {
+            std::cerr << usage;
+            return 1;
+        }
+
+        if (output.empty())
+            output = default_output(filepath);
+
+        // Every AST node lives here, declared first so that it outlives anything that refers to them
+        arena_memory_pool ast_arena;
+        console_io io;
+
+        std::ifstream file(filepath);
+        if (!file)
+        {
+            io.err() << "File with path [" << filepath << "] could not be read\n";
+            return 1;
+        }
+
+        file.seekg(0, std::ios::end);
+        std::string source(static_cast<size_t>(file.tellg()), '\0');
+        file.seekg(0, std::ios::beg);
+        file.read(source.data(), static_cast<std::streamsize>(source.size()));
+        source.resize(static_cast<size_t>(file.gcount()));
+
+        // The front end is the interpreter's, so a program is rejected for the same errors and warned about
+        // the same things
+        interpreter i(&io);
+        resolver r(i);
+
+        lexer l(source, &io);
+        if (l.error_occurred())
+            return 1;
+
+        recursive_descent_parser parser(l, &io, &ast_arena);
+        vector_t<unique_ptr_t<statement>> statements = parser.parse();
+        if (parser.error_occurred())
+            return 1;
+
+        r.resolve_all(statements);
+        if (r.error_occurred())
+            return 1;
+
+        optimizer opt(&ast_arena);
+        opt.optimize_all(statements);
+
+        transpiler t(source, l.source_offset(), filepath);
+        std::string cpp = t.transpile(statements);
+
+        std::string cpp_path = output + ".cpp";
+        {
+            std::ofstream cpp_file(cpp_path, std::ios::binary);
+            cpp_file << cpp;
+
+            if (!cpp_file)
+            {
+                io.err() << "Could not write [" << cpp_path << "]\n";
+                return 1;
+            }
+        }
+
+        if (emit_cpp)
+            return 0;
+
+        // The compiler of the build may not be there anymore once cpp-lox-aot is installed somewhere else
+        if (compiler.empty())
+            compiler = std::filesystem::exists(build_compiler) ? shell_quote(build_compiler) : "c++";
+
+        find_runtime(argv[0], include_dir, runtime_library);
+
+        // What the C++ compiler prints is only shown when it fails, it is not the program's output
+        std::string command = compiler + " " + compile_flags + " -I" + shell_quote(include_dir) + " " + shell_quote(cpp_path)
+            + " " + shell_quote(runtime_library) + " -o " + shell_quote(output);
+        std::string diagnostics;
+        int status = run_command(command, diagnostics);
+
+        if (!keep_cpp)
+            std::remove(cpp_path.c_str());
+
+        if (status != 0)
+        {
+            io.err() << diagnostics << "Compiling the generated C++ failed: " << command << '\n';
+            return 1;
+        }
+
+        return 0;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    return cpplox::main(argc, argv);
+}
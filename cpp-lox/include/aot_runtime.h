@@ -0,0 +1,224 @@
+#ifndef JUMI_CPPLOX_AOT_RUNTIME_H
+#define JUMI_CPPLOX_AOT_RUNTIME_H
+#include "typedefs.h"
+#include "console_io.h"
+#include "cpplox_types.h"
+#include "environment.h"
+#include "expressions.h"
+#include "inline_cache.h"
+#include "memory_manager.h"
+#include "tokens.h"
+#include <deque>
+#include <initializer_list>
+#include <string>
+#include <string_view>
+#include <vector>
+
+NAMESPACE_BEGIN(cpplox)
+
+class aot_function;
+
+// The C++ function cpp-lox-aot generates for a function declaration.  receiver is what 'this' is bound
+// to, nullptr for a plain function.
+using aot_entry = literal_value (*)(aot_function& self, cpplox_instance* receiver, const std::vector<literal_value>& args);
+
+// A function of a program compiled ahead of time, the counterpart of the tree-walker's user_function.
+// Calling one runs the code generated for its declaration.
+class aot_function final : public cpplox_callable
+{
+public:
+    environment* closure;
+    const bool static_method;
+
+    aot_function(aot_entry entry, const symbol* name, int arity, environment* closure_, bool static_method_ = false,
+            cpplox_instance* receiver = nullptr);
+
+    virtual int arity() override;
+    virtual std::string to_string() const override;
+    virtual literal_value call(interpreter& i, const std::vector<literal_value>& args) override;
+    virtual literal_value call_method(interpreter& i, cpplox_instance* receiver, const std::vector<literal_value>& args) override;
+    virtual cpplox_callable* bind(cpplox_instance* instance) override;
+    virtual void trace(memory_manager& mm) override;
+
+    literal_value invoke(cpplox_instance* receiver, const std::vector<literal_value>& args) { return _entry(*this, receiver, args); }
+    cpplox_instance* receiver() const noexcept { return _receiver; }
+
+private:
+    aot_entry _entry;
+    const symbol* _name;
+    int _arity;
+    cpplox_instance* _receiver;
+};
+
+// A method of a class statement, see aot_runtime::define_class()
+struct aot_method
+{
+    aot_entry entry;
+    const token& name;
+    int arity;
+    bool static_method;
+};
+
+// What the C++ generated by cpp-lox-aot runs on: the tree-walker's environments, heap and natives, and
+// the operations on values that are too large to inline, with the same checks and errors as the
+// interpreter.  A program has exactly one, created by its main() before anything else.
+class aot_runtime
+{
+public:
+    // source is the program's text, which its tokens point into
+    explicit aot_runtime(std::string_view source);
+    aot_runtime(const aot_runtime&) = delete;
+    aot_runtime& operator=(const aot_runtime&) = delete;
+
+    environment_manager& environments() noexcept { return _env_manager; }
+
+    // The program's constants, made before it runs.  Identifiers get the id of their name as the payload.
+    token source_token(token_type type, uint32 offset, uint32 length) const;
+    inline_cache* add_cache(property_site_kind kind, const token& name);
+
+    // Runs the top-level statements, reporting a runtime error that escapes them like the interpreter.
+    // Returns the exit status.
+    int run(void (*program)());
+
+    literal_value lookup(const token& name, const variable_slot& resolved) const
+    {
+        if (resolved.is_local())
+            return _env_manager.get_at(resolved, name);
+
+        return _env_manager.get_global_environment()->get(name);
+    }
+
+    void assign(const token& name, const variable_slot& resolved, const literal_value& value);
+    void define(const token& name, int slot, const literal_value& value);
+    cpplox_callable* make_function(aot_entry entry, const token& name, int arity);
+    // superclass is nullptr when the statement has none
+    void define_class(const token& name, int slot, const literal_value* superclass, std::initializer_list<aot_method> methods);
+
+    // ++ and -- on a variable, giving the new value for prefix and the old one for postfix
+    literal_value increment(const token& oper, const token& name, const variable_slot& resolved, bool prefix);
+    [[noreturn]] void invalid_increment_operand(const token& oper, bool prefix) const;
+
+    literal_value call(const token& paren, const literal_value& callee, const std::vector<literal_value>& args);
+    // A method found by method_target() on receiver
+    literal_value call_method(cpplox_callable* method, cpplox_instance* receiver, const std::vector<literal_value>& args);
+    // First half of a method call, before the arguments are evaluated.  Sets method and returns nothing
+    // when object is an instance whose class has the method, or returns the value to call otherwise.
+    literal_value method_target(inline_cache& cache, const literal_value& object, cpplox_callable*& method);
+    literal_value get_property(inline_cache& cache, const literal_value& object);
+    // The instance a set expression stores into, checked before the value is evaluated
+    cpplox_instance* settable(const token& name, const literal_value& object) const;
+    void set_property(inline_cache& cache, cpplox_instance* instance, const literal_value& value);
+    literal_value super_method(const token& keyword, const token& method, const variable_slot& resolved);
+
+private:
+    console_io _io;
+    environment_manager _env_manager;
+    uint32 _source_offset;
+    std::deque<inline_cache> _caches;
+};
+
+// The environment of a call, popped when it returns or unwinds
+class aot_frame
+{
+public:
+    aot_frame(environment_manager& environments, aot_function& function, cpplox_instance* receiver, const std::vector<literal_value>& args)
+        : _environments(environments)
+    {
+        environments.push_environment(function.closure);
+        environment* env = environments.get_current_environment();
+
+        // Static methods have no slot for 'this', even when called through an instance
+        int first_param = 0;
+        if (receiver && !function.static_method)
+        {
+            env->define_slot(0, receiver);
+            first_param = 1;
+        }
+
+        for (size_t i = 0; i < args.size(); ++i)
+            env->define_slot(first_param + static_cast<int>(i), args[i]);
+    }
+
+    ~aot_frame() { _environments.pop_environment(); }
+    aot_frame(const aot_frame&) = delete;
+    aot_frame& operator=(const aot_frame&) = delete;
+
+private:
+    environment_manager& _environments;
+};
+
+// The environment of a block or a for loop
+class aot_scope
+{
+public:
+    explicit aot_scope(environment_manager& environments)
+        : _environments(environments)
+    {
+        environments.push_environment();
+    }
+
+    ~aot_scope() { _environments.pop_environment(); }
+    aot_scope(const aot_scope&) = delete;
+    aot_scope& operator=(const aot_scope&) = delete;
+
+private:
+    environment_manager& _environments;
+};
+
+// Statement boundaries are safe points, like in the tree-walker
+inline void aot_safe_point()
+{
+    memory_manager::instance().collect_if_needed();
+}
+
+inline bool aot_truthy(const literal_value& value)
+{
+    if (value.is_bool())
+        return value.as_bool();
+
+    return is_truthy(value);
+}
+
+// The operators take the operator as a template argument as well, so the generated code only contains the
+// number fast path for that one operator and calls the generic operator for anything else
+template<token_type Oper>
+literal_value aot_unary(const token& oper, const literal_value& rhs)
+{
+    if constexpr (Oper == token_type::minus_)
+    {
+        if (rhs.is_number())
+            return negate_number(rhs);
+    }
+    else if constexpr (Oper == token_type::bang_)
+    {
+        if (rhs.is_bool())
+            return !rhs.as_bool();
+    }
+
+    return apply_unary_operator(oper, rhs);
+}
+
+template<token_type Oper>
+literal_value aot_binary(const token& oper, const literal_value& lhs, const literal_value& rhs)
+{
+    if (lhs.is_number() && rhs.is_number())
+    {
+        if constexpr (Oper == token_type::plus_)                return add_numbers(lhs, rhs);
+        else if constexpr (Oper == token_type::minus_)          return subtract_numbers(lhs, rhs);
+        else if constexpr (Oper == token_type::star_)           return multiply_numbers(lhs, rhs);
+        else if constexpr (Oper == token_type::slash_)          return divide_numbers(lhs, rhs);
+        else if constexpr (Oper == token_type::modulo_)         { if (modulo_defined(lhs, rhs)) return modulo_numbers(lhs, rhs); }
+        else if constexpr (Oper == token_type::greater_)        return greater_numbers(lhs, rhs);
+        else if constexpr (Oper == token_type::greater_equal_)  return greater_equal_numbers(lhs, rhs);
+        else if constexpr (Oper == token_type::less_)           return less_numbers(lhs, rhs);
+        else if constexpr (Oper == token_type::less_equal_)     return less_equal_numbers(lhs, rhs);
+        else if constexpr (Oper == token_type::equal_equal_)    return lhs == rhs;
+        else if constexpr (Oper == token_type::bang_equal_)     return !(lhs == rhs);
+    }
+
+    return apply_binary_operator(oper, lhs, rhs);
+}
+
+NAMESPACE_END
+
+#endif
@@ -1,35 +1,58 @@
 #ifndef JUMI_CPPLOX_ARENA_MEMORY_POOL_H
 #define JUMI_CPPLOX_ARENA_MEMORY_POOL_H
 #include "typedefs.h"
+#include <concepts>
 #include <cstddef>
 #include <memory>
+#include <memory_resource>
+#include <vector>
 
 NAMESPACE_BEGIN(cpplox)
 
-class arena_memory_pool
+// A growable bump allocator.  Allocations are carved out of large blocks and never freed one by one,
+// everything goes away at once when the pool is destroyed.  It is a memory_resource, so pmr containers
+// can allocate their buffers from it as well.
+class arena_memory_pool : public std::pmr::memory_resource
 {
 public:
-    explicit arena_memory_pool(std::size_t size);
+    static constexpr std::size_t default_block_size = 64 * 1024;
+
+    explicit arena_memory_pool(std::size_t block_size = default_block_size);
     ~arena_memory_pool();
+    arena_memory_pool(const arena_memory_pool&) = delete;
+    arena_memory_pool& operator=(const arena_memory_pool&) = delete;
 
-    void* allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t));
+    // Bytes reserved for all blocks
     [[nodiscard]] std::size_t size() const noexcept;
+    // Bytes handed out, including alignment padding
+    [[nodiscard]] std::size_t used() const noexcept;
 
 private:
-    void* _memory;
+    std::vector<void*> _blocks;
+    std::byte* _current;
+    std::byte* _end;
+    std::size_t _block_size;
     std::size_t _size;
-    std::size_t _offset;
+    std::size_t _used;
+
+    void add_block(std::size_t min_size);
 
-    static std::size_t align_forward_adjustment(const void* address, std::size_t alignment);
+    virtual void* do_allocate(std::size_t size, std::size_t alignment) override;
+    virtual void do_deallocate(void* ptr, std::size_t size, std::size_t alignment) override;
+    virtual bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
 };
 
+// The pool releases the memory itself, deleting an object only has to run its destructor
 template<typename T>
 struct memory_pool_deleter
 {
-    arena_memory_pool* pool;
-    explicit memory_pool_deleter(arena_memory_pool* pool) : pool(pool) { }
+    memory_pool_deleter() = default;
+
+    template<typename U>
+        requires std::convertible_to<U*, T*>
+    memory_pool_deleter(const memory_pool_deleter<U>&) noexcept { }
 
-    void operator()(T* ptr)
+    void operator()(T* ptr) const
     {
         if (ptr)
             ptr->~T();
@@ -52,6 +75,32 @@ template<typename T>
 using unique_ptr_t = std::unique_ptr<T>;
 #endif
 
+template<typename T>
+using vector_t = std::pmr::vector<T>;
+
+// Where objects and container buffers that belong to the pool are allocated from.  Without the arena
+// allocator that is the ordinary heap.
+inline std::pmr::memory_resource* pool_resource(arena_memory_pool* pool)
+{
+#ifdef CPPLOX_USE_ARENA_ALLOCATOR
+    return pool;
+#else
+    (void)pool;
+    return std::pmr::new_delete_resource();
+#endif
+}
+
+template<typename T, typename... Args>
+unique_ptr_t<T> make_unique_t(arena_memory_pool* pool, Args&&... args)
+{
+#ifdef CPPLOX_USE_ARENA_ALLOCATOR
+    return make_unique_mem_pool<T>(pool, std::forward<Args>(args)...);
+#else
+    (void)pool;
+    return std::make_unique<T>(std::forward<Args>(args)...);
+#endif
+}
+
 NAMESPACE_END
 
 #endif
@@ -0,0 +1,61 @@
+#ifndef JUMI_CPPLOX_AST_PRINTER_H
+#define JUMI_CPPLOX_AST_PRINTER_H
+#include "typedefs.h"
+#include "expression_visitors.h"
+#include "statement_visitors.h"
+#include "statements.h"
+#include <iosfwd>
+#include <string>
+
+NAMESPACE_BEGIN(cpplox)
+
+// Prints the AST as indented S-expressions, one statement per line, for --dump-ast
+class ast_printer : public statement_visitor, expression_visitor<std::string>
+{
+public:
+    explicit ast_printer(std::ostream& os);
+
+    void print_all(vector_t<unique_ptr_t<statement>>& statements);
+
+    virtual void visit_debug_statement(debug_statement& stmt) override;
+
+    virtual void visit_function_declaration_statement(function_declaration_statement& stmt) override;
+    virtual void visit_variable_declaration_statement(variable_declaration_statement& stmt) override;
+    virtual void visit_if_statement(if_statement& stmt) override;
+    virtual void visit_while_statement(while_statement& stmt) override;
+    virtual void visit_for_statement(for_statement& stmt) override;
+    virtual void visit_break_statement(break_statement& stmt) override;
+    virtual void visit_continue_statement(continue_statement& stmt) override;
+    virtual void visit_return_statement(return_statement& stmt) override;
+    virtual void visit_block_statement(block_statement& stmt) override;
+    virtual void visit_class_statement(class_statement& stmt) override;
+    virtual void visit_expression_statement(expression_statement& stmt) override;
+
+    virtual std::string visit_unary(unary_expression& expr) override;
+    virtual std::string visit_binary(binary_expression& expr) override;
+    virtual std::string visit_literal(literal_expression& expr) override;
+    virtual std::string visit_grouping(grouping_expression& expr) override;
+    virtual std::string visit_variable(variable_expression& expr) override;
+    virtual std::string visit_assignment(assignment_expression& expr) override;
+    virtual std::string visit_logical(logical_expression& expr) override;
+    virtual std::string visit_postfix(postfix_expression& expr) override;
+    virtual std::string visit_call(call_expression& expr) override;
+    virtual std::string visit_get(get_expression& expr) override;
+    virtual std::string visit_set(set_expression& expr) override;
+    virtual std::string visit_this(this_expression& expr) override;
+    virtual std::string visit_super(super_expression& expr) override;
+
+private:
+    std::ostream& _os;
+    int _depth;
+
+    void print(vector_t<unique_ptr_t<statement>>& statements);
+    void print(statement& stmt);
+    std::string print(expression& expr);
+    // Writes a line at the current depth
+    std::ostream& line();
+};
+
+NAMESPACE_END
+
+#endif
@@ -0,0 +1,35 @@
+#ifndef JUMI_CPPLOX_CHAR_SCAN_H
+#define JUMI_CPPLOX_CHAR_SCAN_H
+#include "typedefs.h"
+
+NAMESPACE_BEGIN(cpplox)
+
+// The loops the lexer spends most of its time in.  Each function returns the first position in
+// [first, last) where the run it skips over ends, or last when it doesn't.  On x86-64 they test 16
+// bytes at a time with SSE2, or 32 with AVX2 when the build targets it (CPPLOX_LEXER_AVX2); the
+// scalar versions handle what is left at the end and are used on every other target.
+
+constexpr bool is_whitespace(char c) noexcept { return c == ' ' || (c >= '\t' && c <= '\r'); }
+constexpr bool is_digit(char c) noexcept { return c >= '0' && c <= '9'; }
+constexpr bool is_identifier_start(char c) noexcept { return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_'; }
+constexpr bool is_identifier_char(char c) noexcept { return is_identifier_start(c) || is_digit(c); }
+
+const char* skip_whitespace(const char* first, const char* last) noexcept;
+const char* skip_identifier(const char* first, const char* last) noexcept;
+const char* skip_digits(const char* first, const char* last) noexcept;
+const char* find_char(const char* first, const char* last, char c) noexcept;
+const char* find_either(const char* first, const char* last, char a, char b) noexcept;
+
+// One character at a time
+const char* scalar_skip_whitespace(const char* first, const char* last) noexcept;
+const char* scalar_skip_identifier(const char* first, const char* last) noexcept;
+const char* scalar_skip_digits(const char* first, const char* last) noexcept;
+const char* scalar_find_char(const char* first, const char* last, char c) noexcept;
+const char* scalar_find_either(const char* first, const char* last, char a, char b) noexcept;
+
+// "avx2", "sse2" or "scalar"
+const char* char_scan_instruction_set() noexcept;
+
+NAMESPACE_END
+
+#endif
@@ -0,0 +1,101 @@
+#ifndef JUMI_CPPLOX_CHUNK_H
+#define JUMI_CPPLOX_CHUNK_H
+#include "typedefs.h"
+#include "cpplox_types.h"
+#include "inline_cache.h"
+#include "symbol_table.h"
+#include "tokens.h"
+#include <memory>
+#include <string>
+#include <vector>
+
+NAMESPACE_BEGIN(cpplox)
+
+class vm_function;
+
+// Operands are encoded directly after the opcode.  Constant, identifier, global, inline cache and function
+// indices take two bytes (big endian), local/upvalue slots and argument counts take a single byte.
+enum class opcode : uint8
+{
+    constant_,              // u16 constant index
+    null_,
+    true_,
+    false_,
+    undefined_,
+    pop_,
+
+    get_local_,             // u8 slot
+    set_local_,             // u8 slot
+    get_global_,            // u16 global slot
+    define_global_,         // u16 global slot
+    set_global_,            // u16 global slot
+    get_upvalue_,           // u8 upvalue index
+    set_upvalue_,           // u8 upvalue index
+    get_property_,          // u16 inline cache index
+    set_property_,          // u16 inline cache index
+    get_super_,             // u16 identifier index
+
+    equal_,
+    not_equal_,
+    greater_,
+    greater_equal_,
+    less_,
+    less_equal_,
+    add_,
+    subtract_,
+    multiply_,
+    divide_,
+    modulo_,
+    not_,
+    negate_,
+    increment_,
+    decrement_,
+    postfix_increment_,
+    postfix_decrement_,
+    invalid_operand_,       // u8 postfix, raises the error of ++ or -- applied to something other than a variable
+
+    jump_,                  // u16 forward offset
+    jump_if_false_,         // u16 forward offset
+    loop_,                  // u16 backward offset
+    call_,                  // u8 argument count
+    invoke_,                // u16 inline cache index, u8 argument count
+    closure_,               // u16 function index, then (u8 is_local, u8 index) per upvalue
+    close_upvalue_,
+    return_,
+
+    class_,                 // u16 identifier index
+    inherit_,
+    method_,                // u16 identifier index
+};
+
+// A chunk is the compiled form of a single function body.  Every byte of code has an entry in
+// token_indices so that runtime errors can be reported with the same token information that the
+// tree-walking interpreter reports.
+class chunk
+{
+public:
+    std::vector<uint8> code;
+    std::vector<uint32> token_indices;
+    std::vector<token> tokens;
+    std::vector<literal_value> constants;
+    std::vector<const symbol*> identifiers;
+    std::vector<std::unique_ptr<vm_function>> functions;
+    std::vector<std::unique_ptr<inline_cache>> caches;
+
+    chunk();
+    ~chunk();
+    chunk(const chunk&) = delete;
+    chunk& operator=(const chunk&) = delete;
+
+    void write(uint8 byte, uint32 token_index);
+    uint32 add_token(const token& t);
+    uint16 add_constant(const literal_value& value);
+    uint16 add_identifier(const symbol* name);
+    uint16 add_function(std::unique_ptr<vm_function> function);
+    uint16 add_cache(property_site_kind kind, const token& name);
+    const token& token_at(size_t offset) const;
+};
+
+NAMESPACE_END
+
+#endif
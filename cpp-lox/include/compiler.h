@@ -0,0 +1,126 @@
+#ifndef JUMI_CPPLOX_COMPILER_H
+#define JUMI_CPPLOX_COMPILER_H
+#include "typedefs.h"
+#include "chunk.h"
+#include "exceptions.h"
+#include "expression_visitors.h"
+#include "resolver.h"
+#include "statement_visitors.h"
+#include "statements.h"
+#include "tokens.h"
+#include <memory>
+#include <string>
+#include <vector>
+
+NAMESPACE_BEGIN(cpplox)
+
+class vm;
+class vm_function;
+
+// Lowers a resolved syntax tree into bytecode for the vm.  Locals live in stack slots, variables
+// captured by closures become upvalues and globals are resolved to slots in the vm's global table.
+class compiler final : public statement_visitor, public expression_visitor<void>
+{
+    struct local
+    {
+        std::string name;
+        int depth;
+        bool captured;
+    };
+
+    struct upvalue_ref
+    {
+        uint8 index;
+        bool is_local;
+    };
+
+    struct loop_state
+    {
+        int scope_depth;
+        size_t continue_target;
+        std::vector<size_t> break_jumps;
+    };
+
+    struct function_state
+    {
+        function_state* enclosing;
+        vm_function* function;
+        function_type type;
+        std::vector<local> locals;
+        std::vector<upvalue_ref> upvalues;
+        std::vector<loop_state> loops;
+        int scope_depth;
+        uint32 token_index;
+    };
+
+public:
+    compiler(vm& machine);
+
+    std::unique_ptr<vm_function> compile(const vector_t<unique_ptr_t<statement>>& statements);
+
+private:
+    vm& _vm;
+    function_state* _current;
+
+    virtual void visit_debug_statement(debug_statement& stmt) override;
+
+    virtual void visit_function_declaration_statement(function_declaration_statement& stmt) override;
+    virtual void visit_variable_declaration_statement(variable_declaration_statement& stmt) override;
+    virtual void visit_if_statement(if_statement& stmt) override;
+    virtual void visit_while_statement(while_statement& stmt) override;
+    virtual void visit_for_statement(for_statement& stmt) override;
+    virtual void visit_break_statement(break_statement& stmt) override;
+    virtual void visit_continue_statement(continue_statement& stmt) override;
+    virtual void visit_return_statement(return_statement& stmt) override;
+    virtual void visit_block_statement(block_statement& stmt) override;
+    virtual void visit_class_statement(class_statement& stmt) override;
+    virtual void visit_expression_statement(expression_statement& stmt) override;
+
+    virtual void visit_unary(unary_expression& expr) override;
+    virtual void visit_binary(binary_expression& expr) override;
+    virtual void visit_literal(literal_expression& expr) override;
+    virtual void visit_grouping(grouping_expression& expr) override;
+    virtual void visit_variable(variable_expression& expr) override;
+    virtual void visit_assignment(assignment_expression& expr) override;
+    virtual void visit_logical(logical_expression& expr) override;
+    virtual void visit_postfix(postfix_expression& expr) override;
+    virtual void visit_call(call_expression& expr) override;
+    virtual void visit_get(get_expression& expr) override;
+    virtual void visit_set(set_expression& expr) override;
+    virtual void visit_this(this_expression& expr) override;
+    virtual void visit_super(super_expression& expr) override;
+
+    void compile(const unique_ptr_t<statement>& stmt);
+    void compile(const unique_ptr_t<expression>& expr);
+    void compile_function(function_declaration_statement& stmt, function_type type);
+
+    chunk& current_chunk() const;
+    void set_token(const token& t);
+    void emit(opcode op);
+    void emit_byte(uint8 byte);
+    void emit_short(uint16 value);
+    void emit_constant(const literal_value& value);
+    void emit_return();
+    void emit_loop(size_t loop_start);
+    size_t emit_jump(opcode op);
+    void patch_jump(size_t offset);
+    void emit_scope_exit(int depth);
+
+    void begin_scope();
+    void end_scope();
+    void add_local(const std::string& name);
+    void declare_variable(const token& name);
+    void define_variable(const token& name);
+    int resolve_local(function_state& state, const std::string& name);
+    int resolve_upvalue(function_state& state, const std::string& name);
+    int add_upvalue(function_state& state, uint8 index, bool is_local);
+    void emit_get_variable(const std::string& name);
+    void emit_set_variable(const std::string& name);
+    void emit_increment(expression& operand, const token& oper, bool postfix);
+
+    cpplox_runtime_error error(const std::string& msg, const token& t) const;
+};
+
+NAMESPACE_END
+
+#endif
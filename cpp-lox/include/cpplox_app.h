@@ -1,17 +1,50 @@
 #ifndef JUMI_CPPLOX_CPPLOX_APP_H
 #define JUMI_CPPLOX_CPPLOX_APP_H
 #include "typedefs.h"
+#include "arena_memory_pool.h"
 #include "interpreter.h"
+#include "memory_manager.h"
 #include "resolver.h"
+#include "vm.h"
 #include <memory>
+#include <string>
+#include <vector>
 
 NAMESPACE_BEGIN(cpplox)
 
 class console_io;
+
+enum class execution_engine
+{
+    tree_walker,
+    vm,
+};
+
+struct cpplox_options
+{
+    execution_engine engine = execution_engine::tree_walker;
+    gc_config gc;
+    bool gc_stats = false;
+    bool ic_stats = false;
+    bool quicken_stats = false;
+    // Compile hot functions to machine code, on the tree-walker
+    bool jit = false;
+    bool jit_stats = false;
+    bool symbol_stats = false;
+    // Run each top-level statement as soon as it has been parsed instead of parsing the whole file first
+    bool streaming = false;
+    // Print the AST to stderr once it has been resolved and optimized
+    bool dump_ast = false;
+    // Keep the resolved and optimized program of a file in an image in cache_dir, or the user's cache
+    // directory when that is empty, and run from that instead of the source as long as the source doesn't change
+    bool image_cache = true;
+    std::string cache_dir;
+};
+
 class cpplox_app
 {
 public:
-    cpplox_app();
+    cpplox_app(const cpplox_options& options = {});
     ~cpplox_app();
     cpplox_app(const cpplox_app& rhs) = delete;
     cpplox_app& operator=(const cpplox_app& rhs) = delete;
@@ -20,17 +53,42 @@ public:
 
     void run_file_mode(const char* filepath);
     void run_interpreter_mode();
+    // Whether the program was rejected or stopped at a runtime error
+    bool error_occurred() const noexcept;
 
 private:
+    // A statement run in streaming mode that has to be kept, with the arena it was parsed into
+    struct retained_statement
+    {
+        std::unique_ptr<arena_memory_pool> arena;
+        unique_ptr_t<statement> stmt;
+    };
+
+    // Streaming mode gives every top-level statement an arena of its own, most of them are small
+    static constexpr size_t statement_arena_block_size = 4 * 1024;
+
+    cpplox_options _options;
+    // Every AST node of the session lives here, declared first so that it outlives anything that refers to them
+    arena_memory_pool _ast_arena;
     std::unique_ptr<console_io> _io;
     interpreter _interpreter;
     resolver _resolver;
-    std::vector<std::unique_ptr<statement>> _statements;
+    std::unique_ptr<vm> _vm;
+    std::vector<unique_ptr_t<statement>> _statements;
+    std::vector<retained_statement> _retained_statements;
 
     bool _had_runtime_error;
 
-    void run(const std::string& source);
-    void store_statements(std::vector<std::unique_ptr<statement>>&& statements);
+    // Writes the program to an image at image_path before running it, unless that is empty
+    void run(const std::string& source, const std::string& image_path = {});
+    // Runs the program in the image at image_path, false if there is no usable image of source
+    bool run_image(const std::string& image_path, const std::string& source);
+    void execute(vector_t<unique_ptr_t<statement>>&& statements);
+    void run_streaming(const std::string& source);
+    // Resolves, optimizes and executes a single statement parsed into arena, false if that failed
+    bool execute_statement(vector_t<unique_ptr_t<statement>>& statements, arena_memory_pool* arena);
+    void optimize(vector_t<unique_ptr_t<statement>>& statements, arena_memory_pool* arena);
+    void store_statements(vector_t<unique_ptr_t<statement>>&& statements);
 };
 
 NAMESPACE_END
@@ -1,6 +1,11 @@
 #ifndef JUMI_CPPLOX_CPPLOX_TYPES_H
 #define JUMI_CPPLOX_CPPLOX_TYPES_H
 #include "typedefs.h"
+#include "symbol_table.h"
+#include <bit>
+#include <cmath>
+#include <concepts>
+#include <functional>
 #include <string>
 #include <unordered_map>
 #include <variant>
@@ -16,6 +21,8 @@ class cpplox_callable;
 class cpplox_class;
 class cpplox_instance;
 class interpreter;
+class memory_manager;
+class shape;
 
 struct token;
 
@@ -37,63 +44,353 @@ struct undefined
     bool operator!=(const undefined&) const { return false; }
 };
 
-using literal_value = std::variant<
-      double,
-      bool,
-      std::string,
-      cpplox_callable*,
-      cpplox_instance*,
-      cpplox_class*,
-      std::monostate,
-      undefined>;
-
-template<typename... Ts>
-struct literal_value_overload : Ts... { using Ts::operator()...; };
-template<typename... Ts>
-literal_value_overload(Ts...) -> literal_value_overload<Ts...>;
+// Base of everything the memory_manager allocates.  Objects are chained into an intrusive list for the
+// sweep phase, and trace() marks every other heap object this one keeps alive.
+class heap_object
+{
+public:
+    virtual ~heap_object() = default;
+    virtual void trace([[maybe_unused]] memory_manager& mm) { }
+
+private:
+    friend class memory_manager;
+
+    heap_object* _next_object = nullptr;
+    size_t _size = 0;
+    bool _marked = false;
+    // Allocated in the nursery and not yet survived a collection
+    bool _young = false;
+    // Old object that may point at young ones, see memory_manager::write_barrier()
+    bool _remembered = false;
+    // Lives inside a nursery chunk rather than its own allocation
+    bool _in_chunk = false;
+};
+
+// Strings live on the heap and are owned by the memory_manager, a literal_value only holds a pointer.  They
+// never change once created, so copying a value shares the string.
+//
+// A long concatenation is a rope that only points at its two halves, see memory_manager::concatenate().  The
+// text is joined the first time it is read, after which the rope is an ordinary string and lets go of its
+// halves.  Building a string with s = s + x in a loop is then linear instead of quadratic.
+class cpplox_string : public heap_object
+{
+public:
+    // Set for the strings from memory_manager::intern_string(), which are unique per text
+    bool interned = false;
+
+    cpplox_string(std::string&& value);
+    cpplox_string(cpplox_string* left, cpplox_string* right);
+
+    [[nodiscard]] const std::string& value() const
+    {
+        if (_left)
+            flatten();
+
+        return _value;
+    }
+
+    [[nodiscard]] size_t length() const noexcept { return _length; }
+    [[nodiscard]] bool is_rope() const noexcept { return _left != nullptr; }
+    virtual void trace(memory_manager& mm) override;
+
+private:
+    friend class memory_manager;
+
+    mutable std::string _value;
+    mutable cpplox_string* _left;
+    mutable cpplox_string* _right;
+    size_t _length;
+
+    void flatten() const;
+};
+
+NAMESPACE_BEGIN(nan_boxing)
+
+inline constexpr uint64 qnan            = 0x7ffc000000000000;
+inline constexpr uint64 canonical_nan   = 0x7ff8000000000000;
+inline constexpr uint64 payload_mask    = 0x0000ffffffffffff;
+
+inline constexpr uint64 null_tag        = 0;
+inline constexpr uint64 bool_tag        = 1;
+inline constexpr uint64 undefined_tag   = 2;
+inline constexpr uint64 integer_tag     = 3;
+inline constexpr uint64 string_tag      = 4;
+inline constexpr uint64 callable_tag    = 5;
+inline constexpr uint64 instance_tag    = 6;
+inline constexpr uint64 class_tag       = 7;
+
+constexpr uint64 tag_bits(uint64 tag) noexcept { return ((tag & 4) << 61) | qnan | ((tag & 3) << 48); }
+
+inline constexpr uint64 null_bits       = tag_bits(null_tag);
+inline constexpr uint64 false_bits      = tag_bits(bool_tag);
+inline constexpr uint64 true_bits       = tag_bits(bool_tag) | 1;
+inline constexpr uint64 undefined_bits  = tag_bits(undefined_tag);
+
+// Integers that fit in the 48 bit payload, which every double can also represent exactly
+inline constexpr int64 max_integer      = (int64{ 1 } << 47) - 1;
+inline constexpr int64 min_integer      = -(int64{ 1 } << 47);
+
+NAMESPACE_END
+
+// A runtime value packed into a single 64 bit word using NaN-boxing.  Any bit pattern that is not a
+// quiet NaN with the box bits set is a plain double.  Boxed values carry a 3 bit tag made from the
+// sign bit and the two bits below the quiet NaN prefix; the remaining 48 bits hold the payload, which
+// is a bool, a signed integer, nothing at all, or a pointer to a heap object.
+//
+// Numbers are either doubles or integers, and which one a number is can not be observed from a
+// script.  Integer literals and arithmetic on two integers give integers as long as the exact result
+// is one that fits, anything else is a double.  is_number() and as_number() accept both kinds.
+class literal_value
+{
+public:
+    constexpr literal_value() noexcept : _bits(nan_boxing::null_bits) { }
+    constexpr literal_value(std::monostate) noexcept : _bits(nan_boxing::null_bits) { }
+    constexpr literal_value(undefined) noexcept : _bits(nan_boxing::undefined_bits) { }
+
+    template<typename T> requires std::same_as<T, double>
+    literal_value(T d) noexcept
+        : _bits(std::bit_cast<uint64>(d))
+    {
+        // Hardware NaNs could collide with the boxed encodings, fold them into the canonical one
+        if ((_bits & nan_boxing::qnan) == nan_boxing::qnan)
+            _bits = nan_boxing::canonical_nan;
+    }
+
+    // Integers too large for the payload become the nearest double
+    template<typename T> requires std::same_as<T, int64>
+    literal_value(T i) noexcept
+        : _bits(fits_integer(i)
+            ? nan_boxing::tag_bits(nan_boxing::integer_tag) | (static_cast<uint64>(i) & nan_boxing::payload_mask)
+            : literal_value(static_cast<double>(i))._bits) { }
+
+    template<typename T> requires std::same_as<T, bool>
+    constexpr literal_value(T b) noexcept
+        : _bits(b ? nan_boxing::true_bits : nan_boxing::false_bits) { }
+
+    literal_value(cpplox_string* s) noexcept : _bits(box_pointer(nan_boxing::string_tag, s)) { }
+    literal_value(cpplox_callable* c) noexcept : _bits(box_pointer(nan_boxing::callable_tag, c)) { }
+    literal_value(cpplox_instance* i) noexcept : _bits(box_pointer(nan_boxing::instance_tag, i)) { }
+    literal_value(cpplox_class* c) noexcept : _bits(box_pointer(nan_boxing::class_tag, c)) { }
+
+    [[nodiscard]] bool is_number() const noexcept { return is_double() || is_integer(); }
+    [[nodiscard]] bool is_double() const noexcept { return (_bits & nan_boxing::qnan) != nan_boxing::qnan; }
+    [[nodiscard]] bool is_integer() const noexcept { return has_tag(nan_boxing::integer_tag); }
+    [[nodiscard]] static bool both_integers(const literal_value& lhs, const literal_value& rhs) noexcept
+    {
+        constexpr uint64 tag = nan_boxing::tag_bits(nan_boxing::integer_tag);
+        return (((lhs._bits ^ tag) | (rhs._bits ^ tag)) & ~nan_boxing::payload_mask) == 0;
+    }
+
+    [[nodiscard]] static constexpr bool fits_integer(int64 i) noexcept
+    {
+        return static_cast<uint64>(i) - static_cast<uint64>(nan_boxing::min_integer) <= static_cast<uint64>(nan_boxing::max_integer - nan_boxing::min_integer);
+    }
+    [[nodiscard]] bool is_bool() const noexcept { return (_bits | 1) == nan_boxing::true_bits; }
+    [[nodiscard]] bool is_null() const noexcept { return _bits == nan_boxing::null_bits; }
+    [[nodiscard]] bool is_undefined() const noexcept { return _bits == nan_boxing::undefined_bits; }
+    [[nodiscard]] bool is_string() const noexcept { return has_tag(nan_boxing::string_tag); }
+    [[nodiscard]] bool is_callable() const noexcept { return has_tag(nan_boxing::callable_tag); }
+    [[nodiscard]] bool is_instance() const noexcept { return has_tag(nan_boxing::instance_tag); }
+    [[nodiscard]] bool is_class() const noexcept { return has_tag(nan_boxing::class_tag); }
+
+    [[nodiscard]] double as_number() const noexcept
+    {
+        return is_integer() ? static_cast<double>(as_integer()) : std::bit_cast<double>(_bits);
+    }
+
+    // Sign extends the payload
+    [[nodiscard]] int64 as_integer() const noexcept { return static_cast<int64>(_bits << 16) >> 16; }
+    [[nodiscard]] bool as_bool() const noexcept { return _bits == nan_boxing::true_bits; }
+    [[nodiscard]] cpplox_string* as_string() const noexcept { return unbox_pointer<cpplox_string>(); }
+    [[nodiscard]] cpplox_callable* as_callable() const noexcept { return unbox_pointer<cpplox_callable>(); }
+    [[nodiscard]] cpplox_instance* as_instance() const noexcept { return unbox_pointer<cpplox_instance>(); }
+    [[nodiscard]] cpplox_class* as_class() const noexcept { return unbox_pointer<cpplox_class>(); }
+
+    [[nodiscard]] cpplox_type type() const noexcept;
+    [[nodiscard]] uint64 raw_bits() const noexcept { return _bits; }
+    // The value whose raw_bits() are bits, which have to come from a value in the first place
+    [[nodiscard]] static literal_value from_bits(uint64 bits) noexcept
+    {
+        literal_value value;
+        value._bits = bits;
+        return value;
+    }
+
+    // Strings compare by content, which for two interned strings is their identity.  Every other boxed
+    // value compares by identity.
+    bool operator==(const literal_value& rhs) const noexcept;
+
+private:
+    uint64 _bits;
+
+    static uint64 box_pointer(uint64 tag, const void* ptr) noexcept
+    {
+        return nan_boxing::tag_bits(tag) | (reinterpret_cast<uint64>(ptr) & nan_boxing::payload_mask);
+    }
+
+    template<typename T>
+    T* unbox_pointer() const noexcept { return reinterpret_cast<T*>(_bits & nan_boxing::payload_mask); }
+
+    bool has_tag(uint64 tag) const noexcept { return (_bits & ~nan_boxing::payload_mask) == nan_boxing::tag_bits(tag); }
+};
+
+static_assert(sizeof(literal_value) == sizeof(uint64), "literal_value must fit in a single machine word");
 
 extern std::string cpplox_type_to_string(cpplox_type type);
 extern cpplox_type literal_to_cpplox_type(const literal_value& l);
 extern std::string literal_value_to_runtime_string(const literal_value& l);
 
-class cpplox_callable
+// Room for any number format_number() writes
+inline constexpr size_t number_buffer_size = 32;
+
+// Writes a number with std::to_chars: integers and whole doubles below 1e21 in full, and other doubles as
+// the fewest digits that convert back to the same double, in fixed or scientific notation, whichever is
+// shorter.  Returns the end of the text, which is not null terminated.
+extern char* format_number(const literal_value& number, char* first, char* last) noexcept;
+extern bool is_truthy(const literal_value& l);
+extern bool is_equal(const literal_value& lhs, const literal_value& rhs);
+extern literal_value apply_unary_operator(const token& oper, const literal_value& rhs);
+extern literal_value apply_binary_operator(const token& oper, const literal_value& lhs, const literal_value& rhs);
+
+// Arithmetic and comparisons on two values that are already known to be numbers, shared by both engines.
+// Two integers stay integers while the exact result fits, and give the same double the operation would
+// have given on doubles otherwise.
+inline literal_value add_numbers(const literal_value& lhs, const literal_value& rhs) noexcept
+{
+    if (literal_value::both_integers(lhs, rhs))
+        return lhs.as_integer() + rhs.as_integer();
+
+    return lhs.as_number() + rhs.as_number();
+}
+
+inline literal_value subtract_numbers(const literal_value& lhs, const literal_value& rhs) noexcept
+{
+    if (literal_value::both_integers(lhs, rhs))
+        return lhs.as_integer() - rhs.as_integer();
+
+    return lhs.as_number() - rhs.as_number();
+}
+
+inline literal_value multiply_numbers(const literal_value& lhs, const literal_value& rhs) noexcept
+{
+    if (literal_value::both_integers(lhs, rhs))
+    {
+        int64 l = lhs.as_integer();
+        int64 r = rhs.as_integer();
+
+        // Products of two 32 bit values can't overflow.  A zero with a negative operand is -0, which only
+        // a double can hold.
+        constexpr int64 limit = int64{ 1 } << 31;
+        if (l > -limit && l < limit && r > -limit && r < limit && (l * r != 0 || (l >= 0 && r >= 0)))
+            return l * r;
+    }
+
+    return lhs.as_number() * rhs.as_number();
+}
+
+inline literal_value divide_numbers(const literal_value& lhs, const literal_value& rhs) noexcept
+{
+    return lhs.as_number() / rhs.as_number();
+}
+
+// Whether modulo_numbers() can take the operands: both have to truncate to an int64 and the divisor to
+// something other than 0.  apply_binary_operator() raises a runtime error for anything else.
+inline bool modulo_defined(const literal_value& lhs, const literal_value& rhs) noexcept
+{
+    if (literal_value::both_integers(lhs, rhs))
+        return rhs.as_integer() != 0;
+
+    constexpr double limit = 9.2e18;
+    double l = lhs.as_number();
+    double r = rhs.as_number();
+    return std::fabs(l) < limit && std::fabs(r) < limit && static_cast<int64>(r) != 0;
+}
+
+// Both sides are truncated to integers first, so the result always is one.  Only for operands
+// modulo_defined() accepts.
+inline literal_value modulo_numbers(const literal_value& lhs, const literal_value& rhs) noexcept
+{
+    if (literal_value::both_integers(lhs, rhs))
+        return lhs.as_integer() % rhs.as_integer();
+
+    return static_cast<int64>(lhs.as_number()) % static_cast<int64>(rhs.as_number());
+}
+
+inline literal_value negate_number(const literal_value& value) noexcept
+{
+    if (value.is_integer() && value.as_integer() != 0)
+        return -value.as_integer();
+
+    return -value.as_number();
+}
+
+template<typename Compare>
+bool compare_numbers(const literal_value& lhs, const literal_value& rhs, Compare compare) noexcept
+{
+    if (literal_value::both_integers(lhs, rhs))
+        return compare(lhs.as_integer(), rhs.as_integer());
+
+    return compare(lhs.as_number(), rhs.as_number());
+}
+
+inline bool greater_numbers(const literal_value& lhs, const literal_value& rhs) noexcept { return compare_numbers(lhs, rhs, std::greater<>{}); }
+inline bool greater_equal_numbers(const literal_value& lhs, const literal_value& rhs) noexcept { return compare_numbers(lhs, rhs, std::greater_equal<>{}); }
+inline bool less_numbers(const literal_value& lhs, const literal_value& rhs) noexcept { return compare_numbers(lhs, rhs, std::less<>{}); }
+inline bool less_equal_numbers(const literal_value& lhs, const literal_value& rhs) noexcept { return compare_numbers(lhs, rhs, std::less_equal<>{}); }
+
+class cpplox_callable : public heap_object
 {
 public:
     virtual ~cpplox_callable() = default;
     virtual int arity() = 0;
     virtual std::string to_string() const = 0;
     virtual literal_value call(interpreter& i, const std::vector<literal_value>& args) = 0;
+    // Calls the callable with 'this' bound to receiver, for methods.  Anything else ignores the receiver.
+    virtual literal_value call_method(interpreter& i, cpplox_instance* receiver, const std::vector<literal_value>& args);
+    virtual cpplox_callable* bind(cpplox_instance* instance);
 
 protected:
     environment_manager* _env_manager;
 };
 
+// Native functions never touch the interpreter state, so they expose call_native() as well which lets
+// the bytecode vm call them without having a tree-walking interpreter around.
 class native_function : public cpplox_callable
 {
 public:
     virtual ~native_function() = default;
     virtual int arity() = 0;
     virtual std::string to_string() const = 0;
-    virtual literal_value call(interpreter& i, const std::vector<literal_value>& args) = 0;
+    virtual literal_value call(interpreter& i, const std::vector<literal_value>& args) override final;
+    virtual literal_value call_native(const std::vector<literal_value>& args) = 0;
 };
 
-class user_function : public cpplox_callable
+// Defined in user_function.cpp, apart from the rest of the runtime types, since calling one runs the tree-walker
+class user_function final : public cpplox_callable
 {
 public:
     function_declaration_statement& declaration;
     environment* closure;
 
-    user_function(function_declaration_statement& declaration_, environment* closure, environment_manager* env_manager, bool is_initializer = false);
+    user_function(function_declaration_statement& declaration_, environment* closure, environment_manager* env_manager,
+            bool is_initializer = false, cpplox_instance* receiver = nullptr);
     virtual int arity() override;
     virtual std::string to_string() const override;
     virtual literal_value call(interpreter& i, const std::vector<literal_value>& args) override;
-    cpplox_callable* bind(cpplox_instance* instance);
+    // Calls the method with 'this' bound to the receiver, which goes into the first slot of the call's
+    // environment.  Method calls go through here directly, so only a method used as a value gets bound.
+    virtual literal_value call_method(interpreter& i, cpplox_instance* receiver, const std::vector<literal_value>& args) override;
+    virtual cpplox_callable* bind(cpplox_instance* instance) override;
+    virtual void trace(memory_manager& mm) override;
+    // Neither an initializer nor bound to a receiver
+    [[nodiscard]] bool is_plain_function() const noexcept { return !_is_initializer && !_receiver; }
 
 protected:
     environment_manager* _env_manager;
 
 private:
     bool _is_initializer;
+    cpplox_instance* _receiver;
 };
 
 class clock : public native_function
@@ -102,7 +399,7 @@ public:
     clock();
     virtual int arity() override;
     virtual std::string to_string() const override;
-    virtual literal_value call(interpreter& i, const std::vector<literal_value>& args) override;
+    virtual literal_value call_native(const std::vector<literal_value>& args) override;
 };
 
 class print : public native_function
@@ -111,7 +408,7 @@ public:
     print(console_io* io);
     virtual int arity() override;
     virtual std::string to_string() const override;
-    virtual literal_value call(interpreter& i, const std::vector<literal_value>& args) override;
+    virtual literal_value call_native(const std::vector<literal_value>& args) override;
 
 private:
     console_io* _io;
@@ -123,7 +420,7 @@ public:
     input(console_io* io);
     virtual int arity() override;
     virtual std::string to_string() const override;
-    virtual literal_value call(interpreter& i, const std::vector<literal_value>& args) override;
+    virtual literal_value call_native(const std::vector<literal_value>& args) override;
 
 private:
     console_io* _io;
@@ -133,30 +430,53 @@ class cpplox_class : public cpplox_callable
 {
 public:
     std::string name;
-    std::unordered_map<std::string, cpplox_callable*> methods;
+    symbol_map<cpplox_callable*> methods;
     cpplox_class* superclass;
+    // Unique for the whole run, unlike the address which a new class may reuse once this one is freed
+    const uint64 id;
 
-    cpplox_class(const std::string& name_, std::unordered_map<std::string, cpplox_callable*>&& methods_
+    cpplox_class(const std::string& name_, symbol_map<cpplox_callable*>&& methods_
             , cpplox_class* superclass_);
 
     virtual int arity() override;
     virtual std::string to_string() const override;
     virtual literal_value call(interpreter& i, const std::vector<literal_value>& args) override;
+    virtual void trace(memory_manager& mm) override;
+    // Looks through the superclasses as well
     cpplox_callable* find_method(const token& name);
-    cpplox_callable* find_method(const std::string& name);
+    // Only the class's own methods
+    cpplox_callable* find_method(const symbol* name);
+    // The class's own init method, or nullptr
+    cpplox_callable* initializer();
 };
 
-class cpplox_instance
+class cpplox_instance : public heap_object
 {
 public:
     cpplox_instance(cpplox_class* class_);
     std::string to_string() const;
     literal_value get(const token& name);
     void set(const token& name, const literal_value& value);
+    cpplox_class* get_class() const noexcept;
+    virtual void trace(memory_manager& mm) override;
+
+    // Slot based access for callers that already looked the field up in the instance's shape
+    shape* get_shape() const noexcept { return _shape; }
+    const literal_value& field_at(int index) const;
+    void set_field(int index, const literal_value& value);
+    // Moves the instance to `next`, a transition of its current shape, and stores the new field's value
+    void add_field(shape* next, const literal_value& value);
 
 private:
+    // Most instances only have a handful of fields, those live inline and the rest out of line
+    static constexpr int inline_field_count = 4;
+
     cpplox_class* _class;
-    std::unordered_map<std::string, literal_value> _fields;
+    shape* _shape;
+    literal_value _inline_fields[inline_field_count];
+    std::vector<literal_value> _overflow_fields;
+
+    literal_value& field_slot(int index);
 };
 
 NAMESPACE_END
@@ -2,42 +2,69 @@
 #define JUMI_CPPLOX_ENVIRONMENT_H
 #include "typedefs.h"
 #include "cpplox_types.h"
+#include "expressions.h"
+#include "memory_manager.h"
+#include "symbol_table.h"
 #include "tokens.h"
 #include <string>
 #include <vector>
 
 NAMESPACE_BEGIN(cpplox)
 
-class environment
+// The global environment stores its variables by interned name, in an array indexed by symbol id.  Every other
+// environment is a flat array of the slots the resolver assigned to the variables declared in its scope.
+class environment : public heap_object
 {
 friend class environment_manager;
 public:
     environment(environment* parent_scope = nullptr);
 
-    void define(const std::string& name, const literal_value& value);
-    void assign(const std::string& name, const literal_value& value);
+    void define(const symbol* name, const literal_value& value);
+    void assign(const symbol* name, const literal_value& value);
     literal_value get(const token& name) const;
+    // The value of a variable defined in this environment itself, undefined when there is none
+    literal_value lookup(const symbol* name) const noexcept;
+
+    void define_slot(int slot, const literal_value& value);
+    void assign_slot(int slot, const literal_value& value);
+    literal_value get_slot(int slot, const token& name) const;
+    virtual void trace(memory_manager& mm) override;
 
 private:
-    std::unordered_map<std::string, literal_value> _variables;
+    struct named_variable
+    {
+        literal_value value;
+        bool defined = false;
+    };
+
+    std::vector<named_variable> _variables;
+    std::vector<literal_value> _slots;
     environment* _parent_scope;
+
+    named_variable* find(const symbol* name);
+    const named_variable* find(const symbol* name) const;
 };
 
-class environment_manager
+// The environment stack is the tree-walking interpreter's root set for the garbage collector.
+class environment_manager : public gc_root_source
 {
 public:
     environment_manager();
+    ~environment_manager();
+    environment_manager(const environment_manager&) = delete;
+    environment_manager& operator=(const environment_manager&) = delete;
 
     [[nodiscard]] environment* get_global_environment() const noexcept;
     [[nodiscard]] environment* get_current_environment() const noexcept;
     void push_environment();
     void push_environment(environment* parent_scope);
     void pop_environment();
-    void define(const std::string& name, const literal_value& value);
-    void assign(const std::string& name, const literal_value& value);
-    void assign_at(int distance, const token& name, const literal_value& literal);
+    void define(const symbol* name, const literal_value& value);
+    void assign(const symbol* name, const literal_value& value);
+    void assign_at(const variable_slot& resolved, const literal_value& literal);
     literal_value get(const token& name) const;
-    literal_value get_at(int distance, const token& name) const;
+    literal_value get_at(const variable_slot& resolved, const token& name) const;
+    virtual void mark_roots(memory_manager& mm) override;
 
 private:
     std::vector<environment*> _environments;
@@ -1,8 +1,11 @@
 #ifndef JUMI_CPPLOX_EXPRESSIONS_H
 #define JUMI_CPPLOX_EXPRESSIONS_H
 #include "typedefs.h"
+#include "arena_memory_pool.h"
 #include "tokens.h"
 #include "cpplox_types.h"
+#include "inline_cache.h"
+#include "quickening.h"
 #include <memory>
 #include <string>
 #include <vector>
@@ -12,6 +15,17 @@ NAMESPACE_BEGIN(cpplox)
 template<typename T>
 class expression_visitor;
 
+// Where the resolver found a local variable: how many environments to walk up from the current one
+// and the slot of the variable inside that environment.  Unresolved variables are globals, which are
+// still looked up by name.
+struct variable_slot
+{
+    int depth = -1;
+    int slot = -1;
+
+    bool is_local() const noexcept { return depth >= 0; }
+};
+
 class expression
 {
 public:
@@ -32,9 +46,10 @@ class unary_expression : public expression
 {
 public:
     token oper;
-    std::unique_ptr<expression> expr_rhs;
+    unique_ptr_t<expression> expr_rhs;
+    unary_form form;    // Rewritten by the tree-walker after the operand types it sees
 
-    unary_expression(token oper, std::unique_ptr<expression> expr);
+    unary_expression(token oper, unique_ptr_t<expression> expr);
 
     virtual std::string accept_visitor(expression_visitor<std::string>& v) override;
     virtual void accept_visitor(expression_visitor<void>& v) override;
@@ -44,11 +59,12 @@ public:
 class binary_expression : public expression
 {
 public:
-    std::unique_ptr<expression> expr_lhs;
+    unique_ptr_t<expression> expr_lhs;
     token oper;
-    std::unique_ptr<expression> expr_rhs;
+    unique_ptr_t<expression> expr_rhs;
+    binary_form form;   // Rewritten by the tree-walker after the operand types it sees
 
-    binary_expression(std::unique_ptr<expression> lhs, token oper, std::unique_ptr<expression> rhs);
+    binary_expression(unique_ptr_t<expression> lhs, token oper, unique_ptr_t<expression> rhs);
 
     virtual std::string accept_visitor(expression_visitor<std::string>& v) override;
     virtual void accept_visitor(expression_visitor<void>& v) override;
@@ -70,9 +86,9 @@ public:
 class grouping_expression : public expression
 {
 public:
-    std::unique_ptr<expression> expr_group;
+    unique_ptr_t<expression> expr_group;
 
-    grouping_expression(std::unique_ptr<expression> expr);
+    grouping_expression(unique_ptr_t<expression> expr);
 
     virtual std::string accept_visitor(expression_visitor<std::string>& v) override;
     virtual void accept_visitor(expression_visitor<void>& v) override;
@@ -83,6 +99,9 @@ class variable_expression : public expression
 {
 public:
     token ident_name;
+    variable_slot resolved;
+    // Set by the resolver for a local that always holds a value when read here
+    bool initialized = false;
 
     variable_expression(const token& t);
 
@@ -95,9 +114,10 @@ class assignment_expression : public expression
 {
 public:
     token ident_name;
-    std::unique_ptr<expression> initializer_expr;
+    unique_ptr_t<expression> initializer_expr;
+    variable_slot resolved;
 
-    assignment_expression(const token& ident_name_, std::unique_ptr<expression> initializer_expr_);
+    assignment_expression(const token& ident_name_, unique_ptr_t<expression> initializer_expr_);
 
     virtual std::string accept_visitor(expression_visitor<std::string>& v) override;
     virtual void accept_visitor(expression_visitor<void>& v) override;
@@ -107,11 +127,11 @@ public:
 class logical_expression : public expression
 {
 public:
-    std::unique_ptr<expression> expr_lhs;
+    unique_ptr_t<expression> expr_lhs;
     token oper;
-    std::unique_ptr<expression> expr_rhs;
+    unique_ptr_t<expression> expr_rhs;
 
-    logical_expression(std::unique_ptr<expression> lhs_, token oper_, std::unique_ptr<expression> rhs_);
+    logical_expression(unique_ptr_t<expression> lhs_, token oper_, unique_ptr_t<expression> rhs_);
 
     virtual std::string accept_visitor(expression_visitor<std::string>& v) override;
     virtual void accept_visitor(expression_visitor<void>& v) override;
@@ -121,10 +141,10 @@ public:
 class postfix_expression : public expression
 {
 public:
-    std::unique_ptr<expression> expr_lhs;
+    unique_ptr_t<expression> expr_lhs;
     token oper;
 
-    postfix_expression(std::unique_ptr<expression> expr_, token oper_);
+    postfix_expression(unique_ptr_t<expression> expr_, token oper_);
 
     virtual std::string accept_visitor(expression_visitor<std::string>& v) override;
     virtual void accept_visitor(expression_visitor<void>& v) override;
@@ -134,11 +154,11 @@ public:
 class call_expression : public expression
 {
 public:
-    std::unique_ptr<expression> callee;
+    unique_ptr_t<expression> callee;
     token paren;
-    std::vector<std::unique_ptr<expression>> arguments;
+    vector_t<unique_ptr_t<expression>> arguments;
 
-    call_expression(std::unique_ptr<expression> callee, token paren, std::vector<std::unique_ptr<expression>> arguments);
+    call_expression(unique_ptr_t<expression> callee, token paren, vector_t<unique_ptr_t<expression>> arguments);
 
     virtual std::string accept_visitor(expression_visitor<std::string>& v) override;
     virtual void accept_visitor(expression_visitor<void>& v) override;
@@ -149,10 +169,11 @@ public:
 class get_expression : public expression
 {
 public:
-    std::unique_ptr<expression> object;
+    unique_ptr_t<expression> object;
     token name;
+    inline_cache cache;
 
-    get_expression(std::unique_ptr<expression> object_, token name_);
+    get_expression(unique_ptr_t<expression> object_, token name_);
 
     virtual std::string accept_visitor(expression_visitor<std::string>& v) override;
     virtual void accept_visitor(expression_visitor<void>& v) override;
@@ -162,11 +183,12 @@ public:
 class set_expression : public expression
 {
 public:
-    std::unique_ptr<expression> object;
+    unique_ptr_t<expression> object;
     token name;
-    std::unique_ptr<expression> value;
+    unique_ptr_t<expression> value;
+    inline_cache cache;
 
-    set_expression(std::unique_ptr<expression> object_, token name_, std::unique_ptr<expression> value_);
+    set_expression(unique_ptr_t<expression> object_, token name_, unique_ptr_t<expression> value_);
 
     virtual std::string accept_visitor(expression_visitor<std::string>& v) override;
     virtual void accept_visitor(expression_visitor<void>& v) override;
@@ -177,6 +199,7 @@ class this_expression : public expression
 {
 public:
     token keyword;
+    variable_slot resolved;
 
     this_expression(const token& keyword_);
 
@@ -190,6 +213,7 @@ class super_expression : public expression
 public:
     token keyword;
     token method;
+    variable_slot resolved;
 
     super_expression(const token& keyword_, const token& method_);
 
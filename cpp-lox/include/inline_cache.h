@@ -0,0 +1,116 @@
+#ifndef JUMI_CPPLOX_INLINE_CACHE_H
+#define JUMI_CPPLOX_INLINE_CACHE_H
+#include "typedefs.h"
+#include "cpplox_types.h"
+#include "tokens.h"
+#include <array>
+#include <iosfwd>
+#include <string>
+
+NAMESPACE_BEGIN(cpplox)
+
+class shape;
+
+enum class property_site_kind
+{
+    get,
+    set,
+    invoke,
+};
+
+// What a property access resolved to for instances with one particular shape and class
+struct inline_cache_entry
+{
+    const shape* receiver_shape = nullptr;
+    uint64 class_id = 0;
+    // Slot of the field, or -1 when the property is a method
+    int slot = -1;
+    cpplox_callable* method = nullptr;
+    // For a set that adds the field, the shape the instance moves to
+    shape* transition = nullptr;
+};
+
+// A per-site cache of property lookups on instances.  Since the slot of a field only depends on the
+// instance's shape, and the method only on its class, a lookup that has been done once for a given
+// (shape, class) pair is answered by comparing two words.  A site remembers up to polymorphic_limit
+// pairs; once it sees more than that it is megamorphic and stops caching new ones.
+//
+// Sites count their hits and misses.  Once enable_stats() has been called, print_stats() reports them for
+// every site that ran, including those freed since.
+class inline_cache
+{
+public:
+    static constexpr size_t polymorphic_limit = 4;
+
+    inline_cache(property_site_kind kind, const token& name);
+    ~inline_cache();
+    inline_cache(const inline_cache&) = delete;
+    inline_cache& operator=(const inline_cache&) = delete;
+
+    // Where the property lives for get and invoke sites, throws if the instance has neither a field nor a method by this name
+    const inline_cache_entry& lookup_get(cpplox_instance* instance)
+    {
+        if (const inline_cache_entry* entry = find(instance))
+            return *entry;
+
+        return resolve_get(instance);
+    }
+
+    // Where the value goes for set sites, either an existing slot or a transition that adds the field
+    const inline_cache_entry& lookup_set(cpplox_instance* instance)
+    {
+        if (const inline_cache_entry* entry = find(instance))
+            return *entry;
+
+        return resolve_set(instance);
+    }
+
+    const token& name() const noexcept { return _name; }
+    uint64 hits() const noexcept { return _hits; }
+    uint64 misses() const noexcept { return _misses; }
+    std::string state() const;
+
+    static void enable_stats() noexcept;
+    static void print_stats(std::ostream& os);
+
+private:
+    static constexpr size_t unregistered = static_cast<size_t>(-1);
+
+    property_site_kind _kind;
+    token _name;
+    const symbol* _symbol;
+    std::array<inline_cache_entry, polymorphic_limit> _entries;
+    size_t _entry_count;
+    bool _megamorphic;
+    // Position in the list of sites print_stats() reports, while stats are enabled and the site has run
+    size_t _site_index;
+    // Result of the last miss of a megamorphic site, which has nowhere else to go
+    inline_cache_entry _uncached;
+    uint64 _hits;
+    uint64 _misses;
+
+    const inline_cache_entry* find(cpplox_instance* instance)
+    {
+        const shape* receiver_shape = instance->get_shape();
+        uint64 class_id = instance->get_class()->id;
+
+        for (size_t i = 0; i < _entry_count; ++i)
+        {
+            if (_entries[i].receiver_shape == receiver_shape && _entries[i].class_id == class_id)
+            {
+                ++_hits;
+                return &_entries[i];
+            }
+        }
+
+        return nullptr;
+    }
+
+    const inline_cache_entry& resolve_get(cpplox_instance* instance);
+    const inline_cache_entry& resolve_set(cpplox_instance* instance);
+    const inline_cache_entry& insert(const inline_cache_entry& entry);
+};
+
+NAMESPACE_END
+
+#endif
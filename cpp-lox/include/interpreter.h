@@ -9,39 +9,63 @@
 #include "statements.h"
 #include "statement_visitors.h"
 #include "cpplox_types.h"
+#include "jit.h"
+#include <iosfwd>
 #include <memory>
 #include <vector>
 
 NAMESPACE_BEGIN(cpplox)
 
 class environment;
+class temporary_roots;
 
 class interpreter final : public statement_visitor, public expression_visitor<literal_value>
 {
     friend class user_function;
     friend class resolver;
-    // These are custom exception classes that are thrown by the interpreter.  These are not useful
-    // to users of Geo, they just help with the inner workings of the interpreter.
-    struct cpplox_loop_break      {                           };
-    struct cpplox_loop_continue   {                           };
-    struct cpplox_function_return { literal_value return_val; };
+
+    // How a statement finished executing.  Anything but normal stops the enclosing blocks until it
+    // reaches the loop or function call that handles it, which resets it back to normal.
+    enum class completion
+    {
+        normal,
+        break_,
+        continue_,
+        return_,
+    };
 
 public:
     interpreter(console_io* io);
 
-    void interpret(const std::vector<std::unique_ptr<statement>>& statements);
+    void interpret(const vector_t<unique_ptr_t<statement>>& statements);
+    // Set when a runtime error stopped interpret()
+    bool error_occurred() const noexcept;
+    void reset_error_flag() noexcept;
+    // Compiles hot functions to machine code from now on, where jit::supported()
+    void enable_jit();
+    void print_jit_stats(std::ostream& os) const;
 
 private:
     environment_manager _env_manager;
     console_io* _io;
-    std::unordered_map<expression*, int> _locals;
+    completion _completion;
+    bool _had_error;
+    // Set together with completion::return_, taken by the function call that handles it
+    literal_value _return_value;
+    std::unique_ptr<jit> _jit;
+    // Hotness of the function being run while the jit is enabled, loop iterations count towards it
+    uint32* _loop_hotness;
 
     void instantiate_standard_library();
 
-    literal_value evaluate(const std::unique_ptr<expression>& expr);
-    void evaluate(const std::unique_ptr<statement>& stmt);
-    void resolve(expression& expr, int depth);
-    literal_value lookup_variable(const token& name, expression& expr);
+    literal_value evaluate(const unique_ptr_t<expression>& expr);
+    completion evaluate(const unique_ptr_t<statement>& stmt);
+    literal_value lookup_variable(const token& name, const variable_slot& resolved);
+    void assign_variable(const token& name, const variable_slot& resolved, const literal_value& value);
+    void define_variable(const token& name, int slot, const literal_value& value);
+    literal_value call_value(call_expression& expr, const literal_value& callee, temporary_roots& roots);
+    literal_value invoke(call_expression& expr, get_expression& callee);
+    literal_value get_property(get_expression& expr, const literal_value& object);
 
     virtual void visit_debug_statement(debug_statement& stmt) override;
 
@@ -54,7 +78,7 @@ private:
     virtual void visit_continue_statement(continue_statement& stmt) override;
     virtual void visit_return_statement(return_statement& stmt) override;
     virtual void visit_block_statement(block_statement& stmt) override;
-    void execute_block(const std::vector<std::unique_ptr<statement>>& statements, environment* new_environment);
+    void execute_block(const vector_t<unique_ptr_t<statement>>& statements, environment* new_environment);
     virtual void visit_class_statement(class_statement& stmt) override;
     virtual void visit_expression_statement(expression_statement& stmt) override;
 
@@ -72,9 +96,6 @@ private:
     virtual literal_value visit_this(this_expression& expr) override;
     virtual literal_value visit_super(super_expression& expr) override;
 
-    bool is_truthy(const literal_value& literal) const;
-    bool is_equal(const literal_value& lhs, const literal_value& rhs) const;
-
     cpplox_type_error type_error(const std::string& msg, const token& t) const;
 };
 
@@ -0,0 +1,100 @@
+#ifndef JUMI_CPPLOX_JIT_H
+#define JUMI_CPPLOX_JIT_H
+#include "typedefs.h"
+#include "cpplox_types.h"
+#include <iosfwd>
+#include <memory>
+#include <string>
+#include <vector>
+
+NAMESPACE_BEGIN(cpplox)
+
+class environment;
+class function_declaration_statement;
+class jit;
+
+// Machine code for one function declaration.  A declaration the jit could not compile, or whose code
+// bailed out too often, keeps its jit_function with no code so it is not tried again.
+struct jit_function
+{
+    std::string name;
+    // Takes the jit and the arguments, returns the boxed result or nan_boxing::undefined_bits to bail
+    uint64 (*code)(jit* self, const uint64* args) = nullptr;
+    void* memory = nullptr;
+    size_t size = 0;
+    uint32 bailouts = 0;
+};
+
+struct jit_stats
+{
+    uint64 compiled = 0;
+    // Functions that use something the jit can not compile
+    uint64 rejected = 0;
+    uint64 native_calls = 0;
+    uint64 bailouts = 0;
+    // Functions whose code was dropped after bailing out max_bailouts times
+    uint64 disabled = 0;
+    uint64 code_bytes = 0;
+};
+
+// Baseline compiler from the tree-walker's AST to x86-64 machine code for the hottest functions.
+//
+// Calls of a plain function and the loop back-edges inside it count towards its hotness, and the next
+// call once it reaches hot_threshold compiles it.  Methods are never counted, and a function with
+// something the compiler rejects is found out on its first call and not counted either.  The code works on the NaN-boxed words directly: locals
+// live in the native stack frame, integer arithmetic and comparisons are done inline behind a guard on
+// their operand tags, and everything else calls into a runtime helper.
+//
+// Compiled code can not have an effect outside of its own frame.  It reads globals but never writes
+// them, and only calls functions it can compile as well.  When a guard fails, or a helper finds it
+// can not do its job without raising an error or allocating, the code bails out and the interpreter
+// runs the whole call again from the start.  A function that bails out too often is left to the
+// interpreter for good.
+class jit
+{
+public:
+    static constexpr uint32 hot_threshold = 1000;
+    static constexpr uint32 max_bailouts = 4;
+    // Nested native calls, beyond which the code bails out rather than risk the native stack
+    static constexpr uint32 max_native_depth = 1024;
+
+    explicit jit(environment* globals);
+    ~jit();
+    jit(const jit&) = delete;
+    jit& operator=(const jit&) = delete;
+
+    // Whether the jit can generate code for the machine it runs on
+    static bool supported() noexcept;
+
+    // Counts a call of the declaration and runs its code once it has some.  False when the interpreter
+    // has to make the call itself, result is set otherwise.
+    bool try_call(function_declaration_statement& declaration, const std::vector<literal_value>& args, literal_value& result);
+
+    const jit_stats& stats() const noexcept { return _stats; }
+    void print_stats(std::ostream& os) const;
+
+private:
+    class compiler;
+
+    environment* _globals;
+    std::vector<std::unique_ptr<jit_function>> _functions;
+    jit_stats _stats;
+    uint32 _native_depth;
+
+    // Whether compile() would generate code for the declaration now, which doesn't keep the code
+    bool compilable(function_declaration_statement& declaration) const;
+    // The declaration's jit_function, without code until compile() gives it some
+    jit_function& add_function(function_declaration_statement& declaration);
+    jit_function& compile(function_declaration_statement& declaration);
+    // Copies the code into executable memory and tells perf where it is
+    void install(jit_function& function, const std::vector<uint8>& code);
+    uint64 run(jit_function& function, const uint64* args);
+
+    // Runtime helpers the code calls, see jit.cpp
+    static uint64 get_global(jit* self, const symbol* name);
+    static uint64 call_global(jit* self, const symbol* name, const uint64* args, uint64 count);
+};
+
+NAMESPACE_END
+
+#endif
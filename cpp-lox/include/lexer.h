@@ -2,54 +2,79 @@
 #define JUMI_CPPLOX_LEXER_H
 #include "typedefs.h"
 #include "tokens.h"
+#include <array>
 #include <optional>
 #include <string>
 #include <string_view>
 #include <vector>
-#include <unordered_map>
 
 NAMESPACE_BEGIN(cpplox)
 
 class console_io;
 
+enum class lexer_mode
+{
+    // The constructor tokenizes the whole input, get_tokens() returns the result
+    eager,
+    // Nothing is done up front, each next_token() scans one more token
+    streaming,
+};
+
 class lexer
 {
     struct lexer_state
     {
-        uint32 current_line = 1;
-        uint32 current_pos = 1;
         uint32 left_ptr = 0;
         uint32 right_ptr = 0;
-        std::string input = "";
-        std::string_view current_source_line;
+        // Offset of the input in the source_manager's text, which is what tokens refer to
+        uint32 base = 0;
+        std::string_view input;
     };
 
 public:
-    lexer(const std::string& input, console_io* io = nullptr);
+    lexer(const std::string& input, console_io* io = nullptr, lexer_mode mode = lexer_mode::eager);
 
     const std::vector<token>& get_tokens() const noexcept;
+    // bof first, then every token that isn't whitespace or a comment, then eof for every call after that.
+    // Invalid characters are reported as they are reached in streaming mode.
+    token next_token();
     bool error_occurred() const noexcept;
     void reset_error_flag() noexcept;
+    // Where the input starts in the source_manager's text
+    uint32 source_offset() const noexcept { return _lexer_state.base; }
 
 private:
     lexer_state _lexer_state;
     std::vector<token> _tokens;
+    lexer_mode _mode;
+    // Index in _tokens of the next token to return in eager mode
+    size_t _next_token;
+    bool _bof_returned;
     bool _lexer_error;
     console_io* _io;
 
-    static const std::unordered_map<char, token(lexer::*)(void)> char_to_lexer_func_map;
-    static const std::unordered_map<std::string, token_type> reserved_keyword_lookup;
+    using token_handler = token (lexer::*)();
+
+    // What to do for each possible first character of a token, built at compile time
+    static const std::array<token_handler, 256> char_dispatch;
+    static constexpr std::array<token_handler, 256> make_char_dispatch();
 
     void tokenize();
+    // The next significant token from the input, invalid ones are returned as well
+    token scan_token();
 
     token fetch_token();
     std::optional<char> advance_lexer();
     std::optional<char> peek_next();
     bool advance_if_next_matches(char c);
-    token create_token(token_type type, const literal_value& literal = std::monostate{});
+    const char* cursor() const noexcept;
+    const char* input_end() const noexcept;
+    void advance_to(const char* position) noexcept;
+    // Records the start of every line after a newline in [first, last)
+    void add_line_starts(const char* first, const char* last);
+    token create_token(token_type type, uint32 payload = 0);
 
     std::string format_error(const token& t) const;
-    std::string_view extract_source_line(std::string_view, size_t index);
     uint32 extract_lexeme_length() const noexcept;
     token left_paren();
     token right_paren();
@@ -72,6 +97,7 @@ private:
     token identifier();
     token string();
     token number();
+    token whitespace();
     token invalid_token();
 };
 
@@ -1,9 +1,18 @@
 #ifndef JUMI_CPPLOX_MEMORY_MANAGER_H
 #define JUMI_CPPLOX_MEMORY_MANAGER_H
+#include "cpplox_types.h"
 #include "statements.h"
+#include "symbol_table.h"
 #include "typedefs.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <new>
 #include <string>
-#include <unordered_set>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 NAMESPACE_BEGIN(cpplox)
 
@@ -13,7 +22,76 @@ class environment;
 class environment_manager;
 class function_declaration_statement;
 class cpplox_instance;
+class cpplox_string;
+class memory_manager;
 
+struct gc_config
+{
+    // Bytes the old generation can hold before the first major collection runs
+    size_t initial_threshold = 1024 * 1024;
+    // After a major collection, the next one runs once the old generation has grown to live bytes * growth_factor
+    double growth_factor = 2.0;
+    // Bytes allocated into the nursery between minor collections
+    size_t nursery_size = 256 * 1024;
+    // Mark and sweep the old generation in slices instead of stopping the world for a major collection
+    bool incremental = false;
+    // Time an incremental slice may take, including the minor collection it follows
+    long pause_budget_us = 1000;
+};
+
+// Bucket i counts the pauses shorter than 2^i microseconds, the last one everything longer
+struct pause_histogram
+{
+    static constexpr size_t bucket_count = 24;
+
+    std::array<size_t, bucket_count> buckets{};
+    size_t samples = 0;
+
+    void record(long pause_us);
+    // Upper bound of the bucket the given fraction of the pauses fall under
+    long percentile(double fraction) const;
+};
+
+struct gc_stats
+{
+    size_t collections = 0;
+    size_t minor_collections = 0;
+    size_t incremental_slices = 0;
+    size_t objects_freed = 0;
+    size_t objects_promoted = 0;
+    size_t bytes_freed = 0;
+    size_t peak_bytes = 0;
+    long total_pause_us = 0;
+    long max_pause_us = 0;
+    pause_histogram pauses;
+};
+
+// Anything that references heap objects from outside of the heap, like the interpreter's environment
+// stack or the vm's value stack, registers itself as a root source with the memory_manager.
+class gc_root_source
+{
+public:
+    virtual ~gc_root_source() = default;
+    virtual void mark_roots(memory_manager& mm) = 0;
+};
+
+// Owns every heap_object and frees the unreachable ones with a generational mark-and-sweep collector.
+//
+// New objects are bump allocated into nursery chunks.  A minor collection marks only the young objects
+// reachable from the roots and from the remembered set, frees the dead ones and promotes the survivors
+// to the old generation in place; a chunk that still holds survivors is retired and reused once they
+// all die.  Objects never move, since the engines keep raw pointers to them on the native stack.  A
+// major collection marks and sweeps both generations.
+//
+// In incremental mode the old generation is instead collected with tri-color marking in slices that
+// follow the minor collections.  Unmarked objects are white, marked objects on the gray stack are gray
+// and traced ones are black.  The write barrier shades any old object stored into a marked one, so a
+// black object never points at a white one; objects promoted while marking start out gray.  Marking
+// finishes with an atomic rescan of the roots, after which the old generation is swept in slices too.
+//
+// Collections only run at safe points the execution engines choose (statement boundaries for the
+// interpreter, calls and backward jumps for the vm), where every live value is reachable from a root
+// source, a temporary root or a pinned object.
 class memory_manager
 {
 public:
@@ -25,19 +103,227 @@ public:
     memory_manager(memory_manager&&) = delete;
     memory_manager& operator=(memory_manager&&) = delete;
 
-    bool register_callable(cpplox_callable* callable);
+    void configure(const gc_config& config);
+
+    template<typename T, typename... Args>
+    T* allocate(Args&&... args)
+    {
+        if constexpr (sizeof(T) <= max_young_object_size)
+        {
+            static_assert(alignof(T) <= nursery_alignment, "Nursery objects must fit the nursery alignment");
+
+            T* object = new (bump_allocate(sizeof(T))) T(std::forward<Args>(args)...);
+            track_young(object, sizeof(T));
+            return object;
+        }
+        else
+        {
+            return allocate_old<T>(std::forward<Args>(args)...);
+        }
+    }
+
+    // Skips the nursery, for objects that are expected to live long
+    template<typename T, typename... Args>
+    T* allocate_old(Args&&... args)
+    {
+        T* object = new T(std::forward<Args>(args)...);
+        track_old(object, sizeof(T));
+        return object;
+    }
+
+    cpplox_string* allocate_string(std::string&& value);
+    // lhs followed by rhs.  Short results are copied into a new string, longer ones are ropes that are
+    // only joined when their text is read.
+    cpplox_string* concatenate(cpplox_string* lhs, cpplox_string* rhs);
+    // The one string with this text that lives as long as the program, used for string literals.  All
+    // of them are interned, so two with the same text are the same object.
+    cpplox_string* intern_string(std::string_view value);
     cpplox_callable* allocate_class(const std::string& name,
-            std::unordered_map<std::string, cpplox_callable*>&& methods, cpplox_class* superclass);
+            symbol_map<cpplox_callable*>&& methods, cpplox_class* superclass);
     cpplox_callable* allocate_user_function(function_declaration_statement& stmt,
             environment* env, environment_manager* env_manager, bool is_initializer = false);
     cpplox_instance* allocate_instance(cpplox_class* class_);
     environment* allocate_environment();
     environment* allocate_environment(environment* parent_scope);
 
+    void add_root_source(gc_root_source* source);
+    void remove_root_source(gc_root_source* source);
+    void push_temporary(const literal_value& value);
+    void truncate_temporaries(size_t count) noexcept;
+    size_t temporary_count() const noexcept;
+
+    // Must be called after storing a reference into an existing heap object, so minor collections can
+    // find young objects that are only reachable from the old generation, and incremental marking never
+    // leaves a white object behind a black one.
+    static void write_barrier(heap_object* owner, heap_object* target)
+    {
+        if (!target || owner->_young)
+            return;
+
+        if (target->_young)
+        {
+            if (!owner->_remembered)
+                instance().remember(owner);
+        }
+        else if (owner->_marked && !target->_marked)
+        {
+            instance().shade(target);
+        }
+    }
+
+    static void write_barrier(heap_object* owner, const literal_value& value)
+    {
+        if (!owner->_young)
+            write_barrier(owner, as_heap_object(value));
+    }
+
+    static heap_object* as_heap_object(const literal_value& value) noexcept
+    {
+        if (value.is_string())   return value.as_string();
+        if (value.is_instance()) return value.as_instance();
+        if (value.is_callable()) return value.as_callable();
+        if (value.is_class())    return value.as_class();
+        return nullptr;
+    }
+
+    void collect_if_needed()
+    {
+        if (_young_bytes >= _config.nursery_size || old_generation_bytes() >= _next_collection)
+            collect_garbage();
+    }
+
+    void collect();
+    void collect_young();
+    void mark(heap_object* object);
+    void mark(const literal_value& value);
+
+    const gc_stats& stats() const noexcept;
+    void print_stats(std::ostream& os) const;
+
+private:
+    // Flattening a rope charges the bytes of its joined text
+    friend class cpplox_string;
+
+    struct nursery_chunk
+    {
+        size_t live_objects = 0;
+        bool retired = false;
+    };
+
+    enum class gc_phase
+    {
+        idle,
+        marking,
+        sweeping,
+    };
+
+    enum class mark_mode
+    {
+        full,
+        young,
+        old,
+    };
+
+    // Chunks are aligned to their size, so the chunk of any object inside one is found by masking its address
+    static constexpr size_t chunk_size = 32 * 1024;
+    static constexpr size_t nursery_alignment = 16;
+    static constexpr size_t chunk_header_size = (sizeof(nursery_chunk) + nursery_alignment - 1) & ~(nursery_alignment - 1);
+    static constexpr size_t max_young_object_size = chunk_size / 8;
+    // Concatenations up to this many bytes are copied rather than made into ropes.  Short strings appended
+    // to a rope are copied into its right half while that stays under the limit, so a rope built one small
+    // piece at a time has a node for every few hundred bytes instead of one per piece.
+    static constexpr size_t flat_concatenation_limit = 256;
+
+    heap_object* _objects;
+    heap_object* _young_objects;
+    heap_object* _sweep_list;
+    std::byte* _nursery_top;
+    std::byte* _nursery_end;
+    std::vector<nursery_chunk*> _nursery_chunks;
+    std::vector<nursery_chunk*> _free_chunks;
+    std::vector<heap_object*> _remembered_set;
+    std::vector<heap_object*> _gray_stack;
+    std::vector<heap_object*> _incremental_gray_stack;
+    std::vector<heap_object*> _pinned;
+    symbol_map<cpplox_string*> _interned_strings;
+    std::vector<gc_root_source*> _root_sources;
+    std::vector<literal_value> _temporaries;
+    gc_config _config;
+    gc_stats _stats;
+    size_t _bytes_allocated;
+    size_t _young_bytes;
+    size_t _retired_chunks;
+    size_t _object_count;
+    size_t _next_collection;
+    size_t _cycle_limit;
+    gc_phase _phase;
+    mark_mode _mark_mode;
+
+    void* bump_allocate(size_t size)
+    {
+        size = (size + nursery_alignment - 1) & ~(nursery_alignment - 1);
+
+        if (static_cast<size_t>(_nursery_end - _nursery_top) < size)
+            refill_nursery();
+
+        void* memory = _nursery_top;
+        _nursery_top += size;
+        return memory;
+    }
+
+    static nursery_chunk* chunk_of(heap_object* object) noexcept
+    {
+        return reinterpret_cast<nursery_chunk*>(reinterpret_cast<std::uintptr_t>(object) & ~(chunk_size - 1));
+    }
+
+    // Retired chunks are charged in full, their free space can not be reused until every object in them died
+    size_t old_generation_bytes() const noexcept
+    {
+        return _bytes_allocated - _young_bytes + _retired_chunks * chunk_size;
+    }
+
+    void refill_nursery();
+    void release_chunk(nursery_chunk* chunk);
+    void retire_nursery();
+    void track_young(heap_object* object, size_t size);
+    void track_old(heap_object* object, size_t size);
+    void charge(heap_object* object, size_t size);
+    void remember(heap_object* object);
+    void shade(heap_object* object);
+    void destroy(heap_object* object);
+    void collect_garbage();
+    void begin_cycle();
+    void incremental_step(long budget_us);
+    bool trace_incremental(long budget_us);
+    void finish_marking();
+    bool sweep_incremental(long budget_us);
+    void finish_cycle();
+    void mark_roots();
+    void trace_references();
+    void sweep();
+    void sweep_young();
+    void set_next_collection();
+    void record_pause(long pause_us);
+};
+
+// Keeps values alive while an engine holds them somewhere the collector can not see, like the left
+// operand of a binary expression while the right operand is still being evaluated.  Everything added
+// is released when the scope ends.
+class temporary_roots
+{
+public:
+    temporary_roots()
+        : _mark(memory_manager::instance().temporary_count()) { }
+
+    ~temporary_roots() { memory_manager::instance().truncate_temporaries(_mark); }
+
+    temporary_roots(const temporary_roots&) = delete;
+    temporary_roots& operator=(const temporary_roots&) = delete;
+
+    void add(const literal_value& value) { memory_manager::instance().push_temporary(value); }
+
 private:
-    std::unordered_set<cpplox_callable*> _callables;
-    std::unordered_set<cpplox_instance*> _instances;
-    std::unordered_set<environment*> _environments;
+    size_t _mark;
 };
 
 NAMESPACE_END
@@ -0,0 +1,78 @@
+#ifndef JUMI_CPPLOX_OPTIMIZER_H
+#define JUMI_CPPLOX_OPTIMIZER_H
+#include "typedefs.h"
+#include "arena_memory_pool.h"
+#include "expression_visitors.h"
+#include "statement_visitors.h"
+#include "statements.h"
+
+NAMESPACE_BEGIN(cpplox)
+
+// Rewrites the AST after the resolver has run and before either engine sees it.
+//
+// Operators whose operands are all literals are evaluated once here and replaced by a literal with the
+// result, along with the groupings around them.  An operation that would fail is left alone, so the
+// error is still raised when, and only if, the program reaches it.  Identities like x * 1 are reduced to
+// x when x can only be a number, since on anything else the operator would have raised a type error.
+//
+// Statements that can not run are removed: the rest of a block after a return, break or continue, the
+// branch an if with a constant condition never takes and loops whose condition is constantly false.
+// So are local variables and functions the resolver found were never read or assigned, unless their
+// initializer could fail or have an effect, in which case it is kept as an expression statement.
+class optimizer : public statement_visitor, expression_visitor<void>
+{
+public:
+    // New nodes are allocated from arena, which has to live as long as the statements
+    explicit optimizer(arena_memory_pool* arena);
+
+    void optimize_all(vector_t<unique_ptr_t<statement>>& statements);
+
+    virtual void visit_debug_statement(debug_statement& stmt) override;
+
+    virtual void visit_function_declaration_statement(function_declaration_statement& stmt) override;
+    virtual void visit_variable_declaration_statement(variable_declaration_statement& stmt) override;
+    virtual void visit_if_statement(if_statement& stmt) override;
+    virtual void visit_while_statement(while_statement& stmt) override;
+    virtual void visit_for_statement(for_statement& stmt) override;
+    virtual void visit_break_statement(break_statement& stmt) override;
+    virtual void visit_continue_statement(continue_statement& stmt) override;
+    virtual void visit_return_statement(return_statement& stmt) override;
+    virtual void visit_block_statement(block_statement& stmt) override;
+    virtual void visit_class_statement(class_statement& stmt) override;
+    virtual void visit_expression_statement(expression_statement& stmt) override;
+
+    virtual void visit_unary(unary_expression& expr) override;
+    virtual void visit_binary(binary_expression& expr) override;
+    virtual void visit_literal(literal_expression& expr) override;
+    virtual void visit_grouping(grouping_expression& expr) override;
+    virtual void visit_variable(variable_expression& expr) override;
+    virtual void visit_assignment(assignment_expression& expr) override;
+    virtual void visit_logical(logical_expression& expr) override;
+    virtual void visit_postfix(postfix_expression& expr) override;
+    virtual void visit_call(call_expression& expr) override;
+    virtual void visit_get(get_expression& expr) override;
+    virtual void visit_set(set_expression& expr) override;
+    virtual void visit_this(this_expression& expr) override;
+    virtual void visit_super(super_expression& expr) override;
+
+private:
+    arena_memory_pool* _arena;
+    // Set by a visit_ function to the node that takes the place of the one visited
+    unique_ptr_t<expression> _replacement;
+    unique_ptr_t<statement> _statement_replacement;
+    // Set by a visit_ function when the statement visited can be removed
+    bool _drop_statement;
+
+    void optimize(vector_t<unique_ptr_t<statement>>& statements);
+    // Leaves stmt empty if it was dropped
+    void optimize(unique_ptr_t<statement>& stmt);
+    // For the body of an if or a loop, which can not be left empty
+    void optimize_branch(unique_ptr_t<statement>& stmt);
+    void optimize(unique_ptr_t<expression>& expr);
+
+    void replace_with_literal(const literal_value& value);
+};
+
+NAMESPACE_END
+
+#endif
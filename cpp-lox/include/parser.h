@@ -1,6 +1,7 @@
 #ifndef JUMI_CPPLOX_PARSER_H
 #define JUMI_CPPLOX_PARSER_H
 #include "typedefs.h"
+#include "arena_memory_pool.h"
 #include "tokens.h"
 #include "exceptions.h"
 #include "statements.h"
@@ -13,60 +14,74 @@ NAMESPACE_BEGIN(cpplox)
 
 class expression;
 class console_io;
+class lexer;
 class parser
 {
 public:
-    parser(const std::vector<token>& lexer_tokens, console_io* io);
+    // Tokens are pulled from source as they are needed.  Nodes are allocated from arena, which has to
+    // outlive the statements returned by parse()
+    parser(lexer& source, console_io* io, arena_memory_pool* arena);
     virtual ~parser() = default;
-    virtual std::vector<std::unique_ptr<statement>> parse() = 0;
+    virtual vector_t<unique_ptr_t<statement>> parse() = 0;
+    // The next top-level declaration, or nullptr at the end of the input.  Declarations with syntax
+    // errors are reported and skipped over.
+    virtual unique_ptr_t<statement> next_declaration() = 0;
 
     bool error_occurred() const noexcept;
     void reset_error_flag() noexcept;
+    // Where the nodes of the declarations parsed from now on are allocated
+    void set_arena(arena_memory_pool* arena) noexcept;
+    // The first token of the next declaration, eof_ at the end of the input
+    token_type next_token_type() const noexcept;
 
 protected:
-    const std::vector<token>& _lexer_tokens;
-    uint32 _position;
+    lexer& _lexer;
+    // Both are empty before the first token and after eof has been consumed respectively
+    std::optional<token> _previous;
+    std::optional<token> _next;
     console_io* _io;
+    arena_memory_pool* _arena;
     bool _parser_error;
 };
 
 class recursive_descent_parser : public parser
 {
 public:
-    recursive_descent_parser(const std::vector<token>& lexer_tokens, console_io* io);
+    recursive_descent_parser(lexer& source, console_io* io, arena_memory_pool* arena);
     ~recursive_descent_parser() = default;
 
-    virtual std::vector<std::unique_ptr<statement>> parse() override;
+    virtual vector_t<unique_ptr_t<statement>> parse() override;
+    virtual unique_ptr_t<statement> next_declaration() override;
 
 private:
-    std::unique_ptr<statement> declaration_precedence();
-    std::unique_ptr<statement> create_function_declaration_statement(std::string& kind);
-    std::unique_ptr<statement> create_variable_declaration_statement();
-    std::unique_ptr<statement> create_class_declaration_statement();
-    std::unique_ptr<statement> statement_precedence();
-    std::unique_ptr<statement> create_if_statement();
-    std::unique_ptr<statement> create_while_statement();
-    std::unique_ptr<statement> create_for_statement();
-    std::unique_ptr<statement> create_break_statement();
-    std::unique_ptr<statement> create_continue_statement();
-    std::unique_ptr<statement> create_return_statement();
-    std::vector<std::unique_ptr<statement>> create_block_statement();
-    std::unique_ptr<statement> create_expression_statement();
+    unique_ptr_t<statement> declaration_precedence();
+    unique_ptr_t<statement> create_function_declaration_statement(std::string& kind);
+    unique_ptr_t<statement> create_variable_declaration_statement();
+    unique_ptr_t<statement> create_class_declaration_statement();
+    unique_ptr_t<statement> statement_precedence();
+    unique_ptr_t<statement> create_if_statement();
+    unique_ptr_t<statement> create_while_statement();
+    unique_ptr_t<statement> create_for_statement();
+    unique_ptr_t<statement> create_break_statement();
+    unique_ptr_t<statement> create_continue_statement();
+    unique_ptr_t<statement> create_return_statement();
+    vector_t<unique_ptr_t<statement>> create_block_statement();
+    unique_ptr_t<statement> create_expression_statement();
 
-    std::unique_ptr<expression> expression_precedence();
-    std::unique_ptr<expression> assignment_precedence();
-    std::unique_ptr<expression> logic_or_precedence();
-    std::unique_ptr<expression> logic_and_precedence();
-    std::unique_ptr<expression> equality_precedence();
-    std::unique_ptr<expression> comparison_precedence();
-    std::unique_ptr<expression> addition_precedence();
-    std::unique_ptr<expression> multiplication_precedence();
-    std::unique_ptr<expression> unary_precedence();
-    std::unique_ptr<expression> postfix_precedence();
-    std::unique_ptr<expression> call_precedence();
-    std::unique_ptr<expression> primary_precedence();
+    unique_ptr_t<expression> expression_precedence();
+    unique_ptr_t<expression> assignment_precedence();
+    unique_ptr_t<expression> logic_or_precedence();
+    unique_ptr_t<expression> logic_and_precedence();
+    unique_ptr_t<expression> equality_precedence();
+    unique_ptr_t<expression> comparison_precedence();
+    unique_ptr_t<expression> addition_precedence();
+    unique_ptr_t<expression> multiplication_precedence();
+    unique_ptr_t<expression> unary_precedence();
+    unique_ptr_t<expression> postfix_precedence();
+    unique_ptr_t<expression> call_precedence();
+    unique_ptr_t<expression> primary_precedence();
 
-    std::unique_ptr<expression> finish_call(std::unique_ptr<expression> expr);
+    unique_ptr_t<expression> finish_call(unique_ptr_t<expression> expr);
 
     std::optional<token> advance_parser();
     std::optional<token> previous_token() const;
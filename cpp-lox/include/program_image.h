@@ -0,0 +1,48 @@
+#ifndef JUMI_CPPLOX_PROGRAM_IMAGE_H
+#define JUMI_CPPLOX_PROGRAM_IMAGE_H
+#include "typedefs.h"
+#include "arena_memory_pool.h"
+#include "statements.h"
+#include <optional>
+#include <string>
+#include <string_view>
+
+NAMESPACE_BEGIN(cpplox)
+
+// A program as it comes out of the front end, parsed, resolved and optimized, stored in a file so that
+// the next run of the same source can skip lexing, parsing, resolving and optimizing it.
+//
+// The image is keyed by a hash of the source and the interpreter's version, anything else is stale.  It
+// is mapped into memory and the nodes are built straight from it into the arena, from a stream of
+// 32-bit words in the order the tree is walked.  Names are stored once and token positions relative to
+// the source, so the nodes point into the source the same way the lexer's tokens do.  A checksum over
+// the whole image catches corrupt files, which are then treated like stale ones.
+struct program_image
+{
+    vector_t<unique_ptr_t<statement>> statements;
+    // What the resolver warned about, printed again on every run
+    std::string warnings;
+};
+
+// The directory images go to unless another one is given: $CPPLOX_CACHE_DIR, or cpp-lox in the user's
+// cache directory, $XDG_CACHE_HOME or ~/.cache.  Empty when none of them is known.
+std::string default_image_cache_dir();
+
+// Where the image of the source at source_path goes in cache_dir, named after the source and a hash of its
+// absolute path so that sources of the same name don't share one.  Empty when the source has the
+// extension .loxc itself.
+std::string program_image_path(const std::string& source_path, const std::string& cache_dir);
+
+// Writes the image atomically, so that a run reading it at the same time sees either the old or the
+// new file.  source_offset is where the source starts in the source_manager.  Returns false if the image
+// could not be written, which is not an error; the next run goes through the front end again.
+bool write_program_image(const std::string& path, std::string_view source, uint32 source_offset,
+        const vector_t<unique_ptr_t<statement>>& statements, std::string_view warnings);
+
+// Adds source to the source_manager like the lexer would and builds its statements into arena, if the
+// image at path is one of this source.  Nothing if there is none or it is stale or corrupt.
+std::optional<program_image> load_program_image(const std::string& path, std::string_view source, arena_memory_pool* arena);
+
+NAMESPACE_END
+
+#endif
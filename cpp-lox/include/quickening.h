@@ -0,0 +1,71 @@
+#ifndef JUMI_CPPLOX_QUICKENING_H
+#define JUMI_CPPLOX_QUICKENING_H
+#include "typedefs.h"
+#include "cpplox_types.h"
+#include "tokens.h"
+#include <array>
+#include <iosfwd>
+
+NAMESPACE_BEGIN(cpplox)
+
+// What a binary operator node has made of itself after the first time it ran.  The typed forms only
+// check that the operands still have the types they had then before doing the operation directly.
+enum class binary_form : uint8
+{
+    // The number forms come right after uninitialized, so the tree-walker finds both with one comparison
+    uninitialized,
+    number_add,
+    number_subtract,
+    number_multiply,
+    number_divide,
+    number_modulo,
+    number_greater,
+    number_greater_equal,
+    number_less,
+    number_less_equal,
+    number_equal,
+    number_not_equal,
+    string_concatenate,
+    generic,
+    count,
+};
+
+enum class unary_form : uint8
+{
+    uninitialized,
+    number_negate,
+    bool_not,
+    generic,
+    count,
+};
+
+struct quickening_stats
+{
+    // Nodes that specialized themselves to a typed form
+    uint64 specialized = 0;
+    // Typed nodes whose guard failed, which went back to the generic form for good
+    uint64 deoptimized = 0;
+    // Nodes that saw operands no typed form covers the first time they ran
+    uint64 generic = 0;
+    std::array<uint64, static_cast<size_t>(binary_form::count)> binary_forms{};
+    std::array<uint64, static_cast<size_t>(unary_form::count)> unary_forms{};
+};
+
+// Type feedback for the tree-walker's operator nodes.  A node starts uninitialized, specializes itself
+// after the operand types it sees on its first run, and turns generic when its guard fails.  A generic
+// node stays generic, so a site that sees mixed types doesn't keep switching forms.
+class quickening
+{
+public:
+    static binary_form specialize(token_type oper, const literal_value& lhs, const literal_value& rhs) noexcept;
+    static unary_form specialize(token_type oper, const literal_value& rhs) noexcept;
+    static binary_form deoptimize(binary_form form) noexcept;
+    static unary_form deoptimize(unary_form form) noexcept;
+
+    static const quickening_stats& stats() noexcept;
+    static void print_stats(std::ostream& os);
+};
+
+NAMESPACE_END
+
+#endif
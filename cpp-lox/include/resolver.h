@@ -7,6 +7,7 @@
 #include "statements.h"
 #include "tokens.h"
 #include <memory>
+#include <string>
 #include <vector>
 #include <unordered_map>
 
@@ -35,6 +36,12 @@ struct variable_info
     bool defined = false;
     bool used = false;
     token declaration_token;
+    int slot = -1;
+    bool assigned = false;
+    // The declaring statement's flag, told at the end of the scope whether the name was read or assigned
+    bool* referenced = nullptr;
+    // False for a variable declared without an initializer, which is undefined until it is assigned
+    bool initialized = true;
 };
 
 class resolver : public statement_visitor, expression_visitor<void>
@@ -45,7 +52,9 @@ public:
     bool error_occurred() const noexcept;
     void reset_error_flag() noexcept;
 
-    void resolve_all(const std::vector<std::unique_ptr<statement>>& statements);
+    void resolve_all(const vector_t<unique_ptr_t<statement>>& statements);
+    // What the last resolve_all() warned about, which is printed as it is found as well
+    const std::string& warnings() const noexcept;
     virtual void visit_debug_statement(debug_statement& stmt) override;
 
     virtual void visit_function_declaration_statement(function_declaration_statement& stmt) override;
@@ -77,22 +86,26 @@ public:
 private:
     interpreter& _interpreter;
     console_io* _io;
-    std::vector<std::unordered_map<std::string, variable_info>> _scopes;
+    std::vector<string_map<variable_info>> _scopes;
 
     function_type _current_function_type;
     class_type _current_class_type;
+    // Loops enclosing the current statement inside the current function
+    int _loop_depth;
     bool _had_error;
+    std::string _warnings;
 
-    void resolve(const std::vector<std::unique_ptr<statement>>& statements);
-    void resolve(const std::unique_ptr<statement>& stmt);
-    void resolve(const std::unique_ptr<expression>& expr);
+    void resolve(const vector_t<unique_ptr_t<statement>>& statements);
+    void resolve(const unique_ptr_t<statement>& stmt);
+    void resolve(const unique_ptr_t<expression>& expr);
 
     void begin_scope();
     void end_scope();
 
-    void declare(const token& t);
+    int declare(const token& t, bool* referenced = nullptr);
     void define(const token& t);
-    void resolve_local(expression& expr, const token& t);
+    // The local the name refers to, nullptr for a global
+    variable_info* resolve_local(variable_slot& resolved, const token& t);
     void resolve_function(function_declaration_statement& expr, function_type type);
 };
 
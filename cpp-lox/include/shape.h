@@ -0,0 +1,45 @@
+#ifndef JUMI_CPPLOX_SHAPE_H
+#define JUMI_CPPLOX_SHAPE_H
+#include "typedefs.h"
+#include "symbol_table.h"
+#include <memory>
+
+NAMESPACE_BEGIN(cpplox)
+
+// A hidden class describing the layout of an instance's fields.  Every instance starts out with the
+// empty root shape, and adding a field moves it along the transition for that field name to a child
+// shape that appends one slot.  Instances that get the same fields in the same order end up sharing a
+// shape, so a field lookup only depends on the shape and the instance just stores a flat array of values.
+//
+// Shapes are never freed, they are owned by their parent and live as long as the program.
+class shape
+{
+public:
+    static shape* root();
+
+    shape(const shape&) = delete;
+    shape& operator=(const shape&) = delete;
+
+    [[nodiscard]] int field_count() const noexcept { return _field_count; }
+    // Slot of the given field, or -1 when instances of this shape don't have it
+    [[nodiscard]] int find(const symbol* name) const;
+    // The shape an instance of this shape moves to when the given field is added
+    [[nodiscard]] shape* add_field(const symbol* name);
+
+private:
+    // Above this many fields a lookup table replaces walking the parent chain
+    static constexpr int linear_search_limit = 8;
+
+    shape* _parent;
+    const symbol* _name;
+    int _field_count;
+    symbol_map<std::unique_ptr<shape>> _transitions;
+    shape* _last_transition;
+    mutable symbol_map<int> _lookup_table;
+
+    shape(shape* parent, const symbol* name);
+};
+
+NAMESPACE_END
+
+#endif
@@ -0,0 +1,65 @@
+#ifndef JUMI_CPPLOX_SOURCE_MANAGER_H
+#define JUMI_CPPLOX_SOURCE_MANAGER_H
+#include "typedefs.h"
+#include "cpplox_types.h"
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+NAMESPACE_BEGIN(cpplox)
+
+using coord = std::pair<uint32, uint32>;
+
+// Owns the text of every source lexed during the session, so that a token only has to store where its
+// lexeme is.  Sources are appended one after another and offsets are into the combined text.
+//
+// Literals of number and string tokens live in a side table, index 0 is the empty literal.  Line and
+// column of an offset are worked out from a table of line starts, which is only needed for errors.
+class source_manager
+{
+public:
+    static source_manager& instance();
+    source_manager();
+    source_manager(const source_manager&) = delete;
+    source_manager& operator=(const source_manager&) = delete;
+
+    // Appends a source and returns the offset of its first character
+    uint32 add_source(std::string_view text);
+    // Lines of the last source have to be added in order, its first line is added by add_source()
+    void add_line_start(uint32 offset);
+    uint32 add_literal(const literal_value& literal);
+
+    // Views are invalidated by the next add_source()
+    std::string_view text(uint32 offset, uint32 length) const noexcept
+    {
+        return std::string_view(_text.data() + offset, length);
+    }
+
+    const literal_value& literal(uint32 index) const noexcept { return _literals[index]; }
+
+    // Line and column, both starting at 1 and counted from the start of the offset's own source
+    coord position(uint32 offset) const;
+    std::string_view source_line(uint32 offset) const;
+
+private:
+    struct source
+    {
+        uint32 begin;
+        // Index of the source's first line in _line_starts
+        uint32 first_line;
+    };
+
+    std::string _text;
+    std::vector<source> _sources;
+    std::vector<uint32> _line_starts;
+    std::vector<literal_value> _literals;
+
+    const source& find_source(uint32 offset) const;
+    uint32 source_end(const source& s) const noexcept;
+    uint32 find_line(uint32 offset) const;
+};
+
+NAMESPACE_END
+
+#endif
@@ -1,6 +1,7 @@
 #ifndef JUMI_CPPLOX_STATEMENTS_H
 #define JUMI_CPPLOX_STATEMENTS_H
 #include "typedefs.h"
+#include "arena_memory_pool.h"
 #include "expressions.h"
 #include "tokens.h"
 #include <vector>
@@ -10,6 +11,7 @@ NAMESPACE_BEGIN(cpplox)
 
 class statement_visitor;
 class block_statement;
+struct jit_function;
 
 class statement
 {
@@ -41,11 +43,15 @@ class function_declaration_statement final : public statement
 {
 public:
     token ident_name;
-    std::vector<token> params;
-    std::vector<std::unique_ptr<statement>> body;
+    vector_t<token> params;
+    vector_t<unique_ptr_t<statement>> body;
     bool static_method;
+    int slot;   // Slot in the declaring scope's environment assigned by the resolver, -1 for globals
+    bool referenced;    // Cleared by the resolver when a local declaration is never read or assigned
+    uint32 hotness;     // Calls and loop iterations counted towards compiling it, see jit
+    jit_function* jit_code;
 
-    function_declaration_statement(const token& ident_name_, const std::vector<token>& params_, std::vector<std::unique_ptr<statement>>&& body_, bool static_method_ = false);
+    function_declaration_statement(const token& ident_name_, vector_t<token>&& params_, vector_t<unique_ptr_t<statement>>&& body_, bool static_method_ = false);
 
     virtual void accept_visitor(statement_visitor& v) override;
 };
@@ -54,9 +60,11 @@ class variable_declaration_statement final : public statement
 {
 public:
     token ident_name;
-    std::unique_ptr<expression> initializer_expr;
+    unique_ptr_t<expression> initializer_expr;
+    int slot;
+    bool referenced;
 
-    variable_declaration_statement(const token& ident_name_, std::unique_ptr<expression> initializer_expr_);
+    variable_declaration_statement(const token& ident_name_, unique_ptr_t<expression> initializer_expr_);
 
     virtual void accept_visitor(statement_visitor& v) override;
 };
@@ -64,11 +72,11 @@ public:
 class if_statement final : public statement
 {
 public:
-    std::unique_ptr<expression> condition;
-    std::unique_ptr<statement> if_branch;
-    std::unique_ptr<statement> else_branch;
+    unique_ptr_t<expression> condition;
+    unique_ptr_t<statement> if_branch;
+    unique_ptr_t<statement> else_branch;
 
-    if_statement(std::unique_ptr<expression> condition_, std::unique_ptr<statement> if_branch_, std::unique_ptr<statement> else_branch_);
+    if_statement(unique_ptr_t<expression> condition_, unique_ptr_t<statement> if_branch_, unique_ptr_t<statement> else_branch_);
 
     virtual void accept_visitor(statement_visitor& v) override;
 };
@@ -76,10 +84,10 @@ public:
 class while_statement final : public statement
 {
 public:
-    std::unique_ptr<expression> condition;
-    std::unique_ptr<statement> stmt_body;
+    unique_ptr_t<expression> condition;
+    unique_ptr_t<statement> stmt_body;
 
-    while_statement(std::unique_ptr<expression> condition_, std::unique_ptr<statement> stmt_body_);
+    while_statement(unique_ptr_t<expression> condition_, unique_ptr_t<statement> stmt_body_);
 
     virtual void accept_visitor(statement_visitor& v) override;
 };
@@ -87,14 +95,14 @@ public:
 class for_statement final : public statement
 {
 public:
-    std::unique_ptr<statement> initializer;
-    std::unique_ptr<expression> condition;
-    std::unique_ptr<expression> increment;
-    std::unique_ptr<statement> stmt_body;
+    unique_ptr_t<statement> initializer;
+    unique_ptr_t<expression> condition;
+    unique_ptr_t<expression> increment;
+    unique_ptr_t<statement> stmt_body;
     token for_token;
 
-    for_statement(std::unique_ptr<statement> initializer_, std::unique_ptr<expression> condition_,
-            std::unique_ptr<expression> increment_, std::unique_ptr<statement>&& stmt_body_, const token& for_token_);
+    for_statement(unique_ptr_t<statement> initializer_, unique_ptr_t<expression> condition_,
+            unique_ptr_t<expression> increment_, unique_ptr_t<statement>&& stmt_body_, const token& for_token_);
 
     virtual void accept_visitor(statement_visitor& v) override;
 };
@@ -123,9 +131,9 @@ class return_statement final : public statement
 {
 public:
     token keyword;
-    std::unique_ptr<expression> return_expr;
+    unique_ptr_t<expression> return_expr;
 
-    return_statement(const token& keyword_, std::unique_ptr<expression> return_expr_);
+    return_statement(const token& keyword_, unique_ptr_t<expression> return_expr_);
 
     virtual void accept_visitor(statement_visitor& v) override;
 };
@@ -133,9 +141,9 @@ public:
 class block_statement final : public statement
 {
 public:
-    std::vector<std::unique_ptr<statement>> statements;
+    vector_t<unique_ptr_t<statement>> statements;
 
-    block_statement(std::vector<std::unique_ptr<statement>>&& statements_);
+    block_statement(vector_t<unique_ptr_t<statement>>&& statements_);
 
     virtual void accept_visitor(statement_visitor& v) override;
 };
@@ -144,11 +152,12 @@ class class_statement final : public statement
 {
 public:
     token name;
-    std::vector<std::unique_ptr<function_declaration_statement>> methods;
-    std::unique_ptr<expression> superclass;
+    vector_t<unique_ptr_t<function_declaration_statement>> methods;
+    unique_ptr_t<expression> superclass;
+    int slot;
 
-    class_statement(const token& name_, std::vector<std::unique_ptr<function_declaration_statement>>&& methods_,
-            std::unique_ptr<expression> superclass_);
+    class_statement(const token& name_, vector_t<unique_ptr_t<function_declaration_statement>>&& methods_,
+            unique_ptr_t<expression> superclass_);
 
     virtual void accept_visitor(statement_visitor& v) override;
 };
@@ -156,13 +165,17 @@ public:
 class expression_statement final : public statement
 {
 public:
-    std::unique_ptr<expression> expr;
+    unique_ptr_t<expression> expr;
 
-    expression_statement(std::unique_ptr<expression> expr_);
+    expression_statement(unique_ptr_t<expression> expr_);
 
     virtual void accept_visitor(statement_visitor& v) override;
 };
 
+// Whether stmt or a statement nested in it declares a function or a class.  Functions and classes
+// created at runtime refer to their declarations, so such statements have to outlive their execution.
+bool declares_callable(statement& stmt);
+
 NAMESPACE_END
 
 #endif
@@ -0,0 +1,25 @@
+#ifndef JUMI_CPPLOX_STRING_MAP_H
+#define JUMI_CPPLOX_STRING_MAP_H
+#include "typedefs.h"
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+NAMESPACE_BEGIN(cpplox)
+
+// Lets maps keyed by std::string be searched with a lexeme without building a string first
+struct string_hash
+{
+    using is_transparent = void;
+
+    size_t operator()(std::string_view s) const noexcept { return std::hash<std::string_view>{}(s); }
+};
+
+template<typename T>
+using string_map = std::unordered_map<std::string, T, string_hash, std::equal_to<>>;
+
+NAMESPACE_END
+
+#endif
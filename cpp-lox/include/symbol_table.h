@@ -0,0 +1,59 @@
+#ifndef JUMI_CPPLOX_SYMBOL_TABLE_H
+#define JUMI_CPPLOX_SYMBOL_TABLE_H
+#include "typedefs.h"
+#include <cstddef>
+#include <deque>
+#include <iosfwd>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+NAMESPACE_BEGIN(cpplox)
+
+// An interned name.  There is exactly one symbol per distinct string for the whole run, so two symbols
+// are the same name exactly when they are the same object, and the hash is only worked out once.
+struct symbol
+{
+    std::string name;
+    size_t hash;
+    // Dense, starting at 0 in the order the names were first seen
+    uint32 id;
+};
+
+struct symbol_hash
+{
+    size_t operator()(const symbol* s) const noexcept { return s->hash; }
+};
+
+// Keyed by identity, a lookup is the stored hash and a pointer comparison
+template<typename T>
+using symbol_map = std::unordered_map<const symbol*, T, symbol_hash>;
+
+// Every identifier the lexer sees and every string literal is interned here.  Symbols are never freed.
+class symbol_table
+{
+public:
+    static symbol_table& instance();
+    symbol_table();
+    symbol_table(const symbol_table&) = delete;
+    symbol_table& operator=(const symbol_table&) = delete;
+
+    const symbol* intern(std::string_view name);
+    const symbol* at(uint32 id) const noexcept { return _by_id[id]; }
+
+    [[nodiscard]] size_t size() const noexcept;
+    void print_stats(std::ostream& os) const;
+
+private:
+    // A deque never moves its elements, which keeps the symbols and the views of their names valid
+    std::deque<symbol> _symbols;
+    std::vector<const symbol*> _by_id;
+    std::unordered_map<std::string_view, const symbol*> _lookup;
+    size_t _name_bytes;
+    uint64 _intern_calls;
+};
+
+NAMESPACE_END
+
+#endif
@@ -2,6 +2,9 @@
 #define JUMI_CPPLOX_TOKENS_H
 #include "typedefs.h"
 #include "cpplox_types.h"
+#include "source_manager.h"
+#include "string_map.h"
+#include "symbol_table.h"
 #include <iosfwd>
 #include <string>
 #include <string_view>
@@ -11,7 +14,7 @@ NAMESPACE_BEGIN(cpplox)
 
 struct token;
 
-enum class token_type
+enum class token_type : uint8
 {
     // single-character tokens
     left_paren_, right_paren_, left_brace_, right_brace_,
@@ -44,17 +47,30 @@ enum class token_type
     debug_
 };
 
-using coord = std::pair<uint32, uint32>;
-
+// Tokens don't own their text, the lexeme is a range of the source kept by the source_manager.  The
+// payload is an index into its literal table for numbers and strings, and the id of the interned name
+// for identifiers.  Position and source line are only looked up for errors.
 struct token
 {
     token_type type;
-    std::string lexeme;
-    literal_value literal;
-    coord position;
-    std::string_view source_line;
+    uint32 offset;
+    uint32 length;
+    uint32 payload;
+
+    std::string_view lexeme() const noexcept { return source_manager::instance().text(offset, length); }
+    const literal_value& literal() const noexcept { return source_manager::instance().literal(payload); }
+    // Other tokens, such as the keywords this and super, have their lexeme interned on demand
+    const symbol* name() const
+    {
+        symbol_table& symbols = symbol_table::instance();
+        return type == token_type::identifier_ ? symbols.at(payload) : symbols.intern(lexeme());
+    }
+    coord position() const { return source_manager::instance().position(offset); }
+    std::string_view source_line() const { return source_manager::instance().source_line(offset); }
 };
 
+static_assert(sizeof(token) == 16, "token should stay small enough to be copied around freely");
+
 extern const std::unordered_map<token_type, std::string> token_type_tostr;
 extern std::string debug_to_string(const token& t);
 extern token create_dummy_token(token_type type);
@@ -0,0 +1,131 @@
+#ifndef JUMI_CPPLOX_TRANSPILER_H
+#define JUMI_CPPLOX_TRANSPILER_H
+#include "typedefs.h"
+#include "expression_visitors.h"
+#include "inline_cache.h"
+#include "statement_visitors.h"
+#include "statements.h"
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+NAMESPACE_BEGIN(cpplox)
+
+// Translates a resolved and optimized program to a C++ translation unit that runs it on the aot_runtime,
+// for cpp-lox-aot.
+//
+// Each function declaration becomes a C++ function, and the top-level statements the body of one more.
+// The code does what the tree-walker would do for every node, in the same order and with the same errors:
+// variables live in the same environments, every statement starts at a safe point, and values that are
+// held across a call are rooted.  What is gone is the walk over the tree and the dispatch on node types,
+// and the operators only check for the types their number fast path needs.  Intermediate values are C++
+// locals, one for each expression.
+class transpiler : public statement_visitor, expression_visitor<std::string>
+{
+public:
+    // source is the program's text and source_offset where it starts in the source_manager, the program's
+    // tokens are offsets into it
+    transpiler(std::string_view source, uint32 source_offset, std::string_view source_name);
+
+    std::string transpile(vector_t<unique_ptr_t<statement>>& statements);
+
+    virtual void visit_debug_statement(debug_statement& stmt) override;
+
+    virtual void visit_function_declaration_statement(function_declaration_statement& stmt) override;
+    virtual void visit_variable_declaration_statement(variable_declaration_statement& stmt) override;
+    virtual void visit_if_statement(if_statement& stmt) override;
+    virtual void visit_while_statement(while_statement& stmt) override;
+    virtual void visit_for_statement(for_statement& stmt) override;
+    virtual void visit_break_statement(break_statement& stmt) override;
+    virtual void visit_continue_statement(continue_statement& stmt) override;
+    virtual void visit_return_statement(return_statement& stmt) override;
+    virtual void visit_block_statement(block_statement& stmt) override;
+    virtual void visit_class_statement(class_statement& stmt) override;
+    virtual void visit_expression_statement(expression_statement& stmt) override;
+
+    virtual std::string visit_unary(unary_expression& expr) override;
+    virtual std::string visit_binary(binary_expression& expr) override;
+    virtual std::string visit_literal(literal_expression& expr) override;
+    virtual std::string visit_grouping(grouping_expression& expr) override;
+    virtual std::string visit_variable(variable_expression& expr) override;
+    virtual std::string visit_assignment(assignment_expression& expr) override;
+    virtual std::string visit_logical(logical_expression& expr) override;
+    virtual std::string visit_postfix(postfix_expression& expr) override;
+    virtual std::string visit_call(call_expression& expr) override;
+    virtual std::string visit_get(get_expression& expr) override;
+    virtual std::string visit_set(set_expression& expr) override;
+    virtual std::string visit_this(this_expression& expr) override;
+    virtual std::string visit_super(super_expression& expr) override;
+
+private:
+    struct loop
+    {
+        // Label continue jumps to in a for loop, empty for a while loop
+        std::string continue_label;
+        bool continued = false;
+    };
+
+    // Code generated for the arguments of a call before it is emitted
+    struct deferred_arguments
+    {
+        std::vector<std::string> code;
+        std::vector<std::string> values;
+        // Calls in each argument
+        std::vector<size_t> calls;
+        size_t total_calls = 0;
+    };
+
+    std::string_view _source;
+    uint32 _source_offset;
+    std::string _source_name;
+
+    // Indices of the constants in the tables the generated code makes before it runs
+    std::unordered_map<uint64, size_t> _token_indices;
+    std::vector<std::string> _token_inits;
+    std::unordered_map<std::string, size_t> _string_indices;
+    std::vector<std::string> _string_inits;
+    std::vector<std::string> _cache_inits;
+
+    std::vector<std::string> _function_declarations;
+    std::vector<std::string> _function_definitions;
+
+    // Code of the function being generated
+    std::string* _out;
+    int _indent;
+    bool _in_initializer;
+    std::vector<loop> _loops;
+    int _next_name;
+    // Calls generated so far, to tell whether evaluating an expression can reach a safe point
+    size_t _calls;
+
+    // Emits the body of a C++ function for a declaration and returns its name
+    std::string function(function_declaration_statement& stmt, bool initializer);
+    void emit(statement& stmt);
+    std::string emit(expression& expr);
+    // Like emit() for an expression, but into a buffer of its own so the caller can put code before it
+    std::string emit_deferred(expression& expr, std::string& code);
+    // Evaluates the condition of an if or loop into a bool local
+    std::string condition(expression* expr);
+    std::string increment(const token& oper, expression& operand, bool prefix);
+    deferred_arguments defer_arguments(vector_t<unique_ptr_t<expression>>& arguments);
+    // Collects the arguments into a vector, rooting each one that is followed by a call in roots
+    std::string emit_arguments(const deferred_arguments& arguments, const std::string& roots);
+
+    void line(std::string_view text);
+    void open_block();
+    void close_block();
+    std::string new_name(std::string_view prefix);
+    // Declares a local holding the value of code
+    std::string temporary(const std::string& code);
+    // Uses a value nothing reads, such as that of an expression statement, so it isn't warned about
+    void discard(const std::string& value);
+
+    std::string token_ref(const token& t);
+    std::string string_ref(std::string_view text);
+    std::string cache_ref(property_site_kind kind, const token& name);
+};
+
+NAMESPACE_END
+
+#endif
@@ -0,0 +1,89 @@
+#ifndef JUMI_CPPLOX_VM_H
+#define JUMI_CPPLOX_VM_H
+#include "typedefs.h"
+#include "chunk.h"
+#include "cpplox_types.h"
+#include "exceptions.h"
+#include "memory_manager.h"
+#include "statements.h"
+#include "vm_types.h"
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+NAMESPACE_BEGIN(cpplox)
+
+class console_io;
+
+// Stack based virtual machine that executes the bytecode produced by the compiler.  It is an
+// alternative to the tree-walking interpreter and shares the runtime types (classes, instances,
+// native functions) and the operator semantics with it.  The value stack, the frames and the globals
+// are its root set for the garbage collector.
+class vm : public gc_root_source
+{
+    struct call_frame
+    {
+        vm_closure* closure;
+        const uint8* ip;
+        literal_value* slots;
+        // Set for the initializer call made by constructing an instance, which yields the instance
+        bool constructs;
+    };
+
+    struct global_variable
+    {
+        std::string name;
+        literal_value value;
+        bool defined;
+    };
+
+public:
+    // Deeper than the tree-walker gets before it runs out of native stack
+    static constexpr size_t max_frames = 1 << 16;
+    // The value stack starts out this many slots large and doubles whenever a call could run past its end
+    static constexpr size_t initial_stack_size = 1 << 14;
+
+    vm(console_io* io);
+    ~vm();
+    vm(const vm&) = delete;
+    vm& operator=(const vm&) = delete;
+
+    void interpret(const vector_t<unique_ptr_t<statement>>& statements);
+    // Set when a compile or runtime error stopped interpret()
+    bool error_occurred() const noexcept;
+    void reset_error_flag() noexcept;
+    uint16 global_slot(const std::string& name);
+    virtual void mark_roots(memory_manager& mm) override;
+
+private:
+    console_io* _io;
+    std::vector<literal_value> _stack;
+    literal_value* _stack_top;
+    std::vector<call_frame> _frames;
+    std::vector<global_variable> _globals;
+    std::unordered_map<std::string, uint16> _global_slots;
+    std::vector<std::unique_ptr<vm_function>> _scripts;
+    vm_upvalue* _open_upvalues;
+    bool _had_error;
+
+    void instantiate_standard_library();
+    void define_native(const std::string& name, cpplox_callable* native);
+
+    void run();
+    void reset_stack();
+    void push(const literal_value& value);
+    literal_value pop();
+    literal_value& peek(size_t distance);
+
+    void call_value(const literal_value& callee, int arg_count, const token& t);
+    void call_closure(vm_closure* closure, int arg_count, bool constructs = false);
+    void grow_stack();
+    void invoke(inline_cache& cache, int arg_count, const token& paren_token);
+    vm_upvalue* capture_upvalue(literal_value* local);
+    void close_upvalues(const literal_value* last);
+};
+
+NAMESPACE_END
+
+#endif
@@ -0,0 +1,67 @@
+#ifndef JUMI_CPPLOX_VM_TYPES_H
+#define JUMI_CPPLOX_VM_TYPES_H
+#include "typedefs.h"
+#include "chunk.h"
+#include "cpplox_types.h"
+#include <string>
+#include <vector>
+
+NAMESPACE_BEGIN(cpplox)
+
+// The compiled prototype of a function.  Prototypes are owned by the chunk of the enclosing function
+// (or by the vm for top level scripts), closures only ever point at them.
+class vm_function
+{
+public:
+    std::string name;
+    int arity;
+    int upvalue_count;
+    bool is_initializer;
+    chunk code;
+
+    vm_function(const std::string& name_, int arity_, bool is_initializer_ = false);
+};
+
+// A captured variable.  While the variable is still alive on the vm stack, location points at the
+// stack slot; once the slot goes out of scope the value is moved into closed and location is redirected.
+class vm_upvalue : public heap_object
+{
+public:
+    literal_value* location;
+    literal_value closed;
+    vm_upvalue* next;
+
+    vm_upvalue(literal_value* slot);
+    virtual void trace(memory_manager& mm) override;
+};
+
+class vm_closure : public cpplox_callable
+{
+public:
+    vm_function* function;
+    std::vector<vm_upvalue*> upvalues;
+
+    vm_closure(vm_function* function_);
+    virtual int arity() override;
+    virtual std::string to_string() const override;
+    virtual literal_value call(interpreter& i, const std::vector<literal_value>& args) override;
+    virtual cpplox_callable* bind(cpplox_instance* instance) override;
+    virtual void trace(memory_manager& mm) override;
+};
+
+class vm_bound_method : public cpplox_callable
+{
+public:
+    literal_value receiver;
+    vm_closure* method;
+
+    vm_bound_method(const literal_value& receiver_, vm_closure* method_);
+    virtual int arity() override;
+    virtual std::string to_string() const override;
+    virtual literal_value call(interpreter& i, const std::vector<literal_value>& args) override;
+    virtual void trace(memory_manager& mm) override;
+};
+
+NAMESPACE_END
+
+#endif
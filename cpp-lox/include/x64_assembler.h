@@ -0,0 +1,102 @@
+#ifndef JUMI_CPPLOX_X64_ASSEMBLER_H
+#define JUMI_CPPLOX_X64_ASSEMBLER_H
+#include "typedefs.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+NAMESPACE_BEGIN(cpplox)
+
+// General purpose registers, numbered by their encoding
+enum class x64_register : uint8
+{
+    rax, rcx, rdx, rbx, rsp, rbp, rsi, rdi,
+    r8, r9, r10, r11, r12, r13, r14, r15,
+};
+
+// Condition codes of jcc and setcc
+enum class x64_condition : uint8
+{
+    overflow      = 0x0,
+    equal         = 0x4,
+    not_equal     = 0x5,
+    less          = 0xc,
+    greater_equal = 0xd,
+    less_equal    = 0xe,
+    greater       = 0xf,
+};
+
+// A place in the code that jumps can refer to before it is bound
+struct x64_label
+{
+    std::ptrdiff_t position = -1;
+    // Offsets of the rel32 operands waiting for the label to be bound
+    std::vector<size_t> uses;
+};
+
+// Encodes the handful of 64 bit x86 instructions the jit needs into a byte buffer.  Memory operands
+// are always [base + disp32], jumps always take a 32 bit displacement.
+class x64_assembler
+{
+public:
+    using reg = x64_register;
+
+    const std::vector<uint8>& code() const noexcept { return _code; }
+    size_t size() const noexcept { return _code.size(); }
+
+    void mov(reg dst, reg src);
+    void mov(reg dst, uint64 imm);
+    // mov dst, [base + disp]
+    void load(reg dst, reg base, int32 disp);
+    // mov [base + disp], src
+    void store(reg base, int32 disp, reg src);
+    void lea(reg dst, reg base, int32 disp);
+    void push(reg r);
+    void pop(reg r);
+
+    void add(reg dst, reg src);
+    void sub(reg dst, reg src);
+    void and_(reg dst, reg src);
+    void or_(reg dst, reg src);
+    void xor_(reg dst, reg src);
+    void cmp(reg lhs, reg rhs);
+    void test(reg lhs, reg rhs);
+    void imul(reg dst, reg src);
+    void add(reg dst, int32 imm);
+    void sub(reg dst, int32 imm);
+    void shl(reg dst, uint8 count);
+    void shr(reg dst, uint8 count);
+    void sar(reg dst, uint8 count);
+    // Sets dst to 1 when the condition holds and 0 otherwise
+    void set(x64_condition cond, reg dst);
+
+    void call(reg target);
+    void jmp(x64_label& target);
+    void jcc(x64_condition cond, x64_label& target);
+    void bind(x64_label& label);
+    void leave();
+    void ret();
+
+    // Offset of the imm32 of the last add or sub with an immediate, for patching the frame size in later
+    size_t last_immediate() const noexcept { return _last_immediate; }
+    void patch_int32(size_t offset, int32 value);
+
+private:
+    std::vector<uint8> _code;
+    size_t _last_immediate = 0;
+
+    void emit(uint8 byte) { _code.push_back(byte); }
+    void emit_int32(int32 value);
+    void emit_uint64(uint64 value);
+    void rex_w(reg r, reg rm);
+    // register to register form of an instruction with a ModRM byte
+    void reg_reg(uint8 opcode, reg r, reg rm);
+    void memory(uint8 opcode, reg r, reg base, int32 disp);
+    void shift(uint8 extension, reg dst, uint8 count);
+    void immediate(uint8 extension, reg dst, int32 imm);
+    void label_operand(x64_label& target);
+};
+
+NAMESPACE_END
+
+#endif
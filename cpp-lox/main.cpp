@@ -1,14 +1,143 @@
 #include "cpplox_app.h"
+#include <charconv>
+#include <cmath>
+#include <iostream>
+#include <string>
+#include <string_view>
 
 namespace cpplox
 {
+    namespace
+    {
+        const char* usage = "Usage: cpp-lox [--engine=tree|vm] [--gc-stats] [--gc-threshold=<bytes>] [--gc-growth=<factor>] [--gc-nursery=<bytes>] [--gc-incremental] [--gc-pause-budget=<us>] [--ic-stats] [--quicken-stats] [--jit] [--jit-stats] [--symbol-stats] [--stream] [--dump-ast] [--no-cache] [--cache-dir=<dir>] [file]\n";
+
+        // Reads the value of an --option=<value> argument, which has to be a number and nothing else.  Unsigned
+        // values can't be negative.
+        template<typename T>
+        bool parse_option_value(const std::string& arg, T& value)
+        {
+            std::string_view text = std::string_view(arg).substr(arg.find('=') + 1);
+            const char* last = text.data() + text.size();
+            auto [end, ec] = std::from_chars(text.data(), last, value);
+            return !text.empty() && ec == std::errc() && end == last;
+        }
+    }
+
     int main([[maybe_unused]] int argc, [[maybe_unused]] char* argv[])
     {
-        cpplox_app app;
+        cpplox_options options;
+        const char* filepath = nullptr;
+
+        for (int i = 1; i < argc; ++i)
+        {
+            std::string arg = argv[i];
+
+            if (arg == "--engine=vm")
+            {
+                options.engine = execution_engine::vm;
+            }
+            else if (arg == "--engine=tree")
+            {
+                options.engine = execution_engine::tree_walker;
+            }
+            else if (arg == "--gc-stats")
+            {
+                options.gc_stats = true;
+            }
+            else if (arg == "--ic-stats")
+            {
+                options.ic_stats = true;
+            }
+            else if (arg == "--quicken-stats")
+            {
+                options.quicken_stats = true;
+            }
+            else if (arg == "--jit")
+            {
+                options.jit = true;
+            }
+            else if (arg == "--jit-stats")
+            {
+                options.jit = true;
+                options.jit_stats = true;
+            }
+            else if (arg == "--symbol-stats")
+            {
+                options.symbol_stats = true;
+            }
+            else if (arg == "--stream")
+            {
+                options.streaming = true;
+            }
+            else if (arg == "--dump-ast")
+            {
+                options.dump_ast = true;
+            }
+            else if (arg == "--no-cache")
+            {
+                options.image_cache = false;
+            }
+            else if (arg.rfind("--cache-dir=", 0) == 0)
+            {
+                options.cache_dir = arg.substr(arg.find('=') + 1);
+            }
+            else if (arg.rfind("--gc-threshold=", 0) == 0)
+            {
+                if (!parse_option_value(arg, options.gc.initial_threshold))
+                {
+                    std::cerr << "Invalid value in [" << arg << "], expected a number of bytes\n" << usage;
+                    return 1;
+                }
+            }
+            else if (arg.rfind("--gc-growth=", 0) == 0)
+            {
+                double growth = 0.0;
+                if (!parse_option_value(arg, growth) || !std::isfinite(growth) || growth <= 0.0)
+                {
+                    std::cerr << "Invalid value in [" << arg << "], expected a factor greater than 0\n" << usage;
+                    return 1;
+                }
+
+                options.gc.growth_factor = growth;
+            }
+            else if (arg.rfind("--gc-nursery=", 0) == 0)
+            {
+                if (!parse_option_value(arg, options.gc.nursery_size))
+                {
+                    std::cerr << "Invalid value in [" << arg << "], expected a number of bytes\n" << usage;
+                    return 1;
+                }
+            }
+            else if (arg == "--gc-incremental")
+            {
+                options.gc.incremental = true;
+            }
+            else if (arg.rfind("--gc-pause-budget=", 0) == 0)
+            {
+                options.gc.incremental = true;
+                if (!parse_option_value(arg, options.gc.pause_budget_us) || options.gc.pause_budget_us < 0)
+                {
+                    std::cerr << "Invalid value in [" << arg << "], expected a number of microseconds\n" << usage;
+                    return 1;
+                }
+            }
+            else if (arg.rfind("--", 0) == 0)
+            {
+                std::cerr << "Unknown option [" << arg << "]\n" << usage;
+                return 1;
+            }
+            else if (!filepath)
+            {
+                filepath = argv[i];
+            }
+        }
+
+        cpplox_app app(options);
 
-        if (argc >= 2)
+        if (filepath)
         {
-            app.run_file_mode(argv[1]);
+            app.run_file_mode(filepath);
+            return app.error_occurred() ? 1 : 0;
         }
         else
         {
@@ -0,0 +1,318 @@
+#include "aot_runtime.h"
+#include "console_io.h"
+#include "cpplox_types.h"
+#include "environment.h"
+#include "exceptions.h"
+#include "inline_cache.h"
+#include "memory_manager.h"
+#include "source_manager.h"
+#include "symbol_table.h"
+#include "tokens.h"
+#include "typedefs.h"
+#include <string>
+#include <string_view>
+#include <typeinfo>
+#include <variant>
+#include <vector>
+
+NAMESPACE_BEGIN(cpplox)
+
+aot_function::aot_function(aot_entry entry, const symbol* name, int arity, environment* closure_, bool static_method_,
+        cpplox_instance* receiver)
+    : closure(closure_)
+    , static_method(static_method_)
+    , _entry(entry)
+    , _name(name)
+    , _arity(arity)
+    , _receiver(receiver) { }
+
+int aot_function::arity() { return _arity; }
+std::string aot_function::to_string() const { return "<user fn>" + _name->name; }
+
+literal_value aot_function::call(interpreter& i, const std::vector<literal_value>& args)
+{
+    return invoke(_receiver, args);
+}
+
+literal_value aot_function::call_method(interpreter& i, cpplox_instance* receiver, const std::vector<literal_value>& args)
+{
+    return invoke(receiver, args);
+}
+
+cpplox_callable* aot_function::bind(cpplox_instance* instance)
+{
+    return memory_manager::instance().allocate<aot_function>(_entry, _name, _arity, closure, static_method, instance);
+}
+
+void aot_function::trace(memory_manager& mm)
+{
+    mm.mark(closure);
+    mm.mark(_receiver);
+}
+
+aot_runtime::aot_runtime(std::string_view source)
+    : _io()
+    , _env_manager()
+    , _source_offset(source_manager::instance().add_source(source))
+    , _caches()
+{
+    source_manager& sources = source_manager::instance();
+    for (size_t newline = source.find('\n'); newline != std::string_view::npos; newline = source.find('\n', newline + 1))
+        sources.add_line_start(_source_offset + static_cast<uint32>(newline + 1));
+
+    memory_manager& mm = memory_manager::instance();
+    symbol_table& symbols = symbol_table::instance();
+    environment* globals = _env_manager.get_global_environment();
+
+    globals->define(symbols.intern("clock"), mm.allocate<class clock>());
+    globals->define(symbols.intern("print"), mm.allocate<class print>(&_io));
+    globals->define(symbols.intern("input"), mm.allocate<class input>(&_io));
+}
+
+token aot_runtime::source_token(token_type type, uint32 offset, uint32 length) const
+{
+    token t{ type, _source_offset + offset, length, 0 };
+
+    if (type == token_type::identifier_)
+        t.payload = symbol_table::instance().intern(t.lexeme())->id;
+
+    return t;
+}
+
+inline_cache* aot_runtime::add_cache(property_site_kind kind, const token& name)
+{
+    return &_caches.emplace_back(kind, name);
+}
+
+int aot_runtime::run(void (*program)())
+{
+    try
+    {
+        program();
+    }
+    catch (const cpplox_runtime_error& e)
+    {
+        _io.err() << e.what() << '\n';
+        return 1;
+    }
+    catch (...)
+    {
+        _io.err() << "Exception swallower hit\n";
+        return 1;
+    }
+
+    return 0;
+}
+
+void aot_runtime::assign(const token& name, const variable_slot& resolved, const literal_value& value)
+{
+    if (resolved.is_local())
+        _env_manager.assign_at(resolved, value);
+    else
+        _env_manager.get_global_environment()->assign(name.name(), value);
+}
+
+void aot_runtime::define(const token& name, int slot, const literal_value& value)
+{
+    if (slot >= 0)
+        _env_manager.get_current_environment()->define_slot(slot, value);
+    else
+        _env_manager.get_current_environment()->define(name.name(), value);
+}
+
+cpplox_callable* aot_runtime::make_function(aot_entry entry, const token& name, int arity)
+{
+    return memory_manager::instance().allocate<aot_function>(entry, name.name(), arity, _env_manager.get_current_environment());
+}
+
+void aot_runtime::define_class(const token& name, int slot, const literal_value* superclass_value, std::initializer_list<aot_method> methods)
+{
+    cpplox_class* superclass = nullptr;
+
+    if (superclass_value && superclass_value->is_callable())
+    {
+        superclass = dynamic_cast<cpplox_class*>(superclass_value->as_callable());
+
+        if (!superclass)
+            throw cpplox_runtime_error("Could not superclass from attemped class, superclass specified was not a class", name);
+    }
+
+    define(name, slot, std::monostate{});
+
+    if (superclass_value)
+    {
+        _env_manager.push_environment();
+        _env_manager.get_current_environment()->define_slot(0, superclass);
+    }
+
+    memory_manager& mm = memory_manager::instance();
+    symbol_map<cpplox_callable*> class_methods;
+    for (const aot_method& method : methods)
+    {
+        const symbol* method_name = method.name.name();
+        class_methods[method_name] = mm.allocate<aot_function>(method.entry, method_name, method.arity,
+                _env_manager.get_current_environment(), method.static_method);
+    }
+
+    cpplox_callable* new_class = mm.allocate_class(std::string(name.lexeme()), std::move(class_methods), superclass);
+
+    // Like the tree-walker, the environment holding 'super' is only popped for a superclass that is a class
+    if (superclass)
+        _env_manager.pop_environment();
+
+    if (slot >= 0)
+        _env_manager.get_current_environment()->assign_slot(slot, new_class);
+    else
+        _env_manager.get_current_environment()->assign(name.name(), new_class);
+}
+
+literal_value aot_runtime::increment(const token& oper, const token& name, const variable_slot& resolved, bool prefix)
+{
+    literal_value value = lookup(name, resolved);
+
+    if (!value.is_number())
+        throw cpplox_type_error("Invalid type for postfix operator '" + std::string(oper.lexeme()) + "'", oper);
+
+    literal_value one = int64{ 1 };
+    literal_value new_value = oper.type == token_type::plus_plus_
+        ? add_numbers(value, one) : subtract_numbers(value, one);
+
+    assign(name, resolved, new_value);
+    return prefix ? new_value : value;
+}
+
+void aot_runtime::invalid_increment_operand(const token& oper, bool prefix) const
+{
+    std::string lexeme(oper.lexeme());
+
+    if (prefix)
+        throw cpplox_type_error("Unary prefix operator '" + lexeme + "' requires a variable operand", oper);
+
+    throw cpplox_type_error("Postfix operator '" + lexeme + "' requires a variable operand", oper);
+}
+
+literal_value aot_runtime::call(const token& paren, const literal_value& callee, const std::vector<literal_value>& args)
+{
+    if (!callee.is_callable())
+        throw cpplox_type_error("Cannot call '()' non-callable type", paren);
+
+    cpplox_callable* callable = callee.as_callable();
+    if (callable->arity() != static_cast<int>(args.size()))
+        throw cpplox_runtime_error("Expected " + std::to_string(callable->arity()) + " arguments but got " + std::to_string(args.size()));
+
+    // A callable of the program is one of its functions, a native or a class
+    if (typeid(*callable) == typeid(aot_function))
+    {
+        aot_function* function = static_cast<aot_function*>(callable);
+        return function->invoke(function->receiver(), args);
+    }
+
+    if (native_function* native = dynamic_cast<native_function*>(callable))
+        return native->call_native(args);
+
+    cpplox_class* class_ = static_cast<cpplox_class*>(callable);
+    cpplox_instance* instance = memory_manager::instance().allocate_instance(class_);
+
+    if (cpplox_callable* init = class_->initializer())
+        static_cast<aot_function*>(init)->invoke(instance, args);
+
+    return instance;
+}
+
+literal_value aot_runtime::call_method(cpplox_callable* method, cpplox_instance* receiver, const std::vector<literal_value>& args)
+{
+    if (method->arity() != static_cast<int>(args.size()))
+        throw cpplox_runtime_error("Expected " + std::to_string(method->arity()) + " arguments but got " + std::to_string(args.size()));
+
+    return static_cast<aot_function*>(method)->invoke(receiver, args);
+}
+
+literal_value aot_runtime::method_target(inline_cache& cache, const literal_value& object, cpplox_callable*& method)
+{
+    method = nullptr;
+
+    if (!object.is_instance())
+        return get_property(cache, object);
+
+    cpplox_instance* instance = object.as_instance();
+    const inline_cache_entry& entry = cache.lookup_get(instance);
+
+    // Fields shadow methods, in which case this is a plain call of the field value
+    if (entry.slot >= 0)
+        return instance->field_at(entry.slot);
+
+    method = entry.method;
+    return std::monostate{};
+}
+
+literal_value aot_runtime::get_property(inline_cache& cache, const literal_value& object)
+{
+    const token& name = cache.name();
+
+    if (object.is_instance())
+    {
+        cpplox_instance* instance = object.as_instance();
+        const inline_cache_entry& entry = cache.lookup_get(instance);
+
+        if (entry.slot >= 0)
+            return instance->field_at(entry.slot);
+
+        return entry.method->bind(instance);
+    }
+    else if (object.is_callable())
+    {
+        if (cpplox_class* class_ = dynamic_cast<cpplox_class*>(object.as_callable()))
+        {
+            cpplox_callable* static_method = class_->find_method(name);
+            if (!static_method)
+                throw cpplox_runtime_error("Static method with name '" + std::string(name.lexeme()) + "' doesn't exist; are you trying to access an instance method or property?");
+
+            return static_method;
+        }
+    }
+
+    throw cpplox_type_error("Only instances have properties", name);
+}
+
+cpplox_instance* aot_runtime::settable(const token& name, const literal_value& object) const
+{
+    if (!object.is_instance())
+        throw cpplox_type_error("Only instances have fields", name);
+
+    return object.as_instance();
+}
+
+void aot_runtime::set_property(inline_cache& cache, cpplox_instance* instance, const literal_value& value)
+{
+    const inline_cache_entry& entry = cache.lookup_set(instance);
+
+    if (entry.transition)
+        instance->add_field(entry.transition, value);
+    else
+        instance->set_field(entry.slot, value);
+}
+
+literal_value aot_runtime::super_method(const token& keyword, const token& method, const variable_slot& resolved)
+{
+    if (!resolved.is_local())
+        throw cpplox_runtime_error("Iterator distance_it in visit_super could not be resolved", keyword);
+
+    cpplox_class* superclass = _env_manager.get_at(resolved, create_dummy_token(token_type::super_)).as_class();
+
+    if (!superclass)
+        throw cpplox_runtime_error("Superclass could not be cast in visit_super", keyword);
+
+    // 'this' is always bound in the environment directly below the one holding 'super'
+    variable_slot this_slot{ resolved.depth - 1, 0 };
+    cpplox_instance* object = _env_manager.get_at(this_slot, create_dummy_token(token_type::this_)).as_instance();
+    if (!object)
+        throw cpplox_runtime_error("Object could not be cast to a cpplox_instance* in visit_super", keyword);
+
+    cpplox_callable* found = superclass->find_method(method.name());
+    if (!found)
+        throw cpplox_runtime_error("Undefined property '" + std::string(method.lexeme()) + "'.");
+
+    return found->bind(object);
+}
+
+NAMESPACE_END
@@ -1,50 +1,68 @@
 #include "arena_memory_pool.h"
 #include "typedefs.h"
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
+#include <memory_resource>
 #include <new>
 
 NAMESPACE_BEGIN(cpplox)
 
-arena_memory_pool::arena_memory_pool(std::size_t size)
-    : _size(size)
-    , _offset(0)
-{ 
-    _memory = ::operator new(size);
-}
+arena_memory_pool::arena_memory_pool(std::size_t block_size)
+    : _blocks()
+    , _current(nullptr)
+    , _end(nullptr)
+    , _block_size(block_size)
+    , _size(0)
+    , _used(0) { }
 
 arena_memory_pool::~arena_memory_pool()
 {
-    ::operator delete(_memory);
+    for (void* block : _blocks)
+        ::operator delete(block);
 }
 
-void* arena_memory_pool::allocate(std::size_t size, std::size_t alignment)
-{
-    const std::size_t header_size = sizeof(std::size_t);
+std::size_t arena_memory_pool::size() const noexcept { return _size; }
+std::size_t arena_memory_pool::used() const noexcept { return _used; }
 
-    std::size_t current_address = reinterpret_cast<std::size_t>(_memory) + _offset;
-    std::size_t adjustment = align_forward_adjustment(reinterpret_cast<void*>(current_address + header_size), alignment);
+void arena_memory_pool::add_block(std::size_t min_size)
+{
+    std::size_t size = std::max(_block_size, min_size);
+    void* block = ::operator new(size);
 
-    if (_offset + adjustment + size > _size)
-        throw std::bad_alloc();
+    _blocks.push_back(block);
+    _current = static_cast<std::byte*>(block);
+    _end = _current + size;
+    _size += size;
+}
 
-    _offset += adjustment;
+void* arena_memory_pool::do_allocate(std::size_t size, std::size_t alignment)
+{
+    std::uintptr_t address = reinterpret_cast<std::uintptr_t>(_current);
+    std::size_t adjustment = (alignment - (address & (alignment - 1))) & (alignment - 1);
 
-    std::size_t* header = reinterpret_cast<std::size_t*>(reinterpret_cast<unsigned char*>(_memory) + _offset);
-    *header = adjustment;
-    _offset += header_size;
+    if (!_current || static_cast<std::size_t>(_end - _current) < adjustment + size)
+    {
+        // The rest of the current block is abandoned, blocks from ::operator new are aligned for anything
+        add_block(size + alignment);
+        address = reinterpret_cast<std::uintptr_t>(_current);
+        adjustment = (alignment - (address & (alignment - 1))) & (alignment - 1);
+    }
 
-    void* aligned_address = reinterpret_cast<void*>(current_address + adjustment);
-    _offset += size;
-    return aligned_address;
+    void* memory = _current + adjustment;
+    _current += adjustment + size;
+    _used += adjustment + size;
+    return memory;
 }
 
-std::size_t arena_memory_pool::size() const noexcept { return _size; }
+void arena_memory_pool::do_deallocate([[maybe_unused]] void* ptr, [[maybe_unused]] std::size_t size, [[maybe_unused]] std::size_t alignment)
+{
+    // Released together with the pool
+}
 
-std::size_t arena_memory_pool::align_forward_adjustment(const void* address, std::size_t alignment)
+bool arena_memory_pool::do_is_equal(const std::pmr::memory_resource& other) const noexcept
 {
-    std::size_t addr = reinterpret_cast<std::size_t>(address);
-    std::size_t misalignment = addr & (alignment - 1);
-    return misalignment == 0 ? 0 : alignment - misalignment;
+    return this == &other;
 }
 
 NAMESPACE_END
@@ -0,0 +1,224 @@
+#include "ast_printer.h"
+#include "cpplox_types.h"
+#include "expressions.h"
+#include "statements.h"
+#include "tokens.h"
+#include "typedefs.h"
+#include <ostream>
+#include <string>
+
+NAMESPACE_BEGIN(cpplox)
+
+ast_printer::ast_printer(std::ostream& os)
+    : _os(os)
+    , _depth(0) { }
+
+void ast_printer::print_all(vector_t<unique_ptr_t<statement>>& statements)
+{
+    print(statements);
+}
+
+void ast_printer::print(vector_t<unique_ptr_t<statement>>& statements)
+{
+    for (unique_ptr_t<statement>& stmt : statements)
+    {
+        print(*stmt);
+    }
+}
+
+void ast_printer::print(statement& stmt)
+{
+    ++_depth;
+    stmt.accept_visitor(*this);
+    --_depth;
+}
+
+std::string ast_printer::print(expression& expr)
+{
+    return expr.accept_visitor(*this);
+}
+
+std::ostream& ast_printer::line()
+{
+    return _os << std::string(static_cast<size_t>(_depth - 1) * 2, ' ');
+}
+
+void ast_printer::visit_debug_statement(debug_statement& stmt)
+{
+    line() << "(debug)\n";
+}
+
+void ast_printer::visit_function_declaration_statement(function_declaration_statement& stmt)
+{
+    line() << (stmt.static_method ? "(static func " : "(func ") << stmt.ident_name.lexeme() << " (";
+
+    for (size_t i = 0; i < stmt.params.size(); ++i)
+    {
+        _os << (i > 0 ? " " : "") << stmt.params[i].lexeme();
+    }
+
+    _os << "))\n";
+    print(stmt.body);
+}
+
+void ast_printer::visit_variable_declaration_statement(variable_declaration_statement& stmt)
+{
+    line() << "(var " << stmt.ident_name.lexeme();
+
+    if (stmt.initializer_expr)
+        _os << ' ' << print(*stmt.initializer_expr);
+
+    _os << ")\n";
+}
+
+void ast_printer::visit_if_statement(if_statement& stmt)
+{
+    line() << "(if " << print(*stmt.condition) << ")\n";
+    print(*stmt.if_branch);
+
+    if (stmt.else_branch)
+    {
+        line() << "(else)\n";
+        print(*stmt.else_branch);
+    }
+}
+
+void ast_printer::visit_while_statement(while_statement& stmt)
+{
+    line() << "(while " << print(*stmt.condition) << ")\n";
+    print(*stmt.stmt_body);
+}
+
+void ast_printer::visit_for_statement(for_statement& stmt)
+{
+    line() << "(for " << (stmt.condition ? print(*stmt.condition) : "()") << ' '
+        << (stmt.increment ? print(*stmt.increment) : "()") << ")\n";
+
+    if (stmt.initializer)
+        print(*stmt.initializer);
+
+    print(*stmt.stmt_body);
+}
+
+void ast_printer::visit_break_statement(break_statement& stmt)
+{
+    line() << "(break)\n";
+}
+
+void ast_printer::visit_continue_statement(continue_statement& stmt)
+{
+    line() << "(continue)\n";
+}
+
+void ast_printer::visit_return_statement(return_statement& stmt)
+{
+    line() << "(return";
+
+    if (stmt.return_expr)
+        _os << ' ' << print(*stmt.return_expr);
+
+    _os << ")\n";
+}
+
+void ast_printer::visit_block_statement(block_statement& stmt)
+{
+    line() << "(block)\n";
+    print(stmt.statements);
+}
+
+void ast_printer::visit_class_statement(class_statement& stmt)
+{
+    line() << "(class " << stmt.name.lexeme();
+
+    if (stmt.superclass)
+        _os << " < " << print(*stmt.superclass);
+
+    _os << ")\n";
+
+    for (unique_ptr_t<function_declaration_statement>& method : stmt.methods)
+    {
+        print(*method);
+    }
+}
+
+void ast_printer::visit_expression_statement(expression_statement& stmt)
+{
+    line() << print(*stmt.expr) << '\n';
+}
+
+std::string ast_printer::visit_unary(unary_expression& expr)
+{
+    return "(" + std::string(expr.oper.lexeme()) + " " + print(*expr.expr_rhs) + ")";
+}
+
+std::string ast_printer::visit_binary(binary_expression& expr)
+{
+    return "(" + std::string(expr.oper.lexeme()) + " " + print(*expr.expr_lhs) + " " + print(*expr.expr_rhs) + ")";
+}
+
+std::string ast_printer::visit_literal(literal_expression& expr)
+{
+    if (expr.literal_val.is_string())
+        return "\"" + literal_value_to_runtime_string(expr.literal_val) + "\"";
+
+    return literal_value_to_runtime_string(expr.literal_val);
+}
+
+std::string ast_printer::visit_grouping(grouping_expression& expr)
+{
+    return "(group " + print(*expr.expr_group) + ")";
+}
+
+std::string ast_printer::visit_variable(variable_expression& expr)
+{
+    return std::string(expr.ident_name.lexeme());
+}
+
+std::string ast_printer::visit_assignment(assignment_expression& expr)
+{
+    return "(= " + std::string(expr.ident_name.lexeme()) + " " + print(*expr.initializer_expr) + ")";
+}
+
+std::string ast_printer::visit_logical(logical_expression& expr)
+{
+    return "(" + std::string(expr.oper.lexeme()) + " " + print(*expr.expr_lhs) + " " + print(*expr.expr_rhs) + ")";
+}
+
+std::string ast_printer::visit_postfix(postfix_expression& expr)
+{
+    return "(postfix" + std::string(expr.oper.lexeme()) + " " + print(*expr.expr_lhs) + ")";
+}
+
+std::string ast_printer::visit_call(call_expression& expr)
+{
+    std::string result = "(call " + print(*expr.callee);
+
+    for (unique_ptr_t<expression>& argument : expr.arguments)
+    {
+        result += " " + print(*argument);
+    }
+
+    return result + ")";
+}
+
+std::string ast_printer::visit_get(get_expression& expr)
+{
+    return "(. " + print(*expr.object) + " " + std::string(expr.name.lexeme()) + ")";
+}
+
+std::string ast_printer::visit_set(set_expression& expr)
+{
+    return "(.= " + print(*expr.object) + " " + std::string(expr.name.lexeme()) + " " + print(*expr.value) + ")";
+}
+
+std::string ast_printer::visit_this(this_expression& expr)
+{
+    return "this";
+}
+
+std::string ast_printer::visit_super(super_expression& expr)
+{
+    return "(super " + std::string(expr.method.lexeme()) + ")";
+}
+
+NAMESPACE_END
@@ -0,0 +1,189 @@
+#include "char_scan.h"
+#include "typedefs.h"
+#include <bit>
+#include <cstddef>
+
+#if defined(__AVX2__)
+    #define CPPLOX_CHAR_SCAN_AVX2
+    #define CPPLOX_CHAR_SCAN_SIMD
+    #include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define CPPLOX_CHAR_SCAN_SSE2
+    #define CPPLOX_CHAR_SCAN_SIMD
+    #include <emmintrin.h>
+#endif
+
+NAMESPACE_BEGIN(cpplox)
+
+namespace
+{
+#if defined(CPPLOX_CHAR_SCAN_AVX2)
+    using vec = __m256i;
+    constexpr std::ptrdiff_t width = 32;
+
+    vec load(const char* p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+    vec splat(char c) { return _mm256_set1_epi8(c); }
+    vec add(vec a, vec b) { return _mm256_add_epi8(a, b); }
+    vec either(vec a, vec b) { return _mm256_or_si256(a, b); }
+    vec equal(vec a, vec b) { return _mm256_cmpeq_epi8(a, b); }
+    vec less(vec a, vec b) { return _mm256_cmpgt_epi8(b, a); }
+    uint32 mask(vec v) { return static_cast<uint32>(_mm256_movemask_epi8(v)); }
+#elif defined(CPPLOX_CHAR_SCAN_SSE2)
+    using vec = __m128i;
+    constexpr std::ptrdiff_t width = 16;
+
+    vec load(const char* p) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); }
+    vec splat(char c) { return _mm_set1_epi8(c); }
+    vec add(vec a, vec b) { return _mm_add_epi8(a, b); }
+    vec either(vec a, vec b) { return _mm_or_si128(a, b); }
+    vec equal(vec a, vec b) { return _mm_cmpeq_epi8(a, b); }
+    vec less(vec a, vec b) { return _mm_cmplt_epi8(a, b); }
+    uint32 mask(vec v) { return static_cast<uint32>(_mm_movemask_epi8(v)); }
+#endif
+
+#if defined(CPPLOX_CHAR_SCAN_SIMD)
+    // Bytes in [lo, hi].  There are only signed byte comparisons, so the range is moved to start at
+    // -128 first and a single less-than does both ends.
+    vec in_range(vec v, char lo, char hi)
+    {
+        vec shifted = add(v, splat(static_cast<char>(-128 - lo)));
+        return less(shifted, splat(static_cast<char>(-128 + (hi - lo + 1))));
+    }
+
+    vec whitespace(vec v) { return either(equal(v, splat(' ')), in_range(v, '\t', '\r')); }
+    vec digits(vec v) { return in_range(v, '0', '9'); }
+
+    vec identifier_chars(vec v)
+    {
+        // Setting bit 5 turns upper case letters into lower case ones and leaves digits and '_' alone
+        vec letters = in_range(either(v, splat(0x20)), 'a', 'z');
+        return either(either(letters, digits(v)), equal(v, splat('_')));
+    }
+
+    // Runs over whole blocks until one has a byte that stop() marks, the rest goes to the scalar loop
+    template<typename Stop, typename Scalar>
+    const char* scan(const char* first, const char* last, Stop stop, Scalar scalar)
+    {
+        while (last - first >= width)
+        {
+            uint32 found = mask(stop(load(first)));
+            if (found)
+                return first + std::countr_zero(found);
+
+            first += width;
+        }
+
+        return scalar(first, last);
+    }
+#endif
+}
+
+const char* skip_whitespace(const char* first, const char* last) noexcept
+{
+#if defined(CPPLOX_CHAR_SCAN_SIMD)
+    // Most runs are a single space, those are done before loading a block
+    if (first == last || !is_whitespace(*first))
+        return first;
+
+    if (++first == last || !is_whitespace(*first))
+        return first;
+
+    return scan(first, last, [](vec v) { return equal(whitespace(v), splat(0)); }, scalar_skip_whitespace);
+#else
+    return scalar_skip_whitespace(first, last);
+#endif
+}
+
+const char* skip_identifier(const char* first, const char* last) noexcept
+{
+#if defined(CPPLOX_CHAR_SCAN_SIMD)
+    return scan(first, last, [](vec v) { return equal(identifier_chars(v), splat(0)); }, scalar_skip_identifier);
+#else
+    return scalar_skip_identifier(first, last);
+#endif
+}
+
+const char* skip_digits(const char* first, const char* last) noexcept
+{
+#if defined(CPPLOX_CHAR_SCAN_SIMD)
+    return scan(first, last, [](vec v) { return equal(digits(v), splat(0)); }, scalar_skip_digits);
+#else
+    return scalar_skip_digits(first, last);
+#endif
+}
+
+const char* find_char(const char* first, const char* last, char c) noexcept
+{
+#if defined(CPPLOX_CHAR_SCAN_SIMD)
+    vec target = splat(c);
+    return scan(first, last, [target](vec v) { return equal(v, target); },
+        [c](const char* f, const char* l) { return scalar_find_char(f, l, c); });
+#else
+    return scalar_find_char(first, last, c);
+#endif
+}
+
+const char* find_either(const char* first, const char* last, char a, char b) noexcept
+{
+#if defined(CPPLOX_CHAR_SCAN_SIMD)
+    vec target_a = splat(a);
+    vec target_b = splat(b);
+    return scan(first, last, [target_a, target_b](vec v) { return either(equal(v, target_a), equal(v, target_b)); },
+        [a, b](const char* f, const char* l) { return scalar_find_either(f, l, a, b); });
+#else
+    return scalar_find_either(first, last, a, b);
+#endif
+}
+
+const char* scalar_skip_whitespace(const char* first, const char* last) noexcept
+{
+    while (first != last && is_whitespace(*first))
+        ++first;
+
+    return first;
+}
+
+const char* scalar_skip_identifier(const char* first, const char* last) noexcept
+{
+    while (first != last && is_identifier_char(*first))
+        ++first;
+
+    return first;
+}
+
+const char* scalar_skip_digits(const char* first, const char* last) noexcept
+{
+    while (first != last && is_digit(*first))
+        ++first;
+
+    return first;
+}
+
+const char* scalar_find_char(const char* first, const char* last, char c) noexcept
+{
+    while (first != last && *first != c)
+        ++first;
+
+    return first;
+}
+
+const char* scalar_find_either(const char* first, const char* last, char a, char b) noexcept
+{
+    while (first != last && *first != a && *first != b)
+        ++first;
+
+    return first;
+}
+
+const char* char_scan_instruction_set() noexcept
+{
+#if defined(CPPLOX_CHAR_SCAN_AVX2)
+    return "avx2";
+#elif defined(CPPLOX_CHAR_SCAN_SSE2)
+    return "sse2";
+#else
+    return "scalar";
+#endif
+}
+
+NAMESPACE_END
@@ -0,0 +1,85 @@
+#include "chunk.h"
+#include "cpplox_types.h"
+#include "exceptions.h"
+#include "inline_cache.h"
+#include "tokens.h"
+#include "typedefs.h"
+#include "vm_types.h"
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+NAMESPACE_BEGIN(cpplox)
+
+chunk::chunk()
+    : code()
+    , token_indices()
+    , tokens()
+    , constants()
+    , identifiers()
+    , functions()
+    , caches() { }
+
+chunk::~chunk() = default;
+
+void chunk::write(uint8 byte, uint32 token_index)
+{
+    code.push_back(byte);
+    token_indices.push_back(token_index);
+}
+
+uint32 chunk::add_token(const token& t)
+{
+    tokens.push_back(t);
+    return static_cast<uint32>(tokens.size() - 1);
+}
+
+uint16 chunk::add_constant(const literal_value& value)
+{
+    if (constants.size() >= std::numeric_limits<uint16>::max())
+        throw cpplox_runtime_error("Too many constants in one function body");
+
+    constants.push_back(value);
+    return static_cast<uint16>(constants.size() - 1);
+}
+
+uint16 chunk::add_identifier(const symbol* name)
+{
+    for (size_t i = 0; i < identifiers.size(); ++i)
+    {
+        if (identifiers[i] == name)
+            return static_cast<uint16>(i);
+    }
+
+    if (identifiers.size() >= std::numeric_limits<uint16>::max())
+        throw cpplox_runtime_error("Too many identifiers in one function body");
+
+    identifiers.push_back(name);
+    return static_cast<uint16>(identifiers.size() - 1);
+}
+
+uint16 chunk::add_function(std::unique_ptr<vm_function> function)
+{
+    if (functions.size() >= std::numeric_limits<uint16>::max())
+        throw cpplox_runtime_error("Too many nested functions in one function body");
+
+    functions.push_back(std::move(function));
+    return static_cast<uint16>(functions.size() - 1);
+}
+
+uint16 chunk::add_cache(property_site_kind kind, const token& name)
+{
+    if (caches.size() >= std::numeric_limits<uint16>::max())
+        throw cpplox_runtime_error("Too many property accesses in one function body");
+
+    caches.push_back(std::make_unique<inline_cache>(kind, name));
+    return static_cast<uint16>(caches.size() - 1);
+}
+
+const token& chunk::token_at(size_t offset) const
+{
+    return tokens[token_indices[offset]];
+}
+
+NAMESPACE_END
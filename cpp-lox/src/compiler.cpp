@@ -0,0 +1,723 @@
+#include "compiler.h"
+#include "chunk.h"
+#include "debug_timer.h"
+#include "exceptions.h"
+#include "expressions.h"
+#include "resolver.h"
+#include "statements.h"
+#include "tokens.h"
+#include "typedefs.h"
+#include "vm.h"
+#include "vm_types.h"
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+NAMESPACE_BEGIN(cpplox)
+
+compiler::compiler(vm& machine)
+    : _vm(machine)
+    , _current(nullptr) { }
+
+std::unique_ptr<vm_function> compiler::compile(const vector_t<unique_ptr_t<statement>>& statements)
+{
+    debug_timer dt("compiler::compile()");
+
+    std::unique_ptr<vm_function> script = std::make_unique<vm_function>("script", 0);
+    function_state state{ nullptr, script.get(), function_type::none, {}, {}, {}, 0, 0 };
+    _current = &state;
+
+    state.token_index = current_chunk().add_token(create_dummy_token(token_type::bof_));
+    // Slot zero of every call frame holds the callee (or the receiver for methods)
+    state.locals.push_back(local{ "", 0, false });
+
+    for (const auto& stmt : statements)
+    {
+        compile(stmt);
+    }
+
+    emit_return();
+    _current = nullptr;
+
+    dt.stop();
+    return script;
+}
+
+void compiler::compile(const unique_ptr_t<statement>& stmt)
+{
+    stmt->accept_visitor(*this);
+}
+
+void compiler::compile(const unique_ptr_t<expression>& expr)
+{
+    expr->accept_visitor(*this);
+}
+
+void compiler::compile_function(function_declaration_statement& stmt, function_type type)
+{
+    std::unique_ptr<vm_function> function = std::make_unique<vm_function>(std::string(stmt.ident_name.lexeme()),
+            static_cast<int>(stmt.params.size()), type == function_type::initializer);
+
+    function_state state{ _current, function.get(), type, {}, {}, {}, 0, 0 };
+    _current = &state;
+    state.token_index = current_chunk().add_token(stmt.ident_name);
+
+    begin_scope();
+
+    bool has_receiver = type == function_type::method || type == function_type::initializer;
+    add_local(has_receiver ? "this" : "");
+
+    for (const token& param : stmt.params)
+    {
+        add_local(std::string(param.lexeme()));
+    }
+
+    for (const auto& s : stmt.body)
+    {
+        compile(s);
+    }
+
+    emit_return();
+
+    _current = state.enclosing;
+    function->upvalue_count = static_cast<int>(state.upvalues.size());
+
+    uint16 index = current_chunk().add_function(std::move(function));
+    emit(opcode::closure_);
+    emit_short(index);
+
+    for (const upvalue_ref& upvalue : state.upvalues)
+    {
+        emit_byte(upvalue.is_local ? 1 : 0);
+        emit_byte(upvalue.index);
+    }
+}
+
+void compiler::visit_debug_statement(debug_statement& stmt)
+{
+
+}
+
+void compiler::visit_function_declaration_statement(function_declaration_statement& stmt)
+{
+    declare_variable(stmt.ident_name);
+    compile_function(stmt, function_type::function);
+    define_variable(stmt.ident_name);
+}
+
+void compiler::visit_variable_declaration_statement(variable_declaration_statement& stmt)
+{
+    if (stmt.initializer_expr)
+        compile(stmt.initializer_expr);
+    else
+        emit(opcode::undefined_);
+
+    declare_variable(stmt.ident_name);
+    define_variable(stmt.ident_name);
+}
+
+void compiler::visit_if_statement(if_statement& stmt)
+{
+    compile(stmt.condition);
+
+    size_t then_jump = emit_jump(opcode::jump_if_false_);
+    emit(opcode::pop_);
+    compile(stmt.if_branch);
+
+    size_t else_jump = emit_jump(opcode::jump_);
+    patch_jump(then_jump);
+    emit(opcode::pop_);
+
+    if (stmt.else_branch)
+        compile(stmt.else_branch);
+
+    patch_jump(else_jump);
+}
+
+void compiler::visit_while_statement(while_statement& stmt)
+{
+    size_t loop_start = current_chunk().code.size();
+
+    compile(stmt.condition);
+    size_t exit_jump = emit_jump(opcode::jump_if_false_);
+    emit(opcode::pop_);
+
+    _current->loops.push_back(loop_state{ _current->scope_depth, loop_start, {} });
+    compile(stmt.stmt_body);
+    emit_loop(loop_start);
+
+    patch_jump(exit_jump);
+    emit(opcode::pop_);
+
+    for (size_t jump : _current->loops.back().break_jumps)
+        patch_jump(jump);
+
+    _current->loops.pop_back();
+}
+
+void compiler::visit_for_statement(for_statement& stmt)
+{
+    begin_scope();
+
+    if (stmt.initializer)
+        compile(stmt.initializer);
+
+    size_t loop_start = current_chunk().code.size();
+
+    compile(stmt.condition);
+    size_t exit_jump = emit_jump(opcode::jump_if_false_);
+    emit(opcode::pop_);
+
+    // The increment is emitted before the body so that continue always jumps backwards
+    if (stmt.increment)
+    {
+        size_t body_jump = emit_jump(opcode::jump_);
+        size_t increment_start = current_chunk().code.size();
+        compile(stmt.increment);
+        emit(opcode::pop_);
+        emit_loop(loop_start);
+        loop_start = increment_start;
+        patch_jump(body_jump);
+    }
+
+    _current->loops.push_back(loop_state{ _current->scope_depth, loop_start, {} });
+    compile(stmt.stmt_body);
+    emit_loop(loop_start);
+
+    patch_jump(exit_jump);
+    emit(opcode::pop_);
+
+    for (size_t jump : _current->loops.back().break_jumps)
+        patch_jump(jump);
+
+    _current->loops.pop_back();
+    end_scope();
+}
+
+void compiler::visit_break_statement(break_statement& stmt)
+{
+    if (_current->loops.empty())
+        throw error("Cannot use 'break' outside of a loop", stmt.break_token);
+
+    loop_state& loop = _current->loops.back();
+    emit_scope_exit(loop.scope_depth);
+    loop.break_jumps.push_back(emit_jump(opcode::jump_));
+}
+
+void compiler::visit_continue_statement(continue_statement& stmt)
+{
+    if (_current->loops.empty())
+        throw error("Cannot use 'continue' outside of a loop", stmt.continue_token);
+
+    const loop_state& loop = _current->loops.back();
+    emit_scope_exit(loop.scope_depth);
+    emit_loop(loop.continue_target);
+}
+
+void compiler::visit_return_statement(return_statement& stmt)
+{
+    set_token(stmt.keyword);
+
+    if (_current->type == function_type::initializer)
+    {
+        emit(opcode::get_local_);
+        emit_byte(0);
+    }
+    else if (stmt.return_expr)
+    {
+        compile(stmt.return_expr);
+    }
+    else
+    {
+        emit(opcode::null_);
+    }
+
+    emit(opcode::return_);
+}
+
+void compiler::visit_block_statement(block_statement& stmt)
+{
+    begin_scope();
+
+    for (const auto& s : stmt.statements)
+    {
+        compile(s);
+    }
+
+    end_scope();
+}
+
+void compiler::visit_class_statement(class_statement& stmt)
+{
+    set_token(stmt.name);
+    uint16 name_index = current_chunk().add_identifier(stmt.name.name());
+
+    declare_variable(stmt.name);
+    emit(opcode::class_);
+    emit_short(name_index);
+    define_variable(stmt.name);
+
+    if (stmt.superclass)
+    {
+        compile(stmt.superclass);
+
+        // The superclass value stays on the stack as a hidden local, methods capture it as 'super'
+        begin_scope();
+        add_local("super");
+
+        emit_get_variable(std::string(stmt.name.lexeme()));
+        set_token(stmt.name);
+        emit(opcode::inherit_);
+    }
+
+    emit_get_variable(std::string(stmt.name.lexeme()));
+
+    for (const unique_ptr_t<function_declaration_statement>& method : stmt.methods)
+    {
+        function_type type = method->static_method ? function_type::static_method : function_type::method;
+        if (method->ident_name.lexeme() == "init")
+            type = function_type::initializer;
+
+        compile_function(*method, type);
+        emit(opcode::method_);
+        emit_short(current_chunk().add_identifier(method->ident_name.name()));
+    }
+
+    emit(opcode::pop_);
+
+    if (stmt.superclass)
+        end_scope();
+}
+
+void compiler::visit_expression_statement(expression_statement& stmt)
+{
+    compile(stmt.expr);
+    emit(opcode::pop_);
+}
+
+void compiler::visit_unary(unary_expression& expr)
+{
+    if (expr.oper.type == token_type::plus_plus_ || expr.oper.type == token_type::minus_minus_)
+    {
+        emit_increment(*expr.expr_rhs, expr.oper, false);
+        return;
+    }
+
+    compile(expr.expr_rhs);
+    set_token(expr.oper);
+
+    switch (expr.oper.type)
+    {
+        case token_type::bang_:  emit(opcode::not_);    break;
+        case token_type::minus_: emit(opcode::negate_); break;
+        default:
+            throw error("Unknown unary operator", expr.oper);
+    }
+}
+
+void compiler::visit_binary(binary_expression& expr)
+{
+    compile(expr.expr_lhs);
+    compile(expr.expr_rhs);
+    set_token(expr.oper);
+
+    switch (expr.oper.type)
+    {
+        case token_type::plus_:          emit(opcode::add_);           break;
+        case token_type::minus_:         emit(opcode::subtract_);      break;
+        case token_type::star_:          emit(opcode::multiply_);      break;
+        case token_type::slash_:         emit(opcode::divide_);        break;
+        case token_type::modulo_:        emit(opcode::modulo_);        break;
+        case token_type::greater_:       emit(opcode::greater_);       break;
+        case token_type::greater_equal_: emit(opcode::greater_equal_); break;
+        case token_type::less_:          emit(opcode::less_);          break;
+        case token_type::less_equal_:    emit(opcode::less_equal_);    break;
+        case token_type::bang_equal_:    emit(opcode::not_equal_);     break;
+        case token_type::equal_equal_:   emit(opcode::equal_);         break;
+        default:
+            throw error("Unknown operator in handle_binary()", expr.oper);
+    }
+}
+
+void compiler::visit_literal(literal_expression& expr)
+{
+    switch (literal_to_cpplox_type(expr.literal_val))
+    {
+        case cpplox_type::null_:
+        {
+            emit(opcode::null_);
+        } break;
+        case cpplox_type::bool_:
+        {
+            emit(expr.literal_val.as_bool() ? opcode::true_ : opcode::false_);
+        } break;
+        default:
+        {
+            emit_constant(expr.literal_val);
+        } break;
+    }
+}
+
+void compiler::visit_grouping(grouping_expression& expr)
+{
+    compile(expr.expr_group);
+}
+
+void compiler::visit_variable(variable_expression& expr)
+{
+    set_token(expr.ident_name);
+    emit_get_variable(std::string(expr.ident_name.lexeme()));
+}
+
+void compiler::visit_assignment(assignment_expression& expr)
+{
+    compile(expr.initializer_expr);
+    set_token(expr.ident_name);
+    emit_set_variable(std::string(expr.ident_name.lexeme()));
+}
+
+void compiler::visit_logical(logical_expression& expr)
+{
+    compile(expr.expr_lhs);
+
+    if (expr.oper.type == token_type::or_)
+    {
+        size_t else_jump = emit_jump(opcode::jump_if_false_);
+        size_t end_jump = emit_jump(opcode::jump_);
+
+        patch_jump(else_jump);
+        emit(opcode::pop_);
+        compile(expr.expr_rhs);
+        patch_jump(end_jump);
+    }
+    else
+    {
+        size_t end_jump = emit_jump(opcode::jump_if_false_);
+        emit(opcode::pop_);
+        compile(expr.expr_rhs);
+        patch_jump(end_jump);
+    }
+}
+
+void compiler::visit_postfix(postfix_expression& expr)
+{
+    emit_increment(*expr.expr_lhs, expr.oper, true);
+}
+
+void compiler::visit_call(call_expression& expr)
+{
+    if (expr.arguments.size() > std::numeric_limits<uint8>::max())
+        throw error("Cannot have 255 or more arguments in a function call", expr.paren);
+
+    uint8 arg_count = static_cast<uint8>(expr.arguments.size());
+
+    // Method calls skip materializing a bound method.  The name token is attached to the opcode and
+    // the paren token to the argument count so both are available for error reporting.
+    if (get_expression* get_expr = dynamic_cast<get_expression*>(expr.callee.get()))
+    {
+        compile(get_expr->object);
+
+        for (const auto& arg : expr.arguments)
+            compile(arg);
+
+        set_token(get_expr->name);
+        emit(opcode::invoke_);
+        emit_short(current_chunk().add_cache(property_site_kind::invoke, get_expr->name));
+        set_token(expr.paren);
+        emit_byte(arg_count);
+        return;
+    }
+
+    compile(expr.callee);
+
+    for (const auto& arg : expr.arguments)
+        compile(arg);
+
+    set_token(expr.paren);
+    emit(opcode::call_);
+    emit_byte(arg_count);
+}
+
+void compiler::visit_get(get_expression& expr)
+{
+    compile(expr.object);
+    set_token(expr.name);
+    emit(opcode::get_property_);
+    emit_short(current_chunk().add_cache(property_site_kind::get, expr.name));
+}
+
+void compiler::visit_set(set_expression& expr)
+{
+    compile(expr.object);
+    compile(expr.value);
+    set_token(expr.name);
+    emit(opcode::set_property_);
+    emit_short(current_chunk().add_cache(property_site_kind::set, expr.name));
+}
+
+void compiler::visit_this(this_expression& expr)
+{
+    set_token(expr.keyword);
+    emit_get_variable("this");
+}
+
+void compiler::visit_super(super_expression& expr)
+{
+    set_token(expr.keyword);
+    emit_get_variable("this");
+    emit_get_variable("super");
+
+    set_token(expr.method);
+    emit(opcode::get_super_);
+    emit_short(current_chunk().add_identifier(expr.method.name()));
+}
+
+chunk& compiler::current_chunk() const
+{
+    return _current->function->code;
+}
+
+void compiler::set_token(const token& t)
+{
+    _current->token_index = current_chunk().add_token(t);
+}
+
+void compiler::emit(opcode op)
+{
+    emit_byte(static_cast<uint8>(op));
+}
+
+void compiler::emit_byte(uint8 byte)
+{
+    current_chunk().write(byte, _current->token_index);
+}
+
+void compiler::emit_short(uint16 value)
+{
+    emit_byte(static_cast<uint8>((value >> 8) & 0xff));
+    emit_byte(static_cast<uint8>(value & 0xff));
+}
+
+void compiler::emit_constant(const literal_value& value)
+{
+    uint16 index = current_chunk().add_constant(value);
+    emit(opcode::constant_);
+    emit_short(index);
+}
+
+void compiler::emit_return()
+{
+    // Like the other engines, calling an initializer directly gives back null when it runs off its end
+    emit(opcode::null_);
+    emit(opcode::return_);
+}
+
+void compiler::emit_loop(size_t loop_start)
+{
+    emit(opcode::loop_);
+
+    size_t offset = current_chunk().code.size() - loop_start + 2;
+    if (offset > std::numeric_limits<uint16>::max())
+        throw error("Loop body too large", current_chunk().tokens[_current->token_index]);
+
+    emit_short(static_cast<uint16>(offset));
+}
+
+size_t compiler::emit_jump(opcode op)
+{
+    emit(op);
+    emit_byte(0xff);
+    emit_byte(0xff);
+    return current_chunk().code.size() - 2;
+}
+
+void compiler::patch_jump(size_t offset)
+{
+    std::vector<uint8>& code = current_chunk().code;
+    size_t jump = code.size() - offset - 2;
+
+    if (jump > std::numeric_limits<uint16>::max())
+        throw error("Too much code to jump over", current_chunk().tokens[_current->token_index]);
+
+    code[offset] = static_cast<uint8>((jump >> 8) & 0xff);
+    code[offset + 1] = static_cast<uint8>(jump & 0xff);
+}
+
+void compiler::emit_scope_exit(int depth)
+{
+    // Used by break/continue, which leave every scope nested inside the loop without ending them
+    for (auto it = _current->locals.rbegin(); it != _current->locals.rend() && it->depth > depth; ++it)
+    {
+        emit(it->captured ? opcode::close_upvalue_ : opcode::pop_);
+    }
+}
+
+void compiler::begin_scope()
+{
+    ++_current->scope_depth;
+}
+
+void compiler::end_scope()
+{
+    --_current->scope_depth;
+
+    std::vector<local>& locals = _current->locals;
+    while (!locals.empty() && locals.back().depth > _current->scope_depth)
+    {
+        emit(locals.back().captured ? opcode::close_upvalue_ : opcode::pop_);
+        locals.pop_back();
+    }
+}
+
+void compiler::add_local(const std::string& name)
+{
+    if (_current->locals.size() > std::numeric_limits<uint8>::max())
+        throw error("Too many local variables in function", current_chunk().tokens[_current->token_index]);
+
+    _current->locals.push_back(local{ name, _current->scope_depth, false });
+}
+
+void compiler::declare_variable(const token& name)
+{
+    if (_current->scope_depth == 0)
+        return;
+
+    set_token(name);
+    add_local(std::string(name.lexeme()));
+}
+
+void compiler::define_variable(const token& name)
+{
+    if (_current->scope_depth > 0)
+        return;
+
+    set_token(name);
+    emit(opcode::define_global_);
+    emit_short(_vm.global_slot(std::string(name.lexeme())));
+}
+
+int compiler::resolve_local(function_state& state, const std::string& name)
+{
+    for (int i = static_cast<int>(state.locals.size()) - 1; i >= 0; --i)
+    {
+        if (state.locals[static_cast<size_t>(i)].name == name)
+            return i;
+    }
+
+    return -1;
+}
+
+int compiler::resolve_upvalue(function_state& state, const std::string& name)
+{
+    if (state.enclosing == nullptr)
+        return -1;
+
+    int local_index = resolve_local(*state.enclosing, name);
+    if (local_index != -1)
+    {
+        state.enclosing->locals[static_cast<size_t>(local_index)].captured = true;
+        return add_upvalue(state, static_cast<uint8>(local_index), true);
+    }
+
+    int upvalue_index = resolve_upvalue(*state.enclosing, name);
+    if (upvalue_index != -1)
+        return add_upvalue(state, static_cast<uint8>(upvalue_index), false);
+
+    return -1;
+}
+
+int compiler::add_upvalue(function_state& state, uint8 index, bool is_local)
+{
+    for (size_t i = 0; i < state.upvalues.size(); ++i)
+    {
+        if (state.upvalues[i].index == index && state.upvalues[i].is_local == is_local)
+            return static_cast<int>(i);
+    }
+
+    if (state.upvalues.size() > std::numeric_limits<uint8>::max())
+        throw error("Too many closure variables in function", current_chunk().tokens[_current->token_index]);
+
+    state.upvalues.push_back(upvalue_ref{ index, is_local });
+    return static_cast<int>(state.upvalues.size() - 1);
+}
+
+void compiler::emit_get_variable(const std::string& name)
+{
+    int index = resolve_local(*_current, name);
+    if (index != -1)
+    {
+        emit(opcode::get_local_);
+        emit_byte(static_cast<uint8>(index));
+        return;
+    }
+
+    index = resolve_upvalue(*_current, name);
+    if (index != -1)
+    {
+        emit(opcode::get_upvalue_);
+        emit_byte(static_cast<uint8>(index));
+        return;
+    }
+
+    emit(opcode::get_global_);
+    emit_short(_vm.global_slot(name));
+}
+
+void compiler::emit_set_variable(const std::string& name)
+{
+    int index = resolve_local(*_current, name);
+    if (index != -1)
+    {
+        emit(opcode::set_local_);
+        emit_byte(static_cast<uint8>(index));
+        return;
+    }
+
+    index = resolve_upvalue(*_current, name);
+    if (index != -1)
+    {
+        emit(opcode::set_upvalue_);
+        emit_byte(static_cast<uint8>(index));
+        return;
+    }
+
+    emit(opcode::set_global_);
+    emit_short(_vm.global_slot(name));
+}
+
+void compiler::emit_increment(expression& operand, const token& oper, bool postfix)
+{
+    variable_expression* var_expr = dynamic_cast<variable_expression*>(&operand);
+
+    // Reported when it runs, as the tree-walker does, so the statements before it still take effect
+    if (!var_expr)
+    {
+        set_token(oper);
+        emit(opcode::invalid_operand_);
+        emit_byte(postfix ? 1 : 0);
+        return;
+    }
+
+    set_token(var_expr->ident_name);
+    emit_get_variable(std::string(var_expr->ident_name.lexeme()));
+
+    set_token(oper);
+    if (oper.type == token_type::plus_plus_)
+        emit(postfix ? opcode::postfix_increment_ : opcode::increment_);
+    else
+        emit(postfix ? opcode::postfix_decrement_ : opcode::decrement_);
+
+    set_token(var_expr->ident_name);
+    emit_set_variable(std::string(var_expr->ident_name.lexeme()));
+
+    if (postfix)
+        emit(opcode::pop_);
+}
+
+cpplox_runtime_error compiler::error(const std::string& msg, const token& t) const
+{
+    return cpplox_runtime_error(msg, t);
+}
+
+NAMESPACE_END
@@ -1,28 +1,47 @@
 #include "cpplox_app.h"
+#include "ast_printer.h"
 #include "console_io.h"
 #include "debug_timer.h"
 #include "expression_visitors.h"
+#include "inline_cache.h"
 #include "interpreter.h"
 #include "logger.h"
 #include "lexer.h"
+#include "memory_manager.h"
+#include "optimizer.h"
 #include "parser.h"
+#include "program_image.h"
+#include "quickening.h"
 #include "typedefs.h"
 #include "statements.h"
+#include "symbol_table.h"
+#include "vm.h"
 #include <vector>
 #include <fstream>
 #include <memory>
-#include <sstream>
+#include <optional>
+#include <string>
 
 NAMESPACE_BEGIN(cpplox)
 
-cpplox_app::cpplox_app()
-    : _io(std::make_unique<console_io>())
+cpplox_app::cpplox_app(const cpplox_options& options)
+    : _options(options)
+    , _ast_arena()
+    , _io(std::make_unique<console_io>())
     , _interpreter(_io.get())
     , _resolver(_interpreter)
+    , _vm(options.engine == execution_engine::vm ? std::make_unique<vm>(_io.get()) : nullptr)
     , _statements()
+    , _retained_statements()
     , _had_runtime_error(false) 
 {
     _statements.reserve(128); 
+    memory_manager::instance().configure(options.gc);
+
+    if (options.jit)
+        _interpreter.enable_jit();
+    if (options.ic_stats)
+        inline_cache::enable_stats();
     CPPLOX_INFO("--------------------------------------------------");
     CPPLOX_INFO("Geo version " CPPLOX_VERSION " started running");
     CPPLOX_INFO("--------------------------------------------------");
@@ -30,6 +49,21 @@ cpplox_app::cpplox_app()
 
 cpplox_app::~cpplox_app()
 {
+    if (_options.gc_stats)
+        memory_manager::instance().print_stats(_io->err());
+
+    if (_options.ic_stats)
+        inline_cache::print_stats(_io->err());
+
+    if (_options.quicken_stats)
+        quickening::print_stats(_io->err());
+
+    if (_options.jit_stats)
+        _interpreter.print_jit_stats(_io->err());
+
+    if (_options.symbol_stats)
+        symbol_table::instance().print_stats(_io->err());
+
     CPPLOX_INFO("--------------------------------------------------");
     CPPLOX_INFO("Geo version " CPPLOX_VERSION " finished running");
     CPPLOX_INFO("--------------------------------------------------");
@@ -43,13 +77,29 @@ void cpplox_app::run_file_mode(const char* filepath)
     if (!file)
     {
         _io->err() << "File with path [" << filepath << "] could not be read\n";
+        _had_runtime_error = true;
+        return;
+    }
+
+    // Read straight into the string, a stringstream would hold two more copies of the file at its peak
+    file.seekg(0, std::ios::end);
+    std::string source(static_cast<size_t>(file.tellg()), '\0');
+    file.seekg(0, std::ios::beg);
+    file.read(source.data(), static_cast<std::streamsize>(source.size()));
+    source.resize(static_cast<size_t>(file.gcount()));
+
+    // Streaming runs each statement as it is parsed, there is never a whole program to keep
+    if (_options.streaming)
+    {
+        run_streaming(source);
         return;
     }
 
-    std::stringstream ss;
-    ss << file.rdbuf();
-    std::string source = ss.str();
-    run(source);
+    std::string cache_dir = _options.cache_dir.empty() ? default_image_cache_dir() : _options.cache_dir;
+    std::string image_path = _options.image_cache && !cache_dir.empty() ? program_image_path(filepath, cache_dir) : std::string();
+
+    if (image_path.empty() || !run_image(image_path, source))
+        run(source, image_path);
 }
 
 void cpplox_app::run_interpreter_mode()
@@ -72,20 +122,23 @@ void cpplox_app::run_interpreter_mode()
     }
 }
 
-void cpplox_app::run(const std::string& source)
+bool cpplox_app::error_occurred() const noexcept { return _had_runtime_error; }
+
+void cpplox_app::run(const std::string& source, const std::string& image_path)
 {
     // 1. Lexing Phase
     lexer l(source, _io.get());
 
     if (l.error_occurred())
+    {
+        _had_runtime_error = true;
         return;
-
-    const std::vector<token>& tokens = l.get_tokens();
+    }
 
     // 2. Parsing Phase
-    recursive_descent_parser parser(tokens, _io.get());
+    recursive_descent_parser parser(l, _io.get(), &_ast_arena);
 
-    std::vector<std::unique_ptr<statement>> statements = parser.parse();
+    vector_t<unique_ptr_t<statement>> statements = parser.parse();
 
     if (parser.error_occurred())
     {
@@ -102,8 +155,45 @@ void cpplox_app::run(const std::string& source)
         return;
     }
 
-    // 4. Interpreter
-    _interpreter.interpret(statements);
+    // 4. Optimization
+    optimize(statements, &_ast_arena);
+
+    // Before anything runs, the interpreter rewrites nodes as it goes
+    if (!image_path.empty())
+        write_program_image(image_path, source, l.source_offset(), statements, _resolver.warnings());
+
+    // 5. Execution
+    execute(std::move(statements));
+}
+
+bool cpplox_app::run_image(const std::string& image_path, const std::string& source)
+{
+    std::optional<program_image> image = load_program_image(image_path, source, &_ast_arena);
+
+    if (!image)
+        return false;
+
+    _io->err() << image->warnings;
+
+    if (_options.dump_ast)
+    {
+        ast_printer printer(_io->err());
+        printer.print_all(image->statements);
+    }
+
+    execute(std::move(image->statements));
+    return true;
+}
+
+void cpplox_app::execute(vector_t<unique_ptr_t<statement>>&& statements)
+{
+    if (_options.engine == execution_engine::vm)
+        _vm->interpret(statements);
+    else
+        _interpreter.interpret(statements);
+
+    if (_options.engine == execution_engine::vm ? _vm->error_occurred() : _interpreter.error_occurred())
+        _had_runtime_error = true;
 
     store_statements(std::move(statements));
 
@@ -114,7 +204,95 @@ void cpplox_app::run(const std::string& source)
     CPPLOX_TRACE("--------------------------------------------------");
 }
 
-void cpplox_app::store_statements(std::vector<std::unique_ptr<statement>>&& statements)
+void cpplox_app::run_streaming(const std::string& source)
+{
+    lexer l(source, _io.get(), lexer_mode::streaming);
+    recursive_descent_parser parser(l, _io.get(), nullptr);
+
+    // After the first error the rest of the file is still parsed to report its syntax errors, but
+    // nothing more is run
+    bool executing = true;
+
+    while (true)
+    {
+        // Top-level functions and classes are needed for the rest of the session and go into the
+        // session's arena.  Any other statement gets an arena of its own, freed once it has run.
+        token_type first = parser.next_token_type();
+        bool declaration = first == token_type::func_ || first == token_type::class_;
+        std::unique_ptr<arena_memory_pool> statement_arena;
+
+        if (declaration)
+        {
+            parser.set_arena(&_ast_arena);
+        }
+        else
+        {
+            statement_arena = std::make_unique<arena_memory_pool>(statement_arena_block_size);
+            parser.set_arena(statement_arena.get());
+        }
+
+        unique_ptr_t<statement> stmt = parser.next_declaration();
+        if (!stmt)
+            break;
+
+        if (l.error_occurred() || parser.error_occurred())
+            executing = false;
+
+        if (!executing)
+            continue;
+
+        vector_t<unique_ptr_t<statement>> statements;
+        statements.push_back(std::move(stmt));
+        executing = execute_statement(statements, declaration ? &_ast_arena : statement_arena.get());
+
+        // The vm is done with the AST once it has been compiled.  The tree-walker keeps referring to
+        // the declarations of functions and classes, which may also be nested in other statements,
+        // unless the optimizer removed the statement altogether.
+        if (_options.engine == execution_engine::vm || statements.empty())
+            continue;
+
+        if (declaration)
+            _statements.push_back(std::move(statements[0]));
+        else if (declares_callable(*statements[0]))
+            _retained_statements.push_back({ std::move(statement_arena), std::move(statements[0]) });
+    }
+
+    if (!executing || l.error_occurred() || parser.error_occurred())
+        _had_runtime_error = true;
+}
+
+bool cpplox_app::execute_statement(vector_t<unique_ptr_t<statement>>& statements, arena_memory_pool* arena)
+{
+    _resolver.resolve_all(statements);
+
+    if (_resolver.error_occurred())
+        return false;
+
+    optimize(statements, arena);
+
+    if (_options.engine == execution_engine::vm)
+    {
+        _vm->interpret(statements);
+        return !_vm->error_occurred();
+    }
+
+    _interpreter.interpret(statements);
+    return !_interpreter.error_occurred();
+}
+
+void cpplox_app::optimize(vector_t<unique_ptr_t<statement>>& statements, arena_memory_pool* arena)
+{
+    optimizer opt(arena);
+    opt.optimize_all(statements);
+
+    if (_options.dump_ast)
+    {
+        ast_printer printer(_io->err());
+        printer.print_all(statements);
+    }
+}
+
+void cpplox_app::store_statements(vector_t<unique_ptr_t<statement>>&& statements)
 {
     for (size_t i = 0; i < statements.size(); ++i)
     {
@@ -1,12 +1,16 @@
 #include "cpplox_types.h"
-#include "interpreter.h"
+#include "console_io.h"
+#include "exceptions.h"
 #include "typedefs.h"
 #include "memory_manager.h"
-#include "statements.h"
+#include "shape.h"
+#include <charconv>
+#include <cmath>
 #include <chrono>
 #include <string>
 #include <unordered_map>
 #include <variant>
+#include <vector>
 
 NAMESPACE_BEGIN(cpplox)
 
@@ -27,98 +31,340 @@ std::string cpplox_type_to_string(cpplox_type type)
     return "unknown";
 }
 
+cpplox_string::cpplox_string(std::string&& value)
+    : _value(std::move(value))
+    , _left(nullptr)
+    , _right(nullptr)
+    , _length(_value.size()) { }
+
+cpplox_string::cpplox_string(cpplox_string* left, cpplox_string* right)
+    : _value()
+    , _left(left)
+    , _right(right)
+    , _length(left->_length + right->_length) { }
+
+void cpplox_string::trace(memory_manager& mm)
+{
+    mm.mark(_left);
+    mm.mark(_right);
+}
+
+void cpplox_string::flatten() const
+{
+    std::string text;
+    text.reserve(_length);
+
+    // Ropes built in a loop are deep on one side, so the halves are walked with an explicit stack
+    std::vector<const cpplox_string*> pending{ this };
+    while (!pending.empty())
+    {
+        const cpplox_string* piece = pending.back();
+        pending.pop_back();
+
+        if (piece->_left)
+        {
+            pending.push_back(piece->_right);
+            pending.push_back(piece->_left);
+        }
+        else
+        {
+            text += piece->_value;
+        }
+    }
+
+    _value = std::move(text);
+    _left = nullptr;
+    _right = nullptr;
+    memory_manager::instance().charge(const_cast<cpplox_string*>(this), _value.capacity());
+}
+
+cpplox_type literal_value::type() const noexcept
+{
+    if (is_number())
+        return cpplox_type::number_;
+
+    switch (((_bits >> 61) & 4) | ((_bits >> 48) & 3))
+    {
+        case nan_boxing::null_tag:      return cpplox_type::null_;
+        case nan_boxing::bool_tag:      return cpplox_type::bool_;
+        case nan_boxing::undefined_tag: return cpplox_type::undefined_;
+        case nan_boxing::string_tag:    return cpplox_type::string_;
+        case nan_boxing::callable_tag:  return cpplox_type::callable_;
+        case nan_boxing::instance_tag:  return cpplox_type::instance_;
+        case nan_boxing::class_tag:     return cpplox_type::class_;
+    }
+
+    return cpplox_type::undefined_;
+}
+
+bool literal_value::operator==(const literal_value& rhs) const noexcept
+{
+    if (is_number() && rhs.is_number())
+        return as_number() == rhs.as_number();
+
+    if (is_string() && rhs.is_string())
+    {
+        const cpplox_string* lhs_string = as_string();
+        const cpplox_string* rhs_string = rhs.as_string();
+
+        if (lhs_string == rhs_string)
+            return true;
+
+        if (lhs_string->interned && rhs_string->interned)
+            return false;
+
+        if (lhs_string->length() != rhs_string->length())
+            return false;
+
+        return lhs_string->value() == rhs_string->value();
+    }
+
+    return _bits == rhs._bits;
+}
+
 cpplox_type literal_to_cpplox_type(const literal_value& l)
 {
-    return std::visit(
-        literal_value_overload{
-            [](double)                      { return cpplox_type::number_;    },
-            [](bool)                        { return cpplox_type::bool_;      },
-            [](const std::string&)          { return cpplox_type::string_;    },
-            [](const cpplox_callable*)         { return cpplox_type::callable_;  },
-            [](const cpplox_class*)            { return cpplox_type::class_;     },
-            [](const cpplox_instance*)         { return cpplox_type::instance_;  },
-            [](std::monostate)              { return cpplox_type::null_;      },
-            [](const undefined&)            { return cpplox_type::undefined_; },
-        }, l);
+    return l.type();
+}
+
+char* format_number(const literal_value& number, char* first, char* last) noexcept
+{
+    if (number.is_integer())
+        return std::to_chars(first, last, number.as_integer()).ptr;
+
+    // Whole doubles below 1e21 are written out in full like integers, the shortest form would turn
+    // 1000000 into 1e+06
+    double d = number.as_number();
+    if (std::trunc(d) == d && std::fabs(d) < 1e21)
+        return std::to_chars(first, last, d, std::chars_format::fixed).ptr;
+
+    return std::to_chars(first, last, d).ptr;
 }
 
 std::string literal_value_to_runtime_string(const literal_value& l)
 {
-    auto format_number = [](double d) -> std::string {
-        std::string s = std::to_string(d);
-        size_t i = s.find_last_not_of('0');
-        if (s[i] == '.')
-            return s.substr(0, i);
-
-        return s.substr(0, i + 1);
-    };
-
-    return std::visit(
-        literal_value_overload{
-            [&](double d)                      { return format_number(d);                               },
-            [&](bool b)                        { return b ? std::string("true") : std::string("false"); },
-            [&](const std::string& s)          { return s;                                              },
-            [&](const cpplox_callable* c)         { return c->to_string();                                 },
-            [&](const cpplox_class* c)            { return c->name;                                        },
-            [&](const cpplox_instance* i)         { return i->to_string();                                 },
-            [&](std::monostate)                { return std::string("null");                            },
-            [&](const undefined& u)            { return std::string("undefined");                       },
-        }, l);
-}
-
-user_function::user_function(function_declaration_statement& declaration_,
-        environment* closure_,
-        environment_manager* env_manager,
-        bool is_initializer)
-    : declaration(declaration_)
-    , closure(closure_)
-    , _env_manager(env_manager)
-    , _is_initializer(is_initializer) { }
-
-int user_function::arity() { return static_cast<int>(declaration.params.size()); }
-std::string user_function::to_string() const { return std::string("<user fn>" + declaration.ident_name.lexeme); }
-
-literal_value user_function::call(interpreter& i, const std::vector<literal_value>& args)
-{
-    _env_manager->push_environment(closure);
-    for (size_t i = 0; i < declaration.params.size(); ++i)
+    switch (l.type())
     {
-        _env_manager->get_current_environment()->define(declaration.params[i].lexeme, args[i]);
+        case cpplox_type::number_:
+        {
+            char buffer[number_buffer_size];
+            return std::string(buffer, format_number(l, buffer, buffer + number_buffer_size));
+        }
+        case cpplox_type::string_:     return l.as_string()->value();
+        case cpplox_type::bool_:       return l.as_bool() ? "true" : "false";
+        case cpplox_type::callable_:   return l.as_callable()->to_string();
+        case cpplox_type::class_:      return l.as_class()->name;
+        case cpplox_type::instance_:   return l.as_instance()->to_string();
+        case cpplox_type::null_:       return "null";
+        case cpplox_type::undefined_:  return "undefined";
     }
 
-    try
+    return "unknown";
+}
+
+bool is_truthy(const literal_value& literal)
+{
+    cpplox_type type = literal_to_cpplox_type(literal);
+
+    switch (type)
     {
-        i.execute_block(declaration.body, _env_manager->get_current_environment());
+        case cpplox_type::bool_:
+        {
+            return literal.as_bool();
+        } break;
+        case cpplox_type::number_:
+        {
+            return literal.as_number() != 0;
+        } break;
+        case cpplox_type::string_:
+        {
+            return literal.as_string()->length() != 0;
+        } break;
+        case cpplox_type::null_:
+        {
+            return false;
+        } break;
     }
-    catch (const interpreter::cpplox_function_return& ret)
+    throw cpplox_runtime_error("Unknown type in is_truthy()");
+}
+
+bool is_equal(const literal_value& lhs, const literal_value& rhs)
+{
+    cpplox_type lhs_type = literal_to_cpplox_type(lhs);
+    cpplox_type rhs_type = literal_to_cpplox_type(rhs);
+
+    if (lhs_type != rhs_type)
+    {
+        return false;
+    }
+
+    if ((lhs_type == cpplox_type::null_) && (rhs_type == cpplox_type::null_))
+        return true;
+    if (lhs_type == cpplox_type::null_)
+        return false;
+
+    return lhs == rhs;
+}
+
+literal_value apply_unary_operator(const token& oper, const literal_value& rhs)
+{
+    cpplox_type rhs_type = literal_to_cpplox_type(rhs);
+
+    if (oper.type == token_type::bang_)
+    {
+        if (rhs_type != cpplox_type::bool_)
+            throw cpplox_type_error("Cannot use unary operator ('!') on non-bool type", oper);
+
+        return !is_truthy(rhs);
+    }
+
+    if (oper.type == token_type::minus_)
+    {
+        if (rhs_type != cpplox_type::number_)
+            throw cpplox_type_error("Cannot use unary operator ('-') on non-number type", oper);
+
+        return negate_number(rhs);
+    }
+
+    throw cpplox_type_error("Unknown unary operator", oper);
+}
+
+literal_value apply_binary_operator(const token& oper, const literal_value& lhs, const literal_value& rhs)
+{
+    // Arithmetic and comparisons on two numbers are by far the most common, so they are done before the types are looked at
+    if (lhs.is_number() && rhs.is_number())
     {
-        _env_manager->pop_environment();
+        switch (oper.type)
+        {
+            case token_type::plus_:          return add_numbers(lhs, rhs);
+            case token_type::minus_:         return subtract_numbers(lhs, rhs);
+            case token_type::star_:          return multiply_numbers(lhs, rhs);
+            case token_type::slash_:         return divide_numbers(lhs, rhs);
+            case token_type::modulo_:
+            {
+                if (!modulo_defined(lhs, rhs))
+                    throw cpplox_runtime_error("Modulo by zero or by a number out of range", oper);
+
+                return modulo_numbers(lhs, rhs);
+            }
+            case token_type::greater_:       return greater_numbers(lhs, rhs);
+            case token_type::greater_equal_: return greater_equal_numbers(lhs, rhs);
+            case token_type::less_:          return less_numbers(lhs, rhs);
+            case token_type::less_equal_:    return less_equal_numbers(lhs, rhs);
+            case token_type::bang_equal_:    return !(lhs == rhs);
+            case token_type::equal_equal_:   return lhs == rhs;
+            default:
+                throw cpplox_type_error("Unknown operator in handle_binary()", oper);
+        }
+    }
+
+    cpplox_type lhs_type = literal_to_cpplox_type(lhs);
+    cpplox_type rhs_type = literal_to_cpplox_type(rhs);
 
-        if (_is_initializer)
+    if (lhs_type != rhs_type)
+    {
+        if (oper.type == token_type::plus_)
         {
-            token this_token = token{ token_type::identifier_, "this", "", { 0, 0 }, "" };
-            return closure->get(this_token);
+            if ((lhs_type == cpplox_type::string_ && rhs_type == cpplox_type::number_) ||
+                    (lhs_type == cpplox_type::number_ && rhs_type == cpplox_type::string_))
+            {
+                memory_manager& mm = memory_manager::instance();
+                if (lhs_type == cpplox_type::string_)
+                {
+                    return mm.concatenate(lhs.as_string(), mm.allocate_string(literal_value_to_runtime_string(rhs)));
+                }
+                else
+                {
+                    return mm.concatenate(mm.allocate_string(literal_value_to_runtime_string(lhs)), rhs.as_string());
+                }
+            }
         }
+        std::string msg = std::string("Cannot use binary operator '" + std::string(oper.lexeme()) + "' on types '" +
+                cpplox_type_to_string(lhs_type) + "' and '" + cpplox_type_to_string(rhs_type)) + "'";
+        throw cpplox_type_error(msg, oper);
+    }
 
-        return ret.return_val;
+    switch (oper.type)
+    {
+        case token_type::plus_:
+        {
+            if (lhs_type == cpplox_type::string_)
+            {
+                return memory_manager::instance().concatenate(lhs.as_string(), rhs.as_string());
+            }
+            else
+            {
+                throw cpplox_type_error("Unsupported type for binary operator '+'", oper);
+            }
+        } break;
+        case token_type::minus_:
+        {
+            throw cpplox_type_error("Unsupported type for binary operator '-'", oper);
+        } break;
+        case token_type::star_:
+        {
+            throw cpplox_type_error("Unsupported type for binary operator '*'", oper);
+        } break;
+        case token_type::slash_:
+        {
+            throw cpplox_type_error("Unsupported type for binary operator '/'", oper);
+        } break;
+        case token_type::modulo_:
+        {
+            throw cpplox_type_error("Unsupported type for binary operator '/'", oper);
+        } break;
+        case token_type::greater_:
+        {
+            throw cpplox_type_error("Unsupported type for binary operator '>'", oper);
+        } break;
+        case token_type::greater_equal_:
+        {
+            throw cpplox_type_error("Unsupported type for binary operator '>='", oper);
+        } break;
+        case token_type::less_:
+        {
+            throw cpplox_type_error("Unsupported type for binary operator '<'", oper);
+        } break;
+        case token_type::less_equal_:
+        {
+            throw cpplox_type_error("Unsupported type for binary operator '<='", oper);
+        } break;
+        case token_type::bang_equal_:
+        {
+            return !is_equal(lhs, rhs);
+        } break;
+        case token_type::equal_equal_:
+        {
+            return is_equal(lhs, rhs);
+        } break;
+        default:
+        {
+            throw cpplox_type_error("Unknown operator in handle_binary()", oper);
+        };
     }
+    throw cpplox_type_error("Unknown operator in handle_binary()", oper);
+}
 
-    _env_manager->pop_environment();
-    return std::monostate{};
+cpplox_callable* cpplox_callable::bind(cpplox_instance* instance)
+{
+    return this;
+}
+
+literal_value cpplox_callable::call_method(interpreter& i, cpplox_instance* receiver, const std::vector<literal_value>& args)
+{
+    return call(i, args);
 }
 
-cpplox_callable* user_function::bind(cpplox_instance* instance)
+literal_value native_function::call(interpreter& i, const std::vector<literal_value>& args)
 {
-    environment* new_env = memory_manager::instance().allocate_environment(closure);
-    new_env->define("this", instance);
-    return memory_manager::instance().allocate_user_function(declaration, new_env, _env_manager, _is_initializer);
+    return call_native(args);
 }
 
 clock::clock() {}
 int clock::arity() { return 0; }
 std::string clock::to_string() const { return "<native fn>clock"; }
 
-literal_value clock::call(interpreter& i, const std::vector<literal_value>& args)
+literal_value clock::call_native(const std::vector<literal_value>& args)
 {
     using namespace std::chrono;
     auto now = system_clock::now();
@@ -131,10 +377,22 @@ print::print(console_io* io) : _io(io) {}
 int print::arity() { return 1; }
 std::string print::to_string() const { return "<native fn>print"; }
 
-literal_value print::call(interpreter& i, const std::vector<literal_value>& args)
+literal_value print::call_native(const std::vector<literal_value>& args)
 {
     for (const auto& arg : args)
-        _io->out() << literal_value_to_runtime_string(arg) << '\n';
+    {
+        if (arg.is_number())
+        {
+            char buffer[number_buffer_size + 1];
+            char* end = format_number(arg, buffer, buffer + number_buffer_size);
+            *end++ = '\n';
+            _io->out().write(buffer, end - buffer);
+        }
+        else
+        {
+            _io->out() << literal_value_to_runtime_string(arg) << '\n';
+        }
+    }
 
     return std::monostate{};
 }
@@ -143,21 +401,26 @@ input::input(console_io* io) : _io(io) {}
 int input::arity() { return 0; }
 std::string input::to_string() const { return "<native fn>input"; }
 
-literal_value input::call(interpreter& i, const std::vector<literal_value>& args)
+literal_value input::call_native(const std::vector<literal_value>& args)
 {
     std::string value = _io->readline("");
-    return value;
+    return memory_manager::instance().allocate_string(std::move(value));
+}
+
+namespace
+{
+    uint64 next_class_id = 1;
 }
 
-cpplox_class::cpplox_class(const std::string& name_, std::unordered_map<std::string, cpplox_callable*>&& methods_
+cpplox_class::cpplox_class(const std::string& name_, symbol_map<cpplox_callable*>&& methods_
         , cpplox_class* superclass_)
-    : name(name_), methods(std::move(methods_)), superclass(superclass_) { }
+    : name(name_), methods(std::move(methods_)), superclass(superclass_), id(next_class_id++) { }
 
 int cpplox_class::arity() 
 { 
-    cpplox_callable* initializer = find_method("init");
-    if (initializer)
-        return initializer->arity();
+    cpplox_callable* init = initializer();
+    if (init)
+        return init->arity();
 
     return 0; 
 }
@@ -166,31 +429,36 @@ std::string cpplox_class::to_string() const { return "<class>" + name; }
 literal_value cpplox_class::call(interpreter& i, const std::vector<literal_value>& args)
 {
     cpplox_instance* instance = memory_manager::instance().allocate_instance(this);
-    cpplox_callable* initializer = find_method("init");
+    cpplox_callable* init = initializer();
 
-    if (initializer)
-    {
-        dynamic_cast<user_function*>(initializer)->bind(instance)->call(i, args);
-    }
+    if (init)
+        init->call_method(i, instance, args);
 
     return instance;
 }
 
+void cpplox_class::trace(memory_manager& mm)
+{
+    for (const auto& [name, method] : methods)
+        mm.mark(method);
+
+    mm.mark(superclass);
+}
+
 cpplox_callable* cpplox_class::find_method(const token& name)
 {
-    auto method_it = methods.find(name.lexeme);
-    if (method_it != methods.end())
-        return method_it->second;
+    const symbol* name_symbol = name.name();
 
-    if (superclass != nullptr)
+    for (cpplox_class* klass = this; klass != nullptr; klass = klass->superclass)
     {
-        return superclass->find_method(name);
+        if (cpplox_callable* method = klass->find_method(name_symbol))
+            return method;
     }
 
     return nullptr;
 }
 
-cpplox_callable* cpplox_class::find_method(const std::string& name)
+cpplox_callable* cpplox_class::find_method(const symbol* name)
 {
     auto method_it = methods.find(name);
     if (method_it != methods.end())
@@ -199,8 +467,17 @@ cpplox_callable* cpplox_class::find_method(const std::string& name)
     return nullptr;
 }
 
+cpplox_callable* cpplox_class::initializer()
+{
+    static const symbol* init = symbol_table::instance().intern("init");
+    return find_method(init);
+}
+
 cpplox_instance::cpplox_instance(cpplox_class* class_)
-    : _class(class_) { }
+    : _class(class_)
+    , _shape(shape::root())
+    , _inline_fields()
+    , _overflow_fields() { }
 
 std::string cpplox_instance::to_string() const
 {
@@ -209,23 +486,72 @@ std::string cpplox_instance::to_string() const
 
 literal_value cpplox_instance::get(const token& name)
 {
-    auto field_it = _fields.find(name.lexeme);
-    if (field_it != _fields.end())
-        return field_it->second;
+    int index = _shape->find(name.name());
+    if (index >= 0)
+        return field_at(index);
 
     cpplox_callable* method = _class->find_method(name);
     if (method)
-    {
-        user_function* user_method = dynamic_cast<user_function*>(method);
-        return user_method->bind(this);
-    }
+        return method->bind(this);
 
-    throw cpplox_runtime_error("Undefined property or method '" + name.lexeme + "'", name);
+    throw cpplox_runtime_error("Undefined property or method '" + std::string(name.lexeme()) + "'", name);
 }
 
 void cpplox_instance::set(const token& name, const literal_value& value)
 {
-    _fields[name.lexeme] = value;
+    const symbol* field = name.name();
+    int index = _shape->find(field);
+
+    if (index >= 0)
+        set_field(index, value);
+    else
+        add_field(_shape->add_field(field), value);
+}
+
+cpplox_class* cpplox_instance::get_class() const noexcept
+{
+    return _class;
+}
+
+void cpplox_instance::trace(memory_manager& mm)
+{
+    mm.mark(_class);
+
+    for (int i = 0; i < _shape->field_count(); ++i)
+        mm.mark(field_at(i));
+}
+
+void cpplox_instance::set_field(int index, const literal_value& value)
+{
+    field_slot(index) = value;
+    memory_manager::write_barrier(this, value);
+}
+
+void cpplox_instance::add_field(shape* next, const literal_value& value)
+{
+    int index = _shape->field_count();
+    _shape = next;
+
+    if (index >= inline_field_count)
+        _overflow_fields.emplace_back();
+
+    set_field(index, value);
+}
+
+literal_value& cpplox_instance::field_slot(int index)
+{
+    if (index < inline_field_count)
+        return _inline_fields[index];
+
+    return _overflow_fields[static_cast<size_t>(index - inline_field_count)];
+}
+
+const literal_value& cpplox_instance::field_at(int index) const
+{
+    if (index < inline_field_count)
+        return _inline_fields[index];
+
+    return _overflow_fields[static_cast<size_t>(index - inline_field_count)];
 }
 
 NAMESPACE_END
@@ -9,24 +9,29 @@ NAMESPACE_BEGIN(cpplox)
 
 environment::environment(environment* parent_scope)
     : _variables()
+    , _slots()
     , _parent_scope(parent_scope) { }
 
-void environment::define(const std::string& name, const literal_value& value)
+void environment::define(const symbol* name, const literal_value& value)
 {
-    auto find = _variables.find(name);
-    if (find != _variables.end())
+    if (find(name))
     {
-        throw cpplox_runtime_error("Variable '" + name + "' already defined, did you mean to reassign it?");
+        throw cpplox_runtime_error("Variable '" + name->name + "' already defined, did you mean to reassign it?");
     }
-    _variables[name] = value;
+
+    if (name->id >= _variables.size())
+        _variables.resize(static_cast<size_t>(name->id) + 1);
+
+    _variables[name->id] = named_variable{ value, true };
+    memory_manager::write_barrier(this, value);
 }
 
-void environment::assign(const std::string& name, const literal_value& value)
+void environment::assign(const symbol* name, const literal_value& value)
 {
-    auto find = _variables.find(name);
-    if (find != _variables.end())
+    if (named_variable* variable = find(name))
     {
-        _variables[name] = value;
+        variable->value = value;
+        memory_manager::write_barrier(this, value);
         return;
     }
     else
@@ -38,20 +43,19 @@ void environment::assign(const std::string& name, const literal_value& value)
         }
     }
 
-    throw cpplox_runtime_error("Undefined variable '" + name + "' can not be assigned to");
+    throw cpplox_runtime_error("Undefined variable '" + name->name + "' can not be assigned to");
 }
 
 literal_value environment::get(const token& name) const
 {
     // Check for the variable name in the local lexical scope first
-    auto it = _variables.find(name.lexeme);
-    if (it != _variables.end())
+    if (const named_variable* variable = find(name.name()))
     {
-        cpplox_type type = literal_to_cpplox_type(it->second);
+        cpplox_type type = literal_to_cpplox_type(variable->value);
         if (type == cpplox_type::undefined_)
-            throw cpplox_runtime_error("Variable '" + name.lexeme + "' is undefined", name);
+            throw cpplox_runtime_error("Variable '" + std::string(name.lexeme()) + "' is undefined", name);
 
-        return it->second;
+        return variable->value;
     }
     else
     {
@@ -61,13 +65,82 @@ literal_value environment::get(const token& name) const
     }
 
     // When no scopes have the variable, we found a runtime error
-    throw cpplox_runtime_error("Undefined variable '" + name.lexeme + "'", name);
+    throw cpplox_runtime_error("Undefined variable '" + std::string(name.lexeme()) + "'", name);
+}
+
+literal_value environment::lookup(const symbol* name) const noexcept
+{
+    const named_variable* variable = find(name);
+    return variable ? variable->value : literal_value(undefined{});
+}
+
+void environment::define_slot(int slot, const literal_value& value)
+{
+    size_t index = static_cast<size_t>(slot);
+
+    // Slots are defined in declaration order, so the array only ever grows by one here
+    if (index >= _slots.size())
+        _slots.resize(index + 1, undefined{});
+
+    _slots[index] = value;
+    memory_manager::write_barrier(this, value);
+}
+
+void environment::assign_slot(int slot, const literal_value& value)
+{
+    size_t index = static_cast<size_t>(slot);
+
+    if (index >= _slots.size())
+        _slots.resize(index + 1, undefined{});
+
+    _slots[index] = value;
+    memory_manager::write_barrier(this, value);
+}
+
+literal_value environment::get_slot(int slot, const token& name) const
+{
+    size_t index = static_cast<size_t>(slot);
+
+    if (index >= _slots.size() || _slots[index].is_undefined())
+        throw cpplox_runtime_error("Variable '" + std::string(name.lexeme()) + "' is undefined", name);
+
+    return _slots[index];
+}
+
+void environment::trace(memory_manager& mm)
+{
+    for (const named_variable& variable : _variables)
+        mm.mark(variable.value);
+
+    for (const literal_value& value : _slots)
+        mm.mark(value);
+
+    mm.mark(_parent_scope);
+}
+
+environment::named_variable* environment::find(const symbol* name)
+{
+    if (name->id >= _variables.size() || !_variables[name->id].defined)
+        return nullptr;
+
+    return &_variables[name->id];
+}
+
+const environment::named_variable* environment::find(const symbol* name) const
+{
+    return const_cast<environment*>(this)->find(name);
 }
 
 environment_manager::environment_manager()
     : _environments()
 {
     _environments.emplace_back(memory_manager::instance().allocate_environment());
+    memory_manager::instance().add_root_source(this);
+}
+
+environment_manager::~environment_manager()
+{
+    memory_manager::instance().remove_root_source(this);
 }
 
 environment* environment_manager::get_global_environment() const noexcept
@@ -98,19 +171,19 @@ void environment_manager::pop_environment()
     _environments.pop_back();
 }
 
-void environment_manager::define(const std::string& name, const literal_value& value)
+void environment_manager::define(const symbol* name, const literal_value& value)
 {
     _environments.back()->define(name, value);
 }
 
-void environment_manager::assign(const std::string& name, const literal_value& value)
+void environment_manager::assign(const symbol* name, const literal_value& value)
 {
     _environments.back()->assign(name, value);
 }
 
-void environment_manager::assign_at(int distance, const token& name, const literal_value& literal)
+void environment_manager::assign_at(const variable_slot& resolved, const literal_value& literal)
 {
-    return ancestor(distance)->assign(name.lexeme, literal);
+    ancestor(resolved.depth)->assign_slot(resolved.slot, literal);
 }
 
 literal_value environment_manager::get(const token& name) const
@@ -118,9 +191,15 @@ literal_value environment_manager::get(const token& name) const
     return _environments.back()->get(name);
 }
 
-literal_value environment_manager::get_at(int distance, const token& name) const
+literal_value environment_manager::get_at(const variable_slot& resolved, const token& name) const
+{
+    return ancestor(resolved.depth)->get_slot(resolved.slot, name);
+}
+
+void environment_manager::mark_roots(memory_manager& mm)
 {
-    return ancestor(distance)->get(name);
+    for (environment* env : _environments)
+        mm.mark(env);
 }
 
 environment* environment_manager::ancestor(int distance) const
@@ -41,9 +41,10 @@ std::string get_token_position(const token& t)
         return ss.str();
     }
 
-    ss << " on line/col [" << t.position.first << ":" << t.position.second << "] on token '" << t.lexeme << "'";
+    coord position = t.position();
+    ss << " on line/col [" << position.first << ":" << position.second << "] on token '" << t.lexeme() << "'";
     ss << '\n';
-    ss << ">>> " << t.source_line;
+    ss << ">>> " << t.source_line();
     return ss.str();
 }
 
@@ -6,50 +6,54 @@
 
 NAMESPACE_BEGIN(cpplox)
 
-unary_expression::unary_expression(token oper, std::unique_ptr<expression> expr)
+unary_expression::unary_expression(token oper, unique_ptr_t<expression> expr)
     : oper(oper)
-    , expr_rhs(std::move(expr)) { }
+    , expr_rhs(std::move(expr))
+    , form(unary_form::uninitialized) { }
 
-binary_expression::binary_expression(std::unique_ptr<expression> lhs, token oper, std::unique_ptr<expression> rhs)
+binary_expression::binary_expression(unique_ptr_t<expression> lhs, token oper, unique_ptr_t<expression> rhs)
    : expr_lhs(std::move(lhs))
     , oper(oper)
-    , expr_rhs(std::move(rhs)) { }
+    , expr_rhs(std::move(rhs))
+    , form(binary_form::uninitialized) { }
 
 literal_expression::literal_expression(const literal_value& literal)
     : literal_val(literal) { }
 
-grouping_expression::grouping_expression(std::unique_ptr<expression> expr)
+grouping_expression::grouping_expression(unique_ptr_t<expression> expr)
     : expr_group(std::move(expr)) { }
 
 variable_expression::variable_expression(const token& t)
     : ident_name(t) { }
 
-assignment_expression::assignment_expression(const token& ident_name, std::unique_ptr<expression> initializer_expr)
+assignment_expression::assignment_expression(const token& ident_name, unique_ptr_t<expression> initializer_expr)
     : ident_name(ident_name)
     , initializer_expr(std::move(initializer_expr)) { }
 
-logical_expression::logical_expression(std::unique_ptr<expression> lhs_, token oper_, std::unique_ptr<expression> rhs_)
+logical_expression::logical_expression(unique_ptr_t<expression> lhs_, token oper_, unique_ptr_t<expression> rhs_)
     : expr_lhs(std::move(lhs_))
     , oper(oper_)
     , expr_rhs(std::move(rhs_)) { }
 
-postfix_expression::postfix_expression(std::unique_ptr<expression> expr_, token oper_)
+postfix_expression::postfix_expression(unique_ptr_t<expression> expr_, token oper_)
     : expr_lhs(std::move(expr_))
     , oper(oper_) { }
 
-call_expression::call_expression(std::unique_ptr<expression> callee_, token paren_, std::vector<std::unique_ptr<expression>> arguments_)
+call_expression::call_expression(unique_ptr_t<expression> callee_, token paren_, vector_t<unique_ptr_t<expression>> arguments_)
     : callee(std::move(callee_))
     , paren(paren_)
     , arguments(std::move(arguments_)) { }
 
-get_expression::get_expression(std::unique_ptr<expression> object_, token name_)
+get_expression::get_expression(unique_ptr_t<expression> object_, token name_)
     : object(std::move(object_))
-    , name(name_) { }
+    , name(name_)
+    , cache(property_site_kind::get, name) { }
 
-set_expression::set_expression(std::unique_ptr<expression> object_, token name_, std::unique_ptr<expression> value_)
+set_expression::set_expression(unique_ptr_t<expression> object_, token name_, unique_ptr_t<expression> value_)
     : object(std::move(object_))
     , name(name_)
-    , value(std::move(value_)) { }
+    , value(std::move(value_))
+    , cache(property_site_kind::set, name) { }
 
 this_expression::this_expression(const token& t)
     : keyword(t) { }
@@ -0,0 +1,202 @@
+#include "inline_cache.h"
+#include "cpplox_types.h"
+#include "exceptions.h"
+#include "shape.h"
+#include "tokens.h"
+#include "typedefs.h"
+#include <algorithm>
+#include <iomanip>
+#include <ostream>
+#include <string>
+#include <vector>
+
+NAMESPACE_BEGIN(cpplox)
+
+namespace
+{
+    bool stats_enabled = false;
+
+    // Every site that ran at least once while stats are enabled, which always starts with a miss
+    std::vector<inline_cache*>& registered_sites()
+    {
+        static std::vector<inline_cache*> sites;
+        return sites;
+    }
+
+    // What a site counted, kept after the site itself is gone
+    struct site_stats
+    {
+        property_site_kind kind;
+        token name;
+        std::string state;
+        uint64 hits;
+        uint64 misses;
+    };
+
+    // Sites that ran and were freed since, such as those of the statements --stream frees one by one
+    std::vector<site_stats>& retired_sites()
+    {
+        static std::vector<site_stats> sites;
+        return sites;
+    }
+
+    const char* kind_name(property_site_kind kind)
+    {
+        switch (kind)
+        {
+            case property_site_kind::get:    return "get";
+            case property_site_kind::set:    return "set";
+            case property_site_kind::invoke: return "invoke";
+        }
+
+        return "unknown";
+    }
+
+    double hit_rate(uint64 hits, uint64 misses)
+    {
+        uint64 total = hits + misses;
+        return total == 0 ? 0.0 : 100.0 * static_cast<double>(hits) / static_cast<double>(total);
+    }
+}
+
+inline_cache::inline_cache(property_site_kind kind, const token& name)
+    : _kind(kind)
+    , _name(name)
+    , _symbol(name.name())
+    , _entries()
+    , _entry_count(0)
+    , _megamorphic(false)
+    , _site_index(unregistered)
+    , _uncached()
+    , _hits(0)
+    , _misses(0) { }
+
+inline_cache::~inline_cache()
+{
+    if (_site_index != unregistered)
+    {
+        retired_sites().push_back({ _kind, _name, state(), _hits, _misses });
+
+        // The last site takes this one's place, so freeing a site doesn't depend on how many there are
+        std::vector<inline_cache*>& sites = registered_sites();
+        sites[_site_index] = sites.back();
+        sites[_site_index]->_site_index = _site_index;
+        sites.pop_back();
+    }
+}
+
+std::string inline_cache::state() const
+{
+    if (_megamorphic)
+        return "megamorphic";
+
+    switch (_entry_count)
+    {
+        case 0:  return "uninitialized";
+        case 1:  return "monomorphic";
+        default: return "polymorphic";
+    }
+}
+
+void inline_cache::enable_stats() noexcept
+{
+    stats_enabled = true;
+}
+
+void inline_cache::print_stats(std::ostream& os)
+{
+    std::vector<site_stats> sites = retired_sites();
+    for (const inline_cache* site : registered_sites())
+        sites.push_back({ site->_kind, site->_name, site->state(), site->_hits, site->_misses });
+
+    std::stable_sort(sites.begin(), sites.end(), [](const site_stats& lhs, const site_stats& rhs) {
+        return lhs.name.offset < rhs.name.offset;
+    });
+
+    uint64 total_hits = 0;
+    uint64 total_misses = 0;
+
+    for (const site_stats& site : sites)
+    {
+        total_hits += site.hits;
+        total_misses += site.misses;
+    }
+
+    std::ios_base::fmtflags flags = os.flags();
+    os << std::fixed << std::setprecision(1);
+
+    os << "[ Inline Cache Stats ]\n";
+    os << "sites:    " << sites.size() << '\n';
+    os << "hits:     " << total_hits << '\n';
+    os << "misses:   " << total_misses << '\n';
+    os << "hit rate: " << hit_rate(total_hits, total_misses) << "%\n";
+
+    for (const site_stats& site : sites)
+    {
+        coord position = site.name.position();
+        os << "  [" << position.first << ":" << position.second << "] "
+           << kind_name(site.kind) << " '" << site.name.lexeme() << "' " << site.state
+           << ", hits: " << site.hits << ", misses: " << site.misses
+           << ", hit rate: " << hit_rate(site.hits, site.misses) << "%\n";
+    }
+
+    os.flags(flags);
+}
+
+const inline_cache_entry& inline_cache::resolve_get(cpplox_instance* instance)
+{
+    inline_cache_entry entry;
+    entry.receiver_shape = instance->get_shape();
+    entry.class_id = instance->get_class()->id;
+    entry.slot = instance->get_shape()->find(_symbol);
+
+    if (entry.slot < 0)
+    {
+        entry.method = instance->get_class()->find_method(_name);
+        if (!entry.method)
+            throw cpplox_runtime_error("Undefined property or method '" + std::string(_name.lexeme()) + "'", _name);
+    }
+
+    return insert(entry);
+}
+
+const inline_cache_entry& inline_cache::resolve_set(cpplox_instance* instance)
+{
+    inline_cache_entry entry;
+    entry.receiver_shape = instance->get_shape();
+    entry.class_id = instance->get_class()->id;
+    entry.slot = instance->get_shape()->find(_symbol);
+
+    if (entry.slot < 0)
+    {
+        entry.slot = instance->get_shape()->field_count();
+        entry.transition = instance->get_shape()->add_field(_symbol);
+    }
+
+    return insert(entry);
+}
+
+const inline_cache_entry& inline_cache::insert(const inline_cache_entry& entry)
+{
+    ++_misses;
+
+    if (stats_enabled && _site_index == unregistered)
+    {
+        _site_index = registered_sites().size();
+        registered_sites().push_back(this);
+    }
+
+    if (_entry_count == polymorphic_limit)
+        _megamorphic = true;
+
+    if (_megamorphic)
+    {
+        _uncached = entry;
+        return _uncached;
+    }
+
+    _entries[_entry_count] = entry;
+    return _entries[_entry_count++];
+}
+
+NAMESPACE_END
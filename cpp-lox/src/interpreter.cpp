@@ -5,10 +5,13 @@
 #include "exceptions.h"
 #include "expressions.h"
 #include "cpplox_types.h"
+#include "inline_cache.h"
 #include "tokens.h"
 #include "memory_manager.h"
+#include "quickening.h"
 #include "typedefs.h"
 #include "statements.h"
+#include "symbol_table.h"
 #include <cassert>
 #include <memory>
 #include <string>
@@ -18,28 +21,47 @@ NAMESPACE_BEGIN(cpplox)
 
 interpreter::interpreter(console_io* io)
     : _env_manager()
-    , _io(io) 
-    , _locals()
+    , _io(io)
+    , _completion(completion::normal)
+    , _had_error(false)
+    , _return_value()
+    , _jit()
+    , _loop_hotness(nullptr)
 { 
     instantiate_standard_library();
 }
 
+bool interpreter::error_occurred() const noexcept { return _had_error; }
+void interpreter::reset_error_flag() noexcept { _had_error = false; }
+
+void interpreter::enable_jit()
+{
+    if (jit::supported())
+        _jit = std::make_unique<jit>(_env_manager.get_global_environment());
+}
+
+void interpreter::print_jit_stats(std::ostream& os) const
+{
+    if (_jit)
+        _jit->print_stats(os);
+    else
+        os << "[ JIT Stats ]\n  not supported on this platform\n";
+}
+
 void interpreter::instantiate_standard_library()
 {
     memory_manager& instance = memory_manager::instance();
+    symbol_table& symbols = symbol_table::instance();
 
-    cpplox_callable* clock = new class clock();
-    cpplox_callable* print = new class print(_io);
-    cpplox_callable* input = new class input(_io);
-    _env_manager.get_global_environment()->define("clock", clock);
-    _env_manager.get_global_environment()->define("print", print);
-    _env_manager.get_global_environment()->define("input", input);
-    instance.register_callable(clock);
-    instance.register_callable(print);
-    instance.register_callable(input);
+    cpplox_callable* clock = instance.allocate<class clock>();
+    cpplox_callable* print = instance.allocate<class print>(_io);
+    cpplox_callable* input = instance.allocate<class input>(_io);
+    _env_manager.get_global_environment()->define(symbols.intern("clock"), clock);
+    _env_manager.get_global_environment()->define(symbols.intern("print"), print);
+    _env_manager.get_global_environment()->define(symbols.intern("input"), input);
 }
 
-void interpreter::interpret(const std::vector<std::unique_ptr<statement>>& statements)
+void interpreter::interpret(const vector_t<unique_ptr_t<statement>>& statements)
 {
     debug_timer dt("interpreter::interpret()");
 
@@ -52,42 +74,54 @@ void interpreter::interpret(const std::vector<std::unique_ptr<statement>>& state
     }
     catch (const cpplox_runtime_error& e)
     {
+        _had_error = true;
         _io->err() << e.what() << '\n';
     }
     catch (...)
     {
+        _had_error = true;
         _io->err() << "Exception swallower hit\n";
     }
 
     dt.stop();
 }
 
-literal_value interpreter::evaluate(const std::unique_ptr<expression>& expr)
+literal_value interpreter::evaluate(const unique_ptr_t<expression>& expr)
 {
     return expr->accept_visitor(*this);
 }
 
-void interpreter::evaluate(const std::unique_ptr<statement>& stmt)
+interpreter::completion interpreter::evaluate(const unique_ptr_t<statement>& stmt)
 {
+    // Statement boundaries are the interpreter's safe points, every live value is reachable from the
+    // environment stack or a temporary root here
+    memory_manager::instance().collect_if_needed();
     stmt->accept_visitor(*this);
+    return _completion;
 }
 
-void interpreter::resolve(expression& expr, int depth)
+literal_value interpreter::lookup_variable(const token& name, const variable_slot& resolved)
 {
-    _locals[&expr] = depth;
+    if (resolved.is_local())
+        return _env_manager.get_at(resolved, name);
+
+    return _env_manager.get_global_environment()->get(name);
 }
 
-literal_value interpreter::lookup_variable(const token& name, expression& expr)
+void interpreter::assign_variable(const token& name, const variable_slot& resolved, const literal_value& value)
 {
-    auto dist_it = _locals.find(&expr);
-    if (dist_it != _locals.end())
-    {
-        return _env_manager.get_at(dist_it->second, name);
-    }
+    if (resolved.is_local())
+        _env_manager.assign_at(resolved, value);
     else
-    {
-        return _env_manager.get_global_environment()->get(name);
-    }
+        _env_manager.get_global_environment()->assign(name.name(), value);
+}
+
+void interpreter::define_variable(const token& name, int slot, const literal_value& value)
+{
+    if (slot >= 0)
+        _env_manager.get_current_environment()->define_slot(slot, value);
+    else
+        _env_manager.get_current_environment()->define(name.name(), value);
 }
 
 void interpreter::visit_debug_statement(debug_statement& stmt)
@@ -98,7 +132,7 @@ void interpreter::visit_debug_statement(debug_statement& stmt)
 void interpreter::visit_function_declaration_statement(function_declaration_statement& stmt)
 {
     cpplox_callable* new_function = memory_manager::instance().allocate_user_function(stmt, _env_manager.get_current_environment(), &_env_manager);
-    _env_manager.get_current_environment()->define(stmt.ident_name.lexeme, new_function);
+    define_variable(stmt.ident_name, stmt.slot, new_function);
 }
 
 void interpreter::visit_variable_declaration_statement(variable_declaration_statement& stmt)
@@ -107,7 +141,7 @@ void interpreter::visit_variable_declaration_statement(variable_declaration_stat
     if (stmt.initializer_expr)
         literal = evaluate(stmt.initializer_expr);
 
-    _env_manager.get_current_environment()->define(stmt.ident_name.lexeme, literal);
+    define_variable(stmt.ident_name, stmt.slot, literal);
 }
 
 void interpreter::visit_if_statement(if_statement& stmt)
@@ -129,7 +163,21 @@ void interpreter::visit_while_statement(while_statement& stmt)
 {
     while (is_truthy(evaluate(stmt.condition)))
     {
-        evaluate(stmt.stmt_body);
+        completion result = evaluate(stmt.stmt_body);
+
+        if (_loop_hotness)
+            ++*_loop_hotness;
+
+        if (result == completion::return_)
+            break;
+
+        if (result != completion::normal)
+        {
+            _completion = completion::normal;
+
+            if (result == completion::break_)
+                break;
+        }
     }
 }
 
@@ -144,20 +192,20 @@ void interpreter::visit_for_statement(for_statement& stmt)
 
     while (is_truthy(evaluate(stmt.condition)))
     {
-        try
-        {
-            evaluate(stmt.stmt_body);
-        }
-        catch (const cpplox_loop_break&)
-        {
+        completion result = evaluate(stmt.stmt_body);
+
+        if (_loop_hotness)
+            ++*_loop_hotness;
+
+        if (result == completion::return_)
             break;
-        }
-        catch (const cpplox_loop_continue&)
+
+        if (result != completion::normal)
         {
-            if (stmt.increment)
-                evaluate(stmt.increment);
+            _completion = completion::normal;
 
-            continue;
+            if (result == completion::break_)
+                break;
         }
 
         if (stmt.increment)
@@ -169,12 +217,12 @@ void interpreter::visit_for_statement(for_statement& stmt)
 
 void interpreter::visit_break_statement(break_statement& stmt)
 {
-    throw cpplox_loop_break();
+    _completion = completion::break_;
 }
 
 void interpreter::visit_continue_statement(continue_statement& stmt)
 {
-    throw cpplox_loop_continue();
+    _completion = completion::continue_;
 }
 
 void interpreter::visit_return_statement(return_statement& stmt)
@@ -184,7 +232,8 @@ void interpreter::visit_return_statement(return_statement& stmt)
     if (stmt.return_expr)
         value = evaluate(stmt.return_expr);
 
-    throw cpplox_function_return(value);
+    _return_value = value;
+    _completion = completion::return_;
 }
 
 void interpreter::visit_block_statement(block_statement& stmt)
@@ -196,19 +245,19 @@ void interpreter::visit_block_statement(block_statement& stmt)
     }
     catch (...)
     {
-        // We need this here in the case of for_statements.  When continue/break statements are hit,
-        // we need to cleanup the environment stack and rethrow it so the for_statement can catch it.
+        // Keep the environment stack balanced when a runtime error unwinds through the block
         _env_manager.pop_environment();
         throw;
     }
     _env_manager.pop_environment();
 }
 
-void interpreter::execute_block(const std::vector<std::unique_ptr<statement>>& statements, environment* new_environment)
+void interpreter::execute_block(const vector_t<unique_ptr_t<statement>>& statements, environment* new_environment)
 {
     for (const auto& s : statements)
     {
-        evaluate(s);
+        if (evaluate(s) != completion::normal)
+            return;
     }
 }
 
@@ -223,7 +272,7 @@ void interpreter::visit_class_statement(class_statement& stmt)
 
         if (superclass_type == cpplox_type::callable_)
         {
-            cpplox_callable* callable = std::get<cpplox_callable*>(literal);
+            cpplox_callable* callable = literal.as_callable();
             cpplox_class* class_cast = dynamic_cast<cpplox_class*>(callable);
 
             if (!class_cast)
@@ -233,28 +282,31 @@ void interpreter::visit_class_statement(class_statement& stmt)
         }
     }
 
-    _env_manager.get_current_environment()->define(stmt.name.lexeme, std::monostate{});
+    define_variable(stmt.name, stmt.slot, std::monostate{});
 
     if (stmt.superclass)
     {
         _env_manager.push_environment();
-        _env_manager.get_current_environment()->define("super", superclass);
+        _env_manager.get_current_environment()->define_slot(0, superclass);
     }
 
-    std::unordered_map<std::string, cpplox_callable*> methods;
-    for (const std::unique_ptr<function_declaration_statement>& method : stmt.methods)
+    symbol_map<cpplox_callable*> methods;
+    for (const unique_ptr_t<function_declaration_statement>& method : stmt.methods)
     {
-        bool is_init = method->ident_name.lexeme == "init";
+        bool is_init = method->ident_name.lexeme() == "init";
         cpplox_callable* new_method = memory_manager::instance().allocate_user_function(*method, _env_manager.get_current_environment(), &_env_manager, is_init);
-        methods[method->ident_name.lexeme] = new_method;
+        methods[method->ident_name.name()] = new_method;
     }
 
-    cpplox_callable* new_class = memory_manager::instance().allocate_class(stmt.name.lexeme, std::move(methods), superclass);
+    cpplox_callable* new_class = memory_manager::instance().allocate_class(std::string(stmt.name.lexeme()), std::move(methods), superclass);
 
     if (superclass)
         _env_manager.pop_environment();
 
-    _env_manager.get_current_environment()->assign(stmt.name.lexeme, new_class);
+    if (stmt.slot >= 0)
+        _env_manager.get_current_environment()->assign_slot(stmt.slot, new_class);
+    else
+        _env_manager.get_current_environment()->assign(stmt.name.name(), new_class);
 }
 
 void interpreter::visit_expression_statement(expression_statement& stmt)
@@ -264,49 +316,56 @@ void interpreter::visit_expression_statement(expression_statement& stmt)
 
 literal_value interpreter::visit_unary(unary_expression& expr)
 {
-    literal_value literal = evaluate(expr.expr_rhs);
-    cpplox_type literal_type = literal_to_cpplox_type(literal);
-
     const token& oper = expr.oper;
 
-    if (oper.type == token_type::bang_)
+    if (oper.type == token_type::bang_ || oper.type == token_type::minus_)
     {
-        if (literal_type != cpplox_type::bool_)
-            throw type_error("Cannot use unary operator ('!') on non-bool type", oper);
-
-        return !is_truthy(literal);
-    }
+        literal_value rhs = evaluate(expr.expr_rhs);
 
-    if (oper.type == token_type::minus_)
-    {
-        if (literal_type != cpplox_type::number_)
-            throw type_error("Cannot use unary operator ('-') on non-number type", oper);
+        switch (expr.form)
+        {
+            case unary_form::number_negate:
+            {
+                if (rhs.is_number())
+                    return negate_number(rhs);
+            } break;
+            case unary_form::bool_not:
+            {
+                if (rhs.is_bool())
+                    return !rhs.as_bool();
+            } break;
+            case unary_form::uninitialized:
+            {
+                expr.form = quickening::specialize(oper.type, rhs);
+                return apply_unary_operator(oper, rhs);
+            }
+            default:
+                return apply_unary_operator(oper, rhs);
+        }
 
-        return -(std::get<double>(literal));
+        // The guard failed
+        expr.form = quickening::deoptimize(expr.form);
+        return apply_unary_operator(oper, rhs);
     }
 
     if (oper.type == token_type::plus_plus_ || oper.type == token_type::minus_minus_)
     {
         variable_expression* var_expr = dynamic_cast<variable_expression*>(expr.expr_rhs.get());
-        std::string oper = expr.oper.lexeme;
+        std::string oper = std::string(expr.oper.lexeme());
 
         if (!var_expr)
             throw type_error("Unary prefix operator '" + oper + "' requires a variable operand", expr.oper);
 
-        literal_value literal = _env_manager.get_current_environment()->get(var_expr->ident_name);
-        cpplox_type type = literal_to_cpplox_type(literal);
+        literal_value literal = lookup_variable(var_expr->ident_name, var_expr->resolved);
 
-        if (type != cpplox_type::number_)
+        if (!literal.is_number())
             throw type_error("Invalid type for postfix operator '" + oper + "'", expr.oper);
 
-        double value = std::get<double>(literal);
+        literal_value one = int64{ 1 };
+        literal_value value = expr.oper.type == token_type::plus_plus_
+            ? add_numbers(literal, one) : subtract_numbers(literal, one);
 
-        if (expr.oper.type == token_type::plus_plus_)
-            ++value;
-        else if (expr.oper.type == token_type::minus_minus_)
-            --value;
-
-        _env_manager.get_current_environment()->assign(var_expr->ident_name.lexeme, value);
+        assign_variable(var_expr->ident_name, var_expr->resolved, value);
         return value;
     }
 
@@ -316,156 +375,64 @@ literal_value interpreter::visit_unary(unary_expression& expr)
 literal_value interpreter::visit_binary(binary_expression& expr)
 {
     literal_value lhs = evaluate(expr.expr_lhs);
-    literal_value rhs = evaluate(expr.expr_rhs);
-
-    cpplox_type lhs_type = literal_to_cpplox_type(lhs);
-    cpplox_type rhs_type = literal_to_cpplox_type(rhs);
+    literal_value rhs;
 
-    const token& oper = expr.oper;
+    // Only an object on the heap has to be kept alive while the right operand is evaluated, the
+    // number operands the typed forms expect are skipped without touching the temporary roots
+    if (lhs.is_number())
+    {
+        rhs = evaluate(expr.expr_rhs);
+    }
+    else
+    {
+        temporary_roots roots;
+        roots.add(lhs);
+        rhs = evaluate(expr.expr_rhs);
+    }
 
-    if (lhs_type != rhs_type)
+    // The typed forms check their operands and do the operation themselves, anything else goes
+    // through the generic operator
+    if (expr.form < binary_form::string_concatenate)
     {
-        if (oper.type == token_type::plus_)
+        if (lhs.is_number() && rhs.is_number())
         {
-            if ((lhs_type == cpplox_type::string_ && rhs_type == cpplox_type::number_) ||
-                    (lhs_type == cpplox_type::number_ && rhs_type == cpplox_type::string_))
+            switch (expr.form)
             {
-                if (lhs_type == cpplox_type::string_)
+                case binary_form::number_add:           return add_numbers(lhs, rhs);
+                case binary_form::number_subtract:      return subtract_numbers(lhs, rhs);
+                case binary_form::number_multiply:      return multiply_numbers(lhs, rhs);
+                case binary_form::number_divide:        return divide_numbers(lhs, rhs);
+                case binary_form::number_modulo:
                 {
-                    return std::get<std::string>(lhs) + literal_value_to_runtime_string(rhs);
-                }
-                else
-                {
-                    return literal_value_to_runtime_string(lhs) + std::get<std::string>(rhs);
+                    // The guard held, an undefined modulo raises its error without giving up the typed form
+                    if (modulo_defined(lhs, rhs))
+                        return modulo_numbers(lhs, rhs);
+                    return apply_binary_operator(expr.oper, lhs, rhs);
                 }
+                case binary_form::number_greater:       return greater_numbers(lhs, rhs);
+                case binary_form::number_greater_equal: return greater_equal_numbers(lhs, rhs);
+                case binary_form::number_less:          return less_numbers(lhs, rhs);
+                case binary_form::number_less_equal:    return less_equal_numbers(lhs, rhs);
+                case binary_form::number_equal:         return lhs == rhs;
+                case binary_form::number_not_equal:     return !(lhs == rhs);
+                default:                                break;
             }
         }
-        std::string msg = std::string("Cannot use binary operator '" + oper.lexeme + "' on types '" +
-                cpplox_type_to_string(lhs_type) + "' and '" + cpplox_type_to_string(rhs_type)) + "'";
-        throw cpplox_type_error(msg, oper);
-    }
 
-    switch (oper.type)
+        if (expr.form == binary_form::uninitialized)
+            expr.form = quickening::specialize(expr.oper.type, lhs, rhs);
+        else
+            expr.form = quickening::deoptimize(expr.form);
+    }
+    else if (expr.form == binary_form::string_concatenate)
     {
-        case token_type::plus_:
-        {
-            if (lhs_type == cpplox_type::string_)
-            {
-                return std::get<std::string>(lhs) + std::get<std::string>(rhs);
-            }
-            else if (lhs_type == cpplox_type::number_)
-            {
-                return std::get<double>(lhs) + std::get<double>(rhs);
-            }
-            else
-            {
-                throw type_error("Unsupported type for binary operator '+'", oper);
-            }
-        } break;
-        case token_type::minus_:
-        {
-            if (lhs_type == cpplox_type::number_)
-            {
-                return std::get<double>(lhs) - std::get<double>(rhs);
-            }
-            else
-            {
-                throw type_error("Unsupported type for binary operator '-'", oper);
-            }
-        } break;
-        case token_type::star_:
-        {
-            if (lhs_type == cpplox_type::number_)
-            {
-                return std::get<double>(lhs) * std::get<double>(rhs);
-            }
-            else
-            {
-                throw type_error("Unsupported type for binary operator '*'", oper);
-            }
-        } break;
-        case token_type::slash_:
-        {
-            if (lhs_type == cpplox_type::number_)
-            {
-                return std::get<double>(lhs) / std::get<double>(rhs);
-            }
-            else
-            {
-                throw type_error("Unsupported type for binary operator '/'", oper);
-            }
-        } break;
-        case token_type::modulo_:
-        {
-            if (lhs_type == cpplox_type::number_)
-            {
-                int64 lhs_long = static_cast<int64>(std::get<double>(lhs));
-                int64 rhs_long = static_cast<int64>(std::get<double>(rhs));
-                return static_cast<double>(lhs_long % rhs_long);
-            }
-            else
-            {
-                throw type_error("Unsupported type for binary operator '/'", oper);
-            }
-        } break;
-        case token_type::greater_:
-        {
-            if (lhs_type == cpplox_type::number_)
-            {
-                return std::get<double>(lhs) > std::get<double>(rhs);
-            }
-            else
-            {
-                throw type_error("Unsupported type for binary operator '>'", oper);
-            }
-        } break;
-        case token_type::greater_equal_:
-        {
-            if (lhs_type == cpplox_type::number_)
-            {
-                return std::get<double>(lhs) >= std::get<double>(rhs);
-            }
-            else
-            {
-                throw type_error("Unsupported type for binary operator '>='", oper);
-            }
-        } break;
-        case token_type::less_:
-        {
-            if (lhs_type == cpplox_type::number_)
-            {
-                return std::get<double>(lhs) < std::get<double>(rhs);
-            }
-            else
-            {
-                throw type_error("Unsupported type for binary operator '<'", oper);
-            }
-        } break;
-        case token_type::less_equal_:
-        {
-            if (lhs_type == cpplox_type::number_)
-            {
-                return std::get<double>(lhs) <= std::get<double>(rhs);
-            }
-            else
-            {
-                throw type_error("Unsupported type for binary operator '<='", oper);
-            }
-        } break;
-        case token_type::bang_equal_:
-        {
-            return !is_equal(lhs, rhs);
-        } break;
-        case token_type::equal_equal_:
-        {
-            return is_equal(lhs, rhs);
-        } break;
-        default:
-        {
-            throw type_error("Unknown operator in handle_binary()", oper);
-        };
+        if (lhs.is_string() && rhs.is_string())
+            return memory_manager::instance().concatenate(lhs.as_string(), rhs.as_string());
+
+        expr.form = quickening::deoptimize(expr.form);
     }
-    throw type_error("Unknown operator in handle_binary()", oper);
+
+    return apply_binary_operator(expr.oper, lhs, rhs);
 }
 
 literal_value interpreter::visit_literal(literal_expression& expr)
@@ -480,23 +447,13 @@ literal_value interpreter::visit_grouping(grouping_expression& expr)
 
 literal_value interpreter::visit_variable(variable_expression& expr)
 {
-    return lookup_variable(expr.ident_name, expr);
+    return lookup_variable(expr.ident_name, expr.resolved);
 }
 
 literal_value interpreter::visit_assignment(assignment_expression& expr)
 {
     literal_value literal = evaluate(expr.initializer_expr);
-    auto distance_it = _locals.find(&expr);
-
-    if (distance_it != _locals.end())
-    {
-        _env_manager.assign_at(distance_it->second, expr.ident_name, literal);
-    }
-    else
-    {
-        _env_manager.get_global_environment()->assign(expr.ident_name.lexeme, literal);
-    }
-
+    assign_variable(expr.ident_name, expr.resolved, literal);
     return literal;
 }
 
@@ -519,69 +476,121 @@ literal_value interpreter::visit_logical(logical_expression& expr)
 literal_value interpreter::visit_postfix(postfix_expression& expr)
 {
     variable_expression* var_expr = dynamic_cast<variable_expression*>(expr.expr_lhs.get());
-    std::string oper = expr.oper.lexeme;
+    std::string oper = std::string(expr.oper.lexeme());
 
     if (!var_expr)
         throw type_error("Postfix operator '" + oper + "' requires a variable operand", expr.oper);
 
-    literal_value literal = _env_manager.get_current_environment()->get(var_expr->ident_name);
+    literal_value literal = lookup_variable(var_expr->ident_name, var_expr->resolved);
     cpplox_type type = literal_to_cpplox_type(literal);
 
     if (type != cpplox_type::number_)
         throw type_error("Invalid type for postfix operator '" + oper + "'", expr.oper);
 
-    double value = std::get<double>(literal);
-    double new_val = value;
-
-    if (expr.oper.type == token_type::plus_plus_)
-        new_val++;
-    else if (expr.oper.type == token_type::minus_minus_)
-        new_val--;
+    literal_value one = int64{ 1 };
+    literal_value new_val = expr.oper.type == token_type::plus_plus_
+        ? add_numbers(literal, one) : subtract_numbers(literal, one);
 
-    _env_manager.get_current_environment()->assign(var_expr->ident_name.lexeme, new_val);
-    return value;
+    assign_variable(var_expr->ident_name, var_expr->resolved, new_val);
+    return literal;
 }
 
 literal_value interpreter::visit_call(call_expression& expr)
 {
+    if (get_expression* get_expr = dynamic_cast<get_expression*>(expr.callee.get()))
+        return invoke(expr, *get_expr);
+
+    temporary_roots roots;
     literal_value callee = expr.callee->accept_visitor(*this);
+    return call_value(expr, callee, roots);
+}
+
+literal_value interpreter::call_value(call_expression& expr, const literal_value& callee, temporary_roots& roots)
+{
+    roots.add(callee);
 
     std::vector<literal_value> args;
     args.reserve(expr.arguments.size());
     for (const auto& arg : expr.arguments)
+    {
         args.push_back(evaluate(arg));
+        roots.add(args.back());
+    }
 
     cpplox_type call_type = literal_to_cpplox_type(callee);
     if (call_type != cpplox_type::callable_)
         throw type_error("Cannot call '()' non-callable type", expr.paren);
 
-    cpplox_callable* callable = std::get<cpplox_callable*>(callee);
+    cpplox_callable* callable = callee.as_callable();
     if (callable->arity() != static_cast<int>(args.size()))
         throw cpplox_runtime_error("Expected " + std::to_string(callable->arity()) + " arguments but got " + std::to_string(args.size()));
 
     return callable->call(*this, args);
 }
 
+// Method calls pass the receiver straight to the method instead of materializing a bound method for it
+literal_value interpreter::invoke(call_expression& expr, get_expression& callee)
+{
+    temporary_roots roots;
+    literal_value object = evaluate(callee.object);
+    roots.add(object);
+
+    if (!object.is_instance())
+        return call_value(expr, get_property(callee, object), roots);
+
+    cpplox_instance* instance = object.as_instance();
+    const inline_cache_entry& entry = callee.cache.lookup_get(instance);
+
+    // Fields shadow methods, in which case this is a plain call of the field value
+    if (entry.slot >= 0)
+        return call_value(expr, instance->field_at(entry.slot), roots);
+
+    // Every method of a class is a user function on the tree-walker
+    user_function* method = static_cast<user_function*>(entry.method);
+
+    std::vector<literal_value> args;
+    args.reserve(expr.arguments.size());
+    for (const auto& arg : expr.arguments)
+    {
+        args.push_back(evaluate(arg));
+        roots.add(args.back());
+    }
+
+    if (method->arity() != static_cast<int>(args.size()))
+        throw cpplox_runtime_error("Expected " + std::to_string(method->arity()) + " arguments but got " + std::to_string(args.size()));
+
+    return method->call_method(*this, instance, args);
+}
+
 literal_value interpreter::visit_get(get_expression& expr)
 {
-    literal_value object = evaluate(expr.object);
+    return get_property(expr, evaluate(expr.object));
+}
+
+literal_value interpreter::get_property(get_expression& expr, const literal_value& object)
+{
     cpplox_type object_type = literal_to_cpplox_type(object);
 
     if (object_type == cpplox_type::instance_)
     {
-        cpplox_instance* instance = std::get<cpplox_instance*>(object);
-        return instance->get(expr.name);
+        cpplox_instance* instance = object.as_instance();
+        const inline_cache_entry& entry = expr.cache.lookup_get(instance);
+
+        if (entry.slot >= 0)
+            return instance->field_at(entry.slot);
+
+        return entry.method->bind(instance);
     }
     else if (object_type == cpplox_type::callable_)
     {
-        cpplox_callable* callable = std::get<cpplox_callable*>(object);
+        cpplox_callable* callable = object.as_callable();
         cpplox_class* class_ = dynamic_cast<cpplox_class*>(callable);
 
         if (class_)
         {
             cpplox_callable* static_method = class_->find_method(expr.name);
             if (!static_method)
-                throw cpplox_runtime_error("Static method with name '" + expr.name.lexeme + "' doesn't exist; are you trying to access an instance method or property?");
+                throw cpplox_runtime_error("Static method with name '" + std::string(expr.name.lexeme()) + "' doesn't exist; are you trying to access an instance method or property?");
 
             return static_method;
         }
@@ -598,85 +607,50 @@ literal_value interpreter::visit_set(set_expression& expr)
     if (object_type != cpplox_type::instance_)
         throw type_error("Only instances have fields", expr.name);
 
-    cpplox_instance* instance = std::get<cpplox_instance*>(object);
+    temporary_roots roots;
+    roots.add(object);
+
+    cpplox_instance* instance = object.as_instance();
     literal_value value = evaluate(expr.value);
-    instance->set(expr.name, value);
+    const inline_cache_entry& entry = expr.cache.lookup_set(instance);
+
+    if (entry.transition)
+        instance->add_field(entry.transition, value);
+    else
+        instance->set_field(entry.slot, value);
+
     return value;
 }
 
 literal_value interpreter::visit_this(this_expression& expr)
 {
-    return lookup_variable(expr.keyword, expr);
+    return lookup_variable(expr.keyword, expr.resolved);
 }
 
 literal_value interpreter::visit_super(super_expression& expr)
 {
-    auto distance_it = _locals.find(&expr);
-
-    if (distance_it == _locals.end())
+    if (!expr.resolved.is_local())
         throw cpplox_runtime_error("Iterator distance_it in visit_super could not be resolved", expr.keyword);
 
-    cpplox_class* superclass = std::get<cpplox_class*>(_env_manager.get_at(distance_it->second, create_dummy_token(token_type::super_)));
+    cpplox_class* superclass = _env_manager.get_at(expr.resolved, create_dummy_token(token_type::super_)).as_class();
 
     if (!superclass)
         throw cpplox_runtime_error("Superclass could not be cast in visit_super", expr.keyword);
 
-    cpplox_instance* object = std::get<cpplox_instance*>(_env_manager.get_at(distance_it->second - 1, create_dummy_token(token_type::this_)));
+    // 'this' is always bound in the environment directly below the one holding 'super'
+    variable_slot this_slot{ expr.resolved.depth - 1, 0 };
+    cpplox_instance* object = _env_manager.get_at(this_slot, create_dummy_token(token_type::this_)).as_instance();
     if (!object)
         throw cpplox_runtime_error("Object could not be cast to a cpplox_instance* in visit_super", expr.keyword);
 
-    cpplox_callable* method = superclass->find_method(expr.method.lexeme);
+    cpplox_callable* method = superclass->find_method(expr.method.name());
     if (!method)
-        throw cpplox_runtime_error("Undefined property '" + expr.method.lexeme + "'.");
+        throw cpplox_runtime_error("Undefined property '" + std::string(expr.method.lexeme()) + "'.");
 
     user_function* method_cast = dynamic_cast<user_function*>(method);
     return method_cast->bind(object);
 }
 
-bool interpreter::is_truthy(const literal_value& literal) const
-{
-    cpplox_type type = literal_to_cpplox_type(literal);
-
-    switch (type)
-    {
-        case cpplox_type::bool_:
-        {
-            return std::get<bool>(literal);
-        } break;
-        case cpplox_type::number_:
-        {
-            return std::get<double>(literal) != 0;
-        } break;
-        case cpplox_type::string_:
-        {
-            return !std::get<std::string>(literal).empty();
-        } break;
-        case cpplox_type::null_:
-        {
-            return false;
-        } break;
-    }
-    throw cpplox_runtime_error("Unknown type in is_truthy()");
-}
-
-bool interpreter::is_equal(const literal_value& lhs, const literal_value& rhs) const
-{
-    cpplox_type lhs_type = literal_to_cpplox_type(lhs);
-    cpplox_type rhs_type = literal_to_cpplox_type(rhs);
-
-    if (lhs_type != rhs_type)
-    {
-        return false;
-    }
-
-    if ((lhs_type == cpplox_type::null_) && (rhs_type == cpplox_type::null_))
-        return true;
-    if (lhs_type == cpplox_type::null_)
-        return false;
-
-    return lhs == rhs;
-}
-
 cpplox_type_error interpreter::type_error(const std::string& msg, const token& t) const
 {
     return cpplox_type_error(msg, t);
@@ -0,0 +1,900 @@
+#include "jit.h"
+#include "cpplox_types.h"
+#include "environment.h"
+#include "expression_visitors.h"
+#include "expressions.h"
+#include "statement_visitors.h"
+#include "statements.h"
+#include "tokens.h"
+#include "typedefs.h"
+#include "x64_assembler.h"
+#include <cstring>
+#include <fstream>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#if defined(__x86_64__) && defined(__linux__)
+#include <sys/mman.h>
+#include <unistd.h>
+#define CPPLOX_JIT_SUPPORTED 1
+#else
+#define CPPLOX_JIT_SUPPORTED 0
+#endif
+
+NAMESPACE_BEGIN(cpplox)
+
+namespace
+{
+    using reg = x64_register;
+
+    // Never the result of an expression the compiled code can evaluate, since reading an undefined
+    // variable is an error
+    constexpr uint64 bail_bits = nan_boxing::undefined_bits;
+    constexpr uint64 integer_bits = nan_boxing::tag_bits(nan_boxing::integer_tag);
+
+    // Thrown by the compiler at the first node it has no code for
+    struct unsupported_node { };
+
+    literal_value unbox(uint64 bits) noexcept { return literal_value::from_bits(bits); }
+    uint64 box(const literal_value& value) noexcept { return value.raw_bits(); }
+
+    // The helpers below do the work of an operator the inline code didn't handle.  Anything that would
+    // raise an error or allocate bails out instead, so the interpreter gets to do it.
+
+    uint64 binary_helper(uint64 oper, uint64 lhs_bits, uint64 rhs_bits) noexcept
+    {
+        literal_value lhs = unbox(lhs_bits);
+        literal_value rhs = unbox(rhs_bits);
+        token_type type = static_cast<token_type>(oper);
+
+        if (lhs.is_number() && rhs.is_number())
+        {
+            switch (type)
+            {
+                case token_type::plus_:          return box(add_numbers(lhs, rhs));
+                case token_type::minus_:         return box(subtract_numbers(lhs, rhs));
+                case token_type::star_:          return box(multiply_numbers(lhs, rhs));
+                case token_type::slash_:         return box(divide_numbers(lhs, rhs));
+                case token_type::greater_:       return box(greater_numbers(lhs, rhs));
+                case token_type::greater_equal_: return box(greater_equal_numbers(lhs, rhs));
+                case token_type::less_:          return box(less_numbers(lhs, rhs));
+                case token_type::less_equal_:    return box(less_equal_numbers(lhs, rhs));
+                case token_type::equal_equal_:   return box(lhs == rhs);
+                case token_type::bang_equal_:    return box(!(lhs == rhs));
+                case token_type::modulo_:
+                {
+                    // A divisor that truncates to 0, or a double too large to truncate, bails out so that
+                    // the interpreter raises the runtime error
+                    if (modulo_defined(lhs, rhs))
+                        return box(modulo_numbers(lhs, rhs));
+                } break;
+                default:
+                    break;
+            }
+
+            return bail_bits;
+        }
+
+        // Comparing values of two different types is a type error
+        bool equality = type == token_type::equal_equal_ || type == token_type::bang_equal_;
+        if (equality && literal_to_cpplox_type(lhs) == literal_to_cpplox_type(rhs))
+            return box(is_equal(lhs, rhs) == (type == token_type::equal_equal_));
+
+        return bail_bits;
+    }
+
+    uint64 negate_helper(uint64 bits) noexcept
+    {
+        literal_value value = unbox(bits);
+        return value.is_number() ? box(negate_number(value)) : bail_bits;
+    }
+
+    uint64 increment_helper(uint64 bits, uint64 decrement) noexcept
+    {
+        literal_value value = unbox(bits);
+        if (!value.is_number())
+            return bail_bits;
+
+        literal_value one = int64{ 1 };
+        return box(decrement ? subtract_numbers(value, one) : add_numbers(value, one));
+    }
+
+    // 1 for a truthy value, 0 for a falsy one and 2 for one that has no truthiness
+    uint64 truthy_helper(uint64 bits) noexcept
+    {
+        literal_value value = unbox(bits);
+        if (!value.is_bool() && !value.is_number() && !value.is_string() && !value.is_null())
+            return 2;
+
+        return is_truthy(value) ? 1 : 0;
+    }
+}
+
+// Generates the code for one function.  Values are computed into rax; the left operand of a binary
+// operator waits on the native stack while the right one is computed.  The frame holds the jit, a scratch
+// word and then one word for every local and call argument, each at a fixed offset from rbp.
+class jit::compiler : public statement_visitor, expression_visitor<void>
+{
+public:
+    explicit compiler(environment* globals)
+        : _globals(globals), _assembler(), _scopes(), _loops(), _bail(), _frame_words(first_local), _pushed(0) { }
+
+    std::vector<uint8> compile(function_declaration_statement& declaration)
+    {
+        x64_assembler& a = _assembler;
+
+        a.push(reg::rbp);
+        a.mov(reg::rbp, reg::rsp);
+        a.sub(reg::rsp, 0);
+        size_t frame_size = a.last_immediate();
+        a.store(reg::rbp, self_offset, reg::rdi);
+
+        // The parameters are the first slots of the function's scope
+        _scopes.emplace_back();
+        for (size_t i = 0; i < declaration.params.size(); ++i)
+        {
+            int word = allocate_word();
+            _scopes.back().push_back(word);
+            a.load(reg::rax, reg::rsi, static_cast<int32>(i * 8));
+            a.store(reg::rbp, offset(word), reg::rax);
+        }
+
+        for (const unique_ptr_t<statement>& stmt : declaration.body)
+        {
+            stmt->accept_visitor(*this);
+        }
+
+        // Falling off the end returns null
+        a.mov(reg::rax, nan_boxing::null_bits);
+        a.leave();
+        a.ret();
+
+        a.bind(_bail);
+        a.mov(reg::rax, bail_bits);
+        a.leave();
+        a.ret();
+
+        // rsp is 16 byte aligned after the push of rbp, keep it that way
+        a.patch_int32(frame_size, static_cast<int32>((_frame_words * 8 + 15) & ~15));
+        return a.code();
+    }
+
+    virtual void visit_debug_statement(debug_statement&) override { throw unsupported_node{}; }
+    virtual void visit_function_declaration_statement(function_declaration_statement&) override { throw unsupported_node{}; }
+    virtual void visit_class_statement(class_statement&) override { throw unsupported_node{}; }
+
+    virtual void visit_variable_declaration_statement(variable_declaration_statement& stmt) override
+    {
+        // An uninitialized variable could be read while it is still undefined, which is an error
+        if (!stmt.initializer_expr || stmt.slot < 0)
+            throw unsupported_node{};
+
+        compile(stmt.initializer_expr);
+
+        std::vector<int>& scope = _scopes.back();
+        size_t slot = static_cast<size_t>(stmt.slot);
+        if (slot >= scope.size())
+            scope.resize(slot + 1, -1);
+
+        // Each declaration gets a word of its own, even when the scope is entered again
+        if (scope[slot] < 0)
+            scope[slot] = allocate_word();
+
+        _assembler.store(reg::rbp, offset(scope[slot]), reg::rax);
+    }
+
+    virtual void visit_if_statement(if_statement& stmt) override
+    {
+        x64_label else_branch;
+        x64_label end;
+
+        compile(stmt.condition);
+        branch_if_falsy(else_branch);
+        stmt.if_branch->accept_visitor(*this);
+        _assembler.jmp(end);
+        _assembler.bind(else_branch);
+
+        if (stmt.else_branch)
+            stmt.else_branch->accept_visitor(*this);
+
+        _assembler.bind(end);
+    }
+
+    virtual void visit_while_statement(while_statement& stmt) override
+    {
+        x64_label top;
+        x64_label end;
+
+        _assembler.bind(top);
+        compile(stmt.condition);
+        branch_if_falsy(end);
+
+        _loops.push_back(loop{ &end, &top });
+        stmt.stmt_body->accept_visitor(*this);
+        _loops.pop_back();
+
+        _assembler.jmp(top);
+        _assembler.bind(end);
+    }
+
+    virtual void visit_for_statement(for_statement& stmt) override
+    {
+        x64_label top;
+        x64_label next;
+        x64_label end;
+
+        _scopes.emplace_back();
+
+        if (stmt.initializer)
+            stmt.initializer->accept_visitor(*this);
+
+        _assembler.bind(top);
+        if (stmt.condition)
+        {
+            compile(stmt.condition);
+            branch_if_falsy(end);
+        }
+
+        _loops.push_back(loop{ &end, &next });
+        stmt.stmt_body->accept_visitor(*this);
+        _loops.pop_back();
+
+        _assembler.bind(next);
+        if (stmt.increment)
+            compile(stmt.increment);
+
+        _assembler.jmp(top);
+        _assembler.bind(end);
+
+        _scopes.pop_back();
+    }
+
+    virtual void visit_break_statement(break_statement&) override
+    {
+        _assembler.jmp(*_loops.back().break_target);
+    }
+
+    virtual void visit_continue_statement(continue_statement&) override
+    {
+        _assembler.jmp(*_loops.back().continue_target);
+    }
+
+    virtual void visit_return_statement(return_statement& stmt) override
+    {
+        if (stmt.return_expr)
+            compile(stmt.return_expr);
+        else
+            _assembler.mov(reg::rax, nan_boxing::null_bits);
+
+        _assembler.leave();
+        _assembler.ret();
+    }
+
+    virtual void visit_block_statement(block_statement& stmt) override
+    {
+        _scopes.emplace_back();
+
+        for (const unique_ptr_t<statement>& s : stmt.statements)
+        {
+            s->accept_visitor(*this);
+        }
+
+        _scopes.pop_back();
+    }
+
+    virtual void visit_expression_statement(expression_statement& stmt) override
+    {
+        compile(stmt.expr);
+    }
+
+    virtual void visit_unary(unary_expression& expr) override
+    {
+        x64_assembler& a = _assembler;
+
+        switch (expr.oper.type)
+        {
+            case token_type::minus_:
+            {
+                compile(expr.expr_rhs);
+                a.mov(reg::rdi, reg::rax);
+                call_helper(reinterpret_cast<const void*>(&negate_helper));
+                bail_if_bailed();
+            } break;
+            case token_type::bang_:
+            {
+                // Only defined for bools, which differ from each other in the lowest bit
+                compile(expr.expr_rhs);
+                a.mov(reg::rcx, reg::rax);
+                a.mov(reg::rdx, 1);
+                a.or_(reg::rcx, reg::rdx);
+                a.mov(reg::r8, nan_boxing::true_bits);
+                a.cmp(reg::rcx, reg::r8);
+                a.jcc(x64_condition::not_equal, _bail);
+                a.xor_(reg::rax, reg::rdx);
+            } break;
+            case token_type::plus_plus_:
+            case token_type::minus_minus_:
+            {
+                variable_expression* variable = dynamic_cast<variable_expression*>(expr.expr_rhs.get());
+                if (!variable)
+                    throw unsupported_node{};
+
+                increment(local_word(variable->resolved), expr.oper.type == token_type::minus_minus_, false);
+            } break;
+            default:
+                throw unsupported_node{};
+        }
+    }
+
+    virtual void visit_binary(binary_expression& expr) override
+    {
+        x64_assembler& a = _assembler;
+        token_type oper = expr.oper.type;
+
+        compile(expr.expr_lhs);
+        push_rax();
+        compile(expr.expr_rhs);
+        a.mov(reg::rcx, reg::rax);
+        pop(reg::rax);
+
+        x64_label slow;
+        x64_label done;
+
+        if (oper != token_type::slash_ && oper != token_type::modulo_)
+        {
+            // Both operands are integers when neither has anything but the integer tag above its payload
+            a.mov(reg::rdx, reg::rax);
+            a.mov(reg::r8, integer_bits);
+            a.xor_(reg::rdx, reg::r8);
+            a.mov(reg::r9, reg::rcx);
+            a.xor_(reg::r9, reg::r8);
+            a.or_(reg::rdx, reg::r9);
+            a.shr(reg::rdx, 48);
+            a.jcc(x64_condition::not_equal, slow);
+
+            if (oper == token_type::equal_equal_ || oper == token_type::bang_equal_)
+            {
+                a.cmp(reg::rax, reg::rcx);
+                set_bool(oper == token_type::equal_equal_ ? x64_condition::equal : x64_condition::not_equal);
+            }
+            else
+            {
+                untag_integer(reg::rdx, reg::rax);
+                untag_integer(reg::r8, reg::rcx);
+
+                switch (oper)
+                {
+                    case token_type::plus_:     arithmetic(&x64_assembler::add, slow); break;
+                    case token_type::minus_:    arithmetic(&x64_assembler::sub, slow); break;
+                    case token_type::star_:
+                    {
+                        // An overflow or a product of 0, which could have to be -0, is left to the helper
+                        a.imul(reg::rdx, reg::r8);
+                        a.jcc(x64_condition::overflow, slow);
+                        a.test(reg::rdx, reg::rdx);
+                        a.jcc(x64_condition::equal, slow);
+                        box_integer(slow);
+                    } break;
+                    case token_type::greater_:          compare(x64_condition::greater); break;
+                    case token_type::greater_equal_:    compare(x64_condition::greater_equal); break;
+                    case token_type::less_:             compare(x64_condition::less); break;
+                    case token_type::less_equal_:       compare(x64_condition::less_equal); break;
+                    default:
+                        throw unsupported_node{};
+                }
+            }
+
+            a.jmp(done);
+        }
+
+        a.bind(slow);
+        a.mov(reg::rdi, static_cast<uint64>(oper));
+        a.mov(reg::rsi, reg::rax);
+        a.mov(reg::rdx, reg::rcx);
+        call_helper(reinterpret_cast<const void*>(&binary_helper));
+        bail_if_bailed();
+        a.bind(done);
+    }
+
+    virtual void visit_literal(literal_expression& expr) override
+    {
+        _assembler.mov(reg::rax, expr.literal_val.raw_bits());
+    }
+
+    virtual void visit_grouping(grouping_expression& expr) override
+    {
+        compile(expr.expr_group);
+    }
+
+    virtual void visit_variable(variable_expression& expr) override
+    {
+        if (expr.resolved.is_local())
+        {
+            _assembler.load(reg::rax, reg::rbp, offset(local_word(expr.resolved)));
+            return;
+        }
+
+        // An undefined global reads as undefined, which is what the code bails out on anyway
+        _assembler.load(reg::rdi, reg::rbp, self_offset);
+        _assembler.mov(reg::rsi, reinterpret_cast<uint64>(expr.ident_name.name()));
+        call_helper(reinterpret_cast<const void*>(&jit::get_global));
+        bail_if_bailed();
+    }
+
+    virtual void visit_assignment(assignment_expression& expr) override
+    {
+        // Assigning a global is an effect the interpreter could not undo after a bailout
+        if (!expr.resolved.is_local())
+            throw unsupported_node{};
+
+        int word = local_word(expr.resolved);
+        compile(expr.initializer_expr);
+        _assembler.store(reg::rbp, offset(word), reg::rax);
+    }
+
+    virtual void visit_logical(logical_expression& expr) override
+    {
+        x64_label end;
+
+        compile(expr.expr_lhs);
+
+        if (expr.oper.type == token_type::or_)
+        {
+            x64_label rhs;
+            branch_if_falsy(rhs);
+            _assembler.jmp(end);
+            _assembler.bind(rhs);
+        }
+        else
+        {
+            branch_if_falsy(end);
+        }
+
+        compile(expr.expr_rhs);
+        _assembler.bind(end);
+    }
+
+    virtual void visit_postfix(postfix_expression& expr) override
+    {
+        variable_expression* variable = dynamic_cast<variable_expression*>(expr.expr_lhs.get());
+        if (!variable)
+            throw unsupported_node{};
+
+        increment(local_word(variable->resolved), expr.oper.type == token_type::minus_minus_, true);
+    }
+
+    virtual void visit_call(call_expression& expr) override
+    {
+        // Only calls of global functions, which call_global checks can be compiled as well
+        variable_expression* callee = dynamic_cast<variable_expression*>(expr.callee.get());
+        if (!callee || callee->resolved.is_local())
+            throw unsupported_node{};
+
+        // A callee that is already defined as something else, such as a native function, would always bail out
+        literal_value current = _globals->lookup(callee->ident_name.name());
+        if (!current.is_undefined())
+        {
+            user_function* function = current.is_callable() ? dynamic_cast<user_function*>(current.as_callable()) : nullptr;
+            if (!function || !function->is_plain_function())
+                throw unsupported_node{};
+        }
+
+        // The arguments are stored in consecutive words, the first one at the lowest address
+        size_t count = expr.arguments.size();
+        int last = _frame_words + static_cast<int>(count) - 1;
+        _frame_words += static_cast<int>(count);
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            compile(expr.arguments[i]);
+            _assembler.store(reg::rbp, offset(last - static_cast<int>(i)), reg::rax);
+        }
+
+        _assembler.load(reg::rdi, reg::rbp, self_offset);
+        _assembler.mov(reg::rsi, reinterpret_cast<uint64>(callee->ident_name.name()));
+        _assembler.lea(reg::rdx, reg::rbp, offset(last));
+        _assembler.mov(reg::rcx, static_cast<uint64>(count));
+        call_helper(reinterpret_cast<const void*>(&jit::call_global));
+        bail_if_bailed();
+    }
+
+    virtual void visit_get(get_expression&) override { throw unsupported_node{}; }
+    virtual void visit_set(set_expression&) override { throw unsupported_node{}; }
+    virtual void visit_this(this_expression&) override { throw unsupported_node{}; }
+    virtual void visit_super(super_expression&) override { throw unsupported_node{}; }
+
+private:
+    struct loop
+    {
+        x64_label* break_target;
+        x64_label* continue_target;
+    };
+
+    static constexpr int32 self_offset = -8;
+    static constexpr int32 scratch_offset = -16;
+    static constexpr int first_local = 2;
+
+    environment* _globals;
+    x64_assembler _assembler;
+    // The frame word of every slot of the scopes the resolver saw, innermost last
+    std::vector<std::vector<int>> _scopes;
+    std::vector<loop> _loops;
+    x64_label _bail;
+    int _frame_words;
+    // Values pushed on the native stack that haven't been popped yet
+    int _pushed;
+
+    static int32 offset(int word) { return -8 * (word + 1); }
+
+    int allocate_word() { return _frame_words++; }
+
+    void compile(const unique_ptr_t<expression>& expr)
+    {
+        expr->accept_visitor(*this);
+    }
+
+    // Variables of an enclosing function are not in this frame
+    int local_word(const variable_slot& resolved) const
+    {
+        if (!resolved.is_local() || resolved.depth >= static_cast<int>(_scopes.size()))
+            throw unsupported_node{};
+
+        const std::vector<int>& scope = _scopes[_scopes.size() - 1 - static_cast<size_t>(resolved.depth)];
+        size_t slot = static_cast<size_t>(resolved.slot);
+
+        if (slot >= scope.size() || scope[slot] < 0)
+            throw unsupported_node{};
+
+        return scope[slot];
+    }
+
+    void push_rax()
+    {
+        _assembler.push(reg::rax);
+        ++_pushed;
+    }
+
+    void pop(reg r)
+    {
+        _assembler.pop(r);
+        --_pushed;
+    }
+
+    // Helpers are called with the stack aligned to 16 bytes, as the ABI wants
+    void call_helper(const void* helper)
+    {
+        bool pad = _pushed % 2 != 0;
+
+        if (pad)
+            _assembler.sub(reg::rsp, 8);
+
+        _assembler.mov(reg::r11, reinterpret_cast<uint64>(helper));
+        _assembler.call(reg::r11);
+
+        if (pad)
+            _assembler.add(reg::rsp, 8);
+    }
+
+    void bail_if_bailed()
+    {
+        _assembler.mov(reg::rcx, bail_bits);
+        _assembler.cmp(reg::rax, reg::rcx);
+        _assembler.jcc(x64_condition::equal, _bail);
+    }
+
+    // Jumps to target when rax is falsy and falls through when it is truthy, leaving rax as it was
+    void branch_if_falsy(x64_label& target)
+    {
+        x64_assembler& a = _assembler;
+        x64_label truthy;
+
+        a.mov(reg::rcx, nan_boxing::true_bits);
+        a.cmp(reg::rax, reg::rcx);
+        a.jcc(x64_condition::equal, truthy);
+        a.mov(reg::rcx, nan_boxing::false_bits);
+        a.cmp(reg::rax, reg::rcx);
+        a.jcc(x64_condition::equal, target);
+
+        a.store(reg::rbp, scratch_offset, reg::rax);
+        a.mov(reg::rdi, reg::rax);
+        call_helper(reinterpret_cast<const void*>(&truthy_helper));
+        a.mov(reg::rcx, 2);
+        a.cmp(reg::rax, reg::rcx);
+        a.jcc(x64_condition::equal, _bail);
+        a.test(reg::rax, reg::rax);
+        a.load(reg::rax, reg::rbp, scratch_offset);
+        a.jcc(x64_condition::equal, target);
+
+        a.bind(truthy);
+    }
+
+    // Sign extends the 48 bit payload of the integer in src
+    void untag_integer(reg dst, reg src)
+    {
+        _assembler.mov(dst, src);
+        _assembler.shl(dst, 16);
+        _assembler.sar(dst, 16);
+    }
+
+    // Boxes the integer in rdx into rax, or jumps to slow when it doesn't fit in the payload
+    void box_integer(x64_label& slow)
+    {
+        x64_assembler& a = _assembler;
+
+        untag_integer(reg::r9, reg::rdx);
+        a.cmp(reg::r9, reg::rdx);
+        a.jcc(x64_condition::not_equal, slow);
+
+        a.mov(reg::r9, nan_boxing::payload_mask);
+        a.and_(reg::rdx, reg::r9);
+        a.mov(reg::rax, integer_bits);
+        a.or_(reg::rax, reg::rdx);
+    }
+
+    // Operands of 48 bits can't overflow 64 bits when added or subtracted
+    void arithmetic(void (x64_assembler::*operation)(reg, reg), x64_label& slow)
+    {
+        (_assembler.*operation)(reg::rdx, reg::r8);
+        box_integer(slow);
+    }
+
+    void compare(x64_condition condition)
+    {
+        _assembler.cmp(reg::rdx, reg::r8);
+        set_bool(condition);
+    }
+
+    // Turns the flags of the last comparison into a bool in rax
+    void set_bool(x64_condition condition)
+    {
+        _assembler.set(condition, reg::rax);
+        _assembler.mov(reg::rdx, nan_boxing::false_bits);
+        _assembler.or_(reg::rax, reg::rdx);
+    }
+
+    // ++ and -- on the local in word, leaving the old value in rax for postfix and the new one otherwise
+    void increment(int word, bool decrement, bool postfix)
+    {
+        x64_assembler& a = _assembler;
+        x64_label slow;
+        x64_label done;
+
+        a.load(reg::rax, reg::rbp, offset(word));
+        a.mov(reg::rcx, reg::rax);
+        a.shr(reg::rcx, 48);
+        a.mov(reg::rdx, integer_bits >> 48);
+        a.cmp(reg::rcx, reg::rdx);
+        a.jcc(x64_condition::not_equal, slow);
+
+        // Keep the old value in rcx while the new one is boxed into rax
+        a.mov(reg::rcx, reg::rax);
+        untag_integer(reg::rdx, reg::rax);
+        if (decrement)
+            a.sub(reg::rdx, 1);
+        else
+            a.add(reg::rdx, 1);
+        box_integer(slow);
+        a.store(reg::rbp, offset(word), reg::rax);
+        if (postfix)
+            a.mov(reg::rax, reg::rcx);
+        a.jmp(done);
+
+        a.bind(slow);
+        a.load(reg::rdi, reg::rbp, offset(word));
+        a.store(reg::rbp, scratch_offset, reg::rdi);
+        a.mov(reg::rsi, static_cast<uint64>(decrement));
+        call_helper(reinterpret_cast<const void*>(&increment_helper));
+        bail_if_bailed();
+        a.store(reg::rbp, offset(word), reg::rax);
+        if (postfix)
+            a.load(reg::rax, reg::rbp, scratch_offset);
+        a.bind(done);
+    }
+};
+
+jit::jit(environment* globals)
+    : _globals(globals)
+    , _functions()
+    , _stats()
+    , _native_depth(0) { }
+
+jit::~jit()
+{
+#if CPPLOX_JIT_SUPPORTED
+    for (const std::unique_ptr<jit_function>& function : _functions)
+    {
+        if (function->memory)
+            munmap(function->memory, function->size);
+    }
+#endif
+}
+
+bool jit::supported() noexcept
+{
+    return CPPLOX_JIT_SUPPORTED;
+}
+
+bool jit::try_call(function_declaration_statement& declaration, const std::vector<literal_value>& args, literal_value& result)
+{
+    jit_function* function = declaration.jit_code;
+
+    if (!function)
+    {
+        // A function that could never be compiled, such as one that assigns a global, is rejected on its
+        // first call so that neither its calls nor its loops are counted from then on
+        if (declaration.hotness == 0 && !compilable(declaration))
+        {
+            ++_stats.rejected;
+            add_function(declaration);
+            return false;
+        }
+
+        if (++declaration.hotness < hot_threshold)
+            return false;
+
+        function = &compile(declaration);
+    }
+
+    if (!function->code)
+        return false;
+
+    // A literal_value is exactly its bits
+    uint64 bits = run(*function, reinterpret_cast<const uint64*>(args.data()));
+    if (bits == bail_bits)
+        return false;
+
+    result = literal_value::from_bits(bits);
+    return true;
+}
+
+void jit::print_stats(std::ostream& os) const
+{
+    os << "[ JIT Stats ]\n";
+    os << "  compiled:      " << _stats.compiled << " (" << _stats.code_bytes << " bytes)\n";
+    os << "  rejected:      " << _stats.rejected << '\n';
+    os << "  native calls:  " << _stats.native_calls << '\n';
+    os << "  bailouts:      " << _stats.bailouts << '\n';
+    os << "  disabled:      " << _stats.disabled << '\n';
+}
+
+bool jit::compilable(function_declaration_statement& declaration) const
+{
+    if (!supported())
+        return false;
+
+    // Whatever the compiler rejects, apart from calls of globals defined later, it rejects on every try
+    try
+    {
+        compiler c(_globals);
+        c.compile(declaration);
+        return true;
+    }
+    catch (const unsupported_node&)
+    {
+        return false;
+    }
+}
+
+jit_function& jit::add_function(function_declaration_statement& declaration)
+{
+    _functions.push_back(std::make_unique<jit_function>());
+    jit_function& function = *_functions.back();
+    function.name = std::string(declaration.ident_name.lexeme());
+    declaration.jit_code = &function;
+    return function;
+}
+
+jit_function& jit::compile(function_declaration_statement& declaration)
+{
+    jit_function& function = add_function(declaration);
+
+    if (!supported())
+    {
+        ++_stats.rejected;
+        return function;
+    }
+
+    try
+    {
+        compiler c(_globals);
+        install(function, c.compile(declaration));
+    }
+    catch (const unsupported_node&)
+    {
+        ++_stats.rejected;
+    }
+
+    return function;
+}
+
+void jit::install(jit_function& function, const std::vector<uint8>& code)
+{
+#if CPPLOX_JIT_SUPPORTED
+    size_t page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    size_t size = (code.size() + page - 1) / page * page;
+
+    // Written while it is writable and only made executable afterwards, never both at once
+    void* memory = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (memory == MAP_FAILED)
+    {
+        ++_stats.rejected;
+        return;
+    }
+
+    std::memcpy(memory, code.data(), code.size());
+
+    if (mprotect(memory, size, PROT_READ | PROT_EXEC) != 0)
+    {
+        munmap(memory, size);
+        ++_stats.rejected;
+        return;
+    }
+
+    function.memory = memory;
+    function.size = size;
+    function.code = reinterpret_cast<uint64 (*)(jit*, const uint64*)>(memory);
+    ++_stats.compiled;
+    _stats.code_bytes += code.size();
+
+    // perf looks up the symbols of code outside of any mapped file in /tmp/perf-<pid>.map
+    std::ofstream perf_map("/tmp/perf-" + std::to_string(getpid()) + ".map", std::ios::app);
+    if (perf_map)
+        perf_map << std::hex << reinterpret_cast<uintptr_t>(memory) << ' ' << code.size() << std::dec << " lox:" << function.name << '\n';
+#else
+    ++_stats.rejected;
+#endif
+}
+
+uint64 jit::run(jit_function& function, const uint64* args)
+{
+    if (_native_depth >= max_native_depth)
+        return bail_bits;
+
+    ++_stats.native_calls;
+    ++_native_depth;
+    uint64 result = function.code(this, args);
+    --_native_depth;
+
+    if (result == bail_bits)
+    {
+        ++_stats.bailouts;
+
+        // The code stays mapped, it may still be running further up the native stack
+        if (++function.bailouts >= max_bailouts && function.code)
+        {
+            function.code = nullptr;
+            ++_stats.disabled;
+        }
+    }
+
+    return result;
+}
+
+uint64 jit::get_global(jit* self, const symbol* name)
+{
+    return self->_globals->lookup(name).raw_bits();
+}
+
+uint64 jit::call_global(jit* self, const symbol* name, const uint64* args, uint64 count)
+{
+    literal_value callee = self->_globals->lookup(name);
+    if (!callee.is_callable())
+        return bail_bits;
+
+    // Anything but a plain user function, such as a native function, might have an effect
+    user_function* function = dynamic_cast<user_function*>(callee.as_callable());
+    if (!function || !function->is_plain_function() || function->arity() != static_cast<int>(count))
+        return bail_bits;
+
+    jit_function* code = function->declaration.jit_code;
+    if (!code)
+        code = &self->compile(function->declaration);
+
+    if (!code->code)
+        return bail_bits;
+
+    return self->run(*code, args);
+}
+
+NAMESPACE_END
@@ -1,74 +1,153 @@
 #include "lexer.h"
+#include "char_scan.h"
 #include "console_io.h"
 #include "debug_timer.h"
+#include "memory_manager.h"
+#include "source_manager.h"
+#include "symbol_table.h"
 #include "typedefs.h"
 #include "tokens.h"
-#include <cctype>
+#include <array>
+#include <charconv>
 #include <optional>
 #include <vector>
 #include <string>
+#include <string_view>
 #include <sstream>
-#include <unordered_map>
 
 NAMESPACE_BEGIN(cpplox)
 
-const std::unordered_map<char, token(lexer::*)(void)> lexer::char_to_lexer_func_map =
-{
-    { '(',  &lexer::left_paren     },
-    { ')',  &lexer::right_paren    },
-    { '{',  &lexer::left_brace     },
-    { '}',  &lexer::right_brace    },
-    { ',',  &lexer::comma          },
-    { '.',  &lexer::dot            },
-    { '-',  &lexer::minus          },
-    { '+',  &lexer::plus           },
-    { ';',  &lexer::semicolon      },
-    { ':',  &lexer::colon          },
-    { '?',  &lexer::question       },
-    { '%',  &lexer::modulo         },
-    { '/',  &lexer::slash          },
-    { '*',  &lexer::star           },
-    { '!',  &lexer::bang           },
-    { '=',  &lexer::equal          },
-    { '>',  &lexer::greater        },
-    { '<',  &lexer::less           },
-    { '"',  &lexer::string         },
-};
-
-const std::unordered_map<std::string, token_type> lexer::reserved_keyword_lookup =
-{
-    { "and",      token_type::and_      },
-    { "or",       token_type::or_       },
-    { "if",       token_type::if_       },
-    { "else",     token_type::else_     },
-    { "class",    token_type::class_    },
-    { "false",    token_type::false_    },
-    { "true",     token_type::true_     },
-    { "func",     token_type::func_     },
-    { "null",     token_type::null_     },
-    { "return",   token_type::return_   },
-    { "super",    token_type::super_    },
-    { "this",     token_type::this_     },
-    { "var",      token_type::var_      },
-    { "for",      token_type::for_      },
-    { "while",    token_type::while_    },
-    { "break",    token_type::break_    },
-    { "continue", token_type::continue_ },
-    { "static",   token_type::static_   },
-
-    { "debug",    token_type::debug_    },
-};
-
-lexer::lexer(const std::string& input, console_io* io)
+namespace
+{
+    struct keyword
+    {
+        std::string_view text;
+        token_type type;
+    };
+
+    constexpr keyword keywords[] =
+    {
+        { "and",      token_type::and_      },
+        { "or",       token_type::or_       },
+        { "if",       token_type::if_       },
+        { "else",     token_type::else_     },
+        { "class",    token_type::class_    },
+        { "false",    token_type::false_    },
+        { "true",     token_type::true_     },
+        { "func",     token_type::func_     },
+        { "null",     token_type::null_     },
+        { "return",   token_type::return_   },
+        { "super",    token_type::super_    },
+        { "this",     token_type::this_     },
+        { "var",      token_type::var_      },
+        { "for",      token_type::for_      },
+        { "while",    token_type::while_    },
+        { "break",    token_type::break_    },
+        { "continue", token_type::continue_ },
+        { "static",   token_type::static_   },
+
+        { "debug",    token_type::debug_    },
+    };
+
+    constexpr size_t keyword_table_size = 32;
+
+    // Length, first and last character are enough to tell the keywords apart.  The multipliers were
+    // picked so that no two keywords share a slot, make_keyword_table() fails to compile otherwise.
+    constexpr size_t keyword_hash(std::string_view text)
+    {
+        return (text.size() + static_cast<unsigned char>(text.front()) * 7 + static_cast<unsigned char>(text.back()) * 9) % keyword_table_size;
+    }
+
+    constexpr std::array<keyword, keyword_table_size> make_keyword_table()
+    {
+        std::array<keyword, keyword_table_size> table{};
+
+        for (const keyword& k : keywords)
+        {
+            keyword& slot = table[keyword_hash(k.text)];
+            if (!slot.text.empty())
+                throw "two keywords hash to the same slot";
+
+            slot = k;
+        }
+
+        return table;
+    }
+
+    constexpr std::array<keyword, keyword_table_size> keyword_table = make_keyword_table();
+
+    // One hash and at most one comparison, identifiers are never copied
+    constexpr token_type identifier_type(std::string_view text)
+    {
+        const keyword& k = keyword_table[keyword_hash(text)];
+        return k.text == text ? k.type : token_type::identifier_;
+    }
+
+    static_assert(identifier_type("continue") == token_type::continue_);
+    static_assert(identifier_type("contains") == token_type::identifier_);
+}
+
+constexpr std::array<lexer::token_handler, 256> lexer::make_char_dispatch()
+{
+    std::array<token_handler, 256> table{};
+    table.fill(&lexer::invalid_token);
+
+    for (int c = 0; c < 256; ++c)
+    {
+        if (is_whitespace(static_cast<char>(c)))
+            table[c] = &lexer::whitespace;
+        else if (is_identifier_start(static_cast<char>(c)))
+            table[c] = &lexer::identifier;
+        else if (is_digit(static_cast<char>(c)))
+            table[c] = &lexer::number;
+    }
+
+    table['('] = &lexer::left_paren;
+    table[')'] = &lexer::right_paren;
+    table['{'] = &lexer::left_brace;
+    table['}'] = &lexer::right_brace;
+    table[','] = &lexer::comma;
+    table['.'] = &lexer::dot;
+    table['-'] = &lexer::minus;
+    table['+'] = &lexer::plus;
+    table[';'] = &lexer::semicolon;
+    table[':'] = &lexer::colon;
+    table['?'] = &lexer::question;
+    table['%'] = &lexer::modulo;
+    table['/'] = &lexer::slash;
+    table['*'] = &lexer::star;
+    table['!'] = &lexer::bang;
+    table['='] = &lexer::equal;
+    table['>'] = &lexer::greater;
+    table['<'] = &lexer::less;
+    table['"'] = &lexer::string;
+
+    return table;
+}
+
+constexpr std::array<lexer::token_handler, 256> lexer::char_dispatch = lexer::make_char_dispatch();
+
+lexer::lexer(const std::string& input, console_io* io, lexer_mode mode)
     : _lexer_state()
     , _tokens()
+    , _mode(mode)
+    , _next_token(0)
+    , _bof_returned(false)
     , _lexer_error(false)
     , _io(io)
 {
     debug_timer dt("lexer::lexer()");
 
-    _lexer_state.input = std::move(input);
-    tokenize();
+    // Tokens are handed out while the rest of the session runs, during which nothing else may add a source
+    if (_mode == lexer_mode::streaming)
+        create_dummy_token(token_type::bof_);
+
+    source_manager& sources = source_manager::instance();
+    _lexer_state.base = sources.add_source(input);
+    _lexer_state.input = sources.text(_lexer_state.base, static_cast<uint32>(input.size()));
+
+    if (_mode == lexer_mode::eager)
+        tokenize();
 
     dt.stop();
 }
@@ -78,6 +157,35 @@ const std::vector<token>& lexer::get_tokens() const noexcept
     return _tokens;
 }
 
+token lexer::next_token()
+{
+    if (_mode == lexer_mode::eager)
+    {
+        token t = _tokens[_next_token];
+        if (_next_token + 1 < _tokens.size())
+            ++_next_token;
+
+        return t;
+    }
+
+    if (!_bof_returned)
+    {
+        _bof_returned = true;
+        return create_token(token_type::bof_);
+    }
+
+    while (true)
+    {
+        token t = scan_token();
+        if (t.type != token_type::invalid_)
+            return t;
+
+        _lexer_error = true;
+        if (_io)
+            _io->err() << format_error(t) << '\n';
+    }
+}
+
 bool lexer::error_occurred() const noexcept
 {
     return _lexer_error;
@@ -93,18 +201,14 @@ void lexer::tokenize()
     _tokens.reserve(_lexer_state.input.size() / 3);
     _tokens.push_back(create_token(token_type::bof_));
 
-    size_t input_size = _lexer_state.input.size();
-    _lexer_state.current_source_line = extract_source_line(_lexer_state.input, _lexer_state.right_ptr);
-
     std::vector<token> invalid_tokens;
 
-    while (_lexer_state.right_ptr < input_size)
+    while (true)
     {
-        token next_token = fetch_token();
-        _lexer_state.current_pos += static_cast<uint32>(next_token.lexeme.size());
+        token next_token = scan_token();
 
-        if (next_token.type == token_type::ignore_)
-            continue;
+        if (next_token.type == token_type::eof_)
+            break;
 
         if (next_token.type == token_type::invalid_)
         {
@@ -128,62 +232,44 @@ void lexer::tokenize()
     _tokens.push_back(create_token(token_type::eof_));
 }
 
-std::string lexer::format_error(const token& t) const
+token lexer::scan_token()
 {
-    std::stringstream ss;
-    ss << t.source_line << '\n';
-    for (size_t i = 0; i < t.position.second - 1; ++i)
-        ss << ' ';
-    ss << '^' << "--- ";
+    size_t input_size = _lexer_state.input.size();
 
-    ss << "Unexpected character '" << t.lexeme << "' at line/col [" << t.position.first
-        << ":" << t.position.second << "]";
+    while (_lexer_state.right_ptr < input_size)
+    {
+        token next_token = fetch_token();
 
-    return ss.str();
+        if (next_token.type != token_type::ignore_)
+            return next_token;
+    }
+
+    return create_token(token_type::eof_);
 }
 
-std::string_view lexer::extract_source_line(std::string_view source, size_t index)
+std::string lexer::format_error(const token& t) const
 {
-    size_t line_start = source.rfind('\n', index);
-    if (line_start == std::string::npos)
-        line_start = 0;
-    else
-        ++line_start;
+    coord position = t.position();
+
+    std::stringstream ss;
+    ss << t.source_line() << '\n';
+    for (size_t i = 0; i < position.second - 1; ++i)
+        ss << ' ';
+    ss << '^' << "--- ";
 
-    size_t line_end = source.find('\n', index);
-    if (line_end == std::string::npos)
-        line_end = source.size();
+    ss << "Unexpected character '" << t.lexeme() << "' at line/col [" << position.first
+        << ":" << position.second << "]";
 
-    return source.substr(line_start, line_end - line_start);
+    return ss.str();
 }
 
 token lexer::fetch_token()
 {
     _lexer_state.left_ptr = _lexer_state.right_ptr;
-    std::optional<char> current_char = advance_lexer();
-
-    if (current_char.has_value())
-    {
-        if (isalpha(*current_char) || *current_char == '_')
-        {
-            return identifier();
-        }
-        else if (isdigit(*current_char))
-        {
-            return number();
-        }
-        else if (std::isspace((unsigned char)*current_char))
-        {
-            return create_token(token_type::ignore_);
-        }
 
-        auto char_map_find = char_to_lexer_func_map.find(*current_char);
-        if (char_map_find != char_to_lexer_func_map.end())
-        {
-            return (this->*char_map_find->second)();
-        }
-    }
-    return create_token(token_type::invalid_);
+    // The handler is picked by the first character, which has been consumed when it runs
+    unsigned char current_char = static_cast<unsigned char>(*advance_lexer());
+    return (this->*char_dispatch[current_char])();
 }
 
 std::optional<char> lexer::advance_lexer()
@@ -195,14 +281,7 @@ std::optional<char> lexer::advance_lexer()
     ++_lexer_state.right_ptr;
 
     if (c == '\n')
-    {
-        ++_lexer_state.current_line;
-        _lexer_state.current_source_line = extract_source_line(_lexer_state.input, _lexer_state.right_ptr);
-
-        // We need to set the current_pos as one less than the default value of 1, because the tokenize method will
-        // increment the current_pos by the length of the token (in this case 1, putting the current_pos at the proper value)
-        _lexer_state.current_pos = 0;
-    }
+        source_manager::instance().add_line_start(_lexer_state.base + _lexer_state.right_ptr);
 
     return c;
 }
@@ -215,6 +294,29 @@ std::optional<char> lexer::peek_next()
     return _lexer_state.input[_lexer_state.right_ptr];
 }
 
+const char* lexer::cursor() const noexcept
+{
+    return _lexer_state.input.data() + _lexer_state.right_ptr;
+}
+
+const char* lexer::input_end() const noexcept
+{
+    return _lexer_state.input.data() + _lexer_state.input.size();
+}
+
+void lexer::advance_to(const char* position) noexcept
+{
+    _lexer_state.right_ptr = static_cast<uint32>(position - _lexer_state.input.data());
+}
+
+void lexer::add_line_starts(const char* first, const char* last)
+{
+    source_manager& sources = source_manager::instance();
+
+    for (const char* newline = find_char(first, last, '\n'); newline != last; newline = find_char(newline + 1, last, '\n'))
+        sources.add_line_start(_lexer_state.base + static_cast<uint32>(newline + 1 - _lexer_state.input.data()));
+}
+
 bool lexer::advance_if_next_matches(char c)
 {
     if (peek_next() == c)
@@ -226,11 +328,9 @@ bool lexer::advance_if_next_matches(char c)
     return false;
 }
 
-token lexer::create_token(token_type type, const literal_value& literal)
+token lexer::create_token(token_type type, uint32 payload)
 {
-    uint32 len = extract_lexeme_length();
-    std::string lexeme = _lexer_state.input.substr(_lexer_state.left_ptr, len);
-    return token{ type, lexeme, literal, { _lexer_state.current_line, _lexer_state.current_pos }, _lexer_state.current_source_line };
+    return token{ type, _lexer_state.base + _lexer_state.left_ptr, extract_lexeme_length(), payload };
 }
 
 uint32 lexer::extract_lexeme_length() const noexcept
@@ -328,40 +428,33 @@ token lexer::slash()
         }
         case '/':
         {
-            advance_lexer();
-
-            while (peek_next().has_value() && *peek_next() != '\n')
-                advance_lexer();
-
+            // The newline ending the comment is left for whitespace()
+            advance_to(find_char(cursor() + 1, input_end(), '\n'));
             return create_token(token_type::ignore_);
         }
         case '*':
         {
-            advance_lexer();
+            const char* body = cursor() + 1;
+            const char* end = body;
 
             while (true)
             {
+                end = find_char(end, input_end(), '*');
+
                 // Hit end of input
-                if (!peek_next().has_value())
+                if (end == input_end())
                     break;
 
                 // End of block comment
-                if (*peek_next() == '*')
+                if (++end != input_end() && *end == '/')
                 {
-                    advance_lexer();
-
-                    if (peek_next().has_value() && *peek_next() == '/')
-                    {
-                        advance_lexer();
-                        break;
-                    }
-                }
-                else
-                {
-                    advance_lexer();
+                    ++end;
+                    break;
                 }
             }
 
+            add_line_starts(body, end);
+            advance_to(end);
             return create_token(token_type::ignore_);
         }
     }
@@ -411,35 +504,30 @@ token lexer::less()
 
 token lexer::identifier()
 {
-    while (peek_next().has_value() && (isalnum(*peek_next()) || *peek_next() == '_'))
-    {
-        advance_lexer();
-    }
+    advance_to(skip_identifier(cursor(), input_end()));
 
-    std::string substr = _lexer_state.input.substr(_lexer_state.left_ptr, extract_lexeme_length());
-    auto reserved_keyword = reserved_keyword_lookup.find(substr);
-    if (reserved_keyword != reserved_keyword_lookup.end())
-    {
-        return create_token(reserved_keyword->second);
-    }
+    std::string_view lexeme = _lexer_state.input.substr(_lexer_state.left_ptr, extract_lexeme_length());
+    token_type type = identifier_type(lexeme);
+    if (type != token_type::identifier_)
+        return create_token(type);
 
-    return create_token(token_type::identifier_);
+    return create_token(type, symbol_table::instance().intern(lexeme)->id);
 }
 
 token lexer::string()
 {
-    while (peek_next().has_value() && peek_next() != '"')
-    {
-        advance_lexer();
-    }
+    const char* closing_quote = find_char(cursor(), input_end(), '"');
+    add_line_starts(cursor(), closing_quote);
+    advance_to(closing_quote);
 
-    if (peek_next().has_value() && peek_next() == '"')
+    if (closing_quote != input_end())
     {
-        advance_lexer();
+        ++_lexer_state.right_ptr;
         uint32 literal_len = extract_lexeme_length() - 2;
-        std::string str = _lexer_state.input.substr(_lexer_state.left_ptr + 1, literal_len);
+        std::string_view text = _lexer_state.input.substr(_lexer_state.left_ptr + 1, literal_len);
+        cpplox_string* literal = memory_manager::instance().intern_string(text);
 
-        return create_token(token_type::string_, str);
+        return create_token(token_type::string_, source_manager::instance().add_literal(literal));
     }
 
     // Unterminated string
@@ -448,23 +536,35 @@ token lexer::string()
 
 token lexer::number()
 {
-    while (peek_next().has_value() && isdigit(*peek_next()))
-    {
-        advance_lexer();
-    }
+    advance_to(skip_digits(cursor(), input_end()));
+
+    const char* first = _lexer_state.input.data() + _lexer_state.left_ptr;
 
     if (peek_next() == '.')
     {
-        advance_lexer();
-        while (peek_next().has_value() && isdigit(*peek_next()))
-        {
-            advance_lexer();
-        }
+        ++_lexer_state.right_ptr;
+        advance_to(skip_digits(cursor(), input_end()));
+    }
+    else
+    {
+        // Literals without a fraction are integers, unless they are too large for one
+        int64 i = 0;
+        auto [end, error] = std::from_chars(first, first + extract_lexeme_length(), i);
+        if (error == std::errc{} && i <= nan_boxing::max_integer)
+            return create_token(token_type::number_, source_manager::instance().add_literal(i));
     }
 
-    uint32 len = extract_lexeme_length();
-    double d = std::stod(_lexer_state.input.substr(_lexer_state.left_ptr, len));
-    return create_token(token_type::number_, d);
+    double d = 0.0;
+    std::from_chars(first, first + extract_lexeme_length(), d);
+    return create_token(token_type::number_, source_manager::instance().add_literal(d));
+}
+
+token lexer::whitespace()
+{
+    const char* run_end = skip_whitespace(cursor(), input_end());
+    add_line_starts(cursor(), run_end);
+    advance_to(run_end);
+    return create_token(token_type::ignore_);
 }
 
 token lexer::invalid_token()
@@ -2,10 +2,48 @@
 #include "environment.h"
 #include "typedefs.h"
 #include "cpplox_types.h"
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <limits>
+#include <new>
+#include <ostream>
 #include <string>
 
 NAMESPACE_BEGIN(cpplox)
 
+namespace
+{
+    using gc_clock = std::chrono::steady_clock;
+
+    long elapsed_us(gc_clock::time_point start)
+    {
+        return static_cast<long>(std::chrono::duration_cast<std::chrono::microseconds>(gc_clock::now() - start).count());
+    }
+}
+
+void pause_histogram::record(long pause_us)
+{
+    size_t bucket = std::bit_width(static_cast<unsigned long>(std::max(pause_us, 0L)));
+    ++buckets[std::min(bucket, bucket_count - 1)];
+    ++samples;
+}
+
+long pause_histogram::percentile(double fraction) const
+{
+    size_t target = static_cast<size_t>(fraction * static_cast<double>(samples) + 0.5);
+    size_t seen = 0;
+
+    for (size_t i = 0; i < bucket_count; ++i)
+    {
+        seen += buckets[i];
+        if (seen >= target && seen > 0)
+            return 1L << i;
+    }
+
+    return 1L << (bucket_count - 1);
+}
+
 memory_manager& memory_manager::instance()
 {
     static memory_manager instance;
@@ -13,62 +51,636 @@ memory_manager& memory_manager::instance()
 }
 
 memory_manager::memory_manager()
-    : _callables()
-    , _instances()
-    , _environments()
+    : _objects(nullptr)
+    , _young_objects(nullptr)
+    , _sweep_list(nullptr)
+    , _nursery_top(nullptr)
+    , _nursery_end(nullptr)
+    , _nursery_chunks()
+    , _free_chunks()
+    , _remembered_set()
+    , _gray_stack()
+    , _incremental_gray_stack()
+    , _pinned()
+    , _interned_strings()
+    , _root_sources()
+    , _temporaries()
+    , _config()
+    , _stats()
+    , _bytes_allocated(0)
+    , _young_bytes(0)
+    , _retired_chunks(0)
+    , _object_count(0)
+    , _next_collection(_config.initial_threshold)
+    , _cycle_limit(0)
+    , _phase(gc_phase::idle)
+    , _mark_mode(mark_mode::full)
 { }
 
 memory_manager::~memory_manager()
 {
-    for (auto callable : _callables)
-        delete callable;
+    for (heap_object* list : { _objects, _young_objects, _sweep_list })
+    {
+        heap_object* object = list;
+        while (object)
+        {
+            heap_object* next = object->_next_object;
+            destroy(object);
+            object = next;
+        }
+    }
 
-    for (auto instance : _instances)
-        delete instance;
+    for (nursery_chunk* chunk : _nursery_chunks)
+        _free_chunks.push_back(chunk);
 
-    for (auto environment : _environments)
-        delete environment;
+    for (nursery_chunk* chunk : _free_chunks)
+        ::operator delete(chunk, std::align_val_t{ chunk_size });
 }
 
-bool memory_manager::register_callable(cpplox_callable* callable)
+void memory_manager::configure(const gc_config& config)
 {
-    return _callables.insert(callable).second;
+    _config = config;
+    _next_collection = std::max(old_generation_bytes(), _config.initial_threshold);
 }
 
-cpplox_callable* memory_manager::allocate_class(const std::string& name,
-        std::unordered_map<std::string, cpplox_callable*>&& methods, cpplox_class* superclass)
+cpplox_string* memory_manager::allocate_string(std::string&& value)
 {
-    cpplox_callable* new_class = new cpplox_class(name, std::move(methods), superclass);
-    _callables.insert(new_class);
-    return new_class;
+    cpplox_string* new_string = allocate<cpplox_string>(std::move(value));
+    charge(new_string, new_string->_value.capacity());
+    return new_string;
 }
 
-cpplox_callable* memory_manager::allocate_user_function(function_declaration_statement& stmt, environment* env, environment_manager* env_manager, bool is_initializer)
+cpplox_string* memory_manager::concatenate(cpplox_string* lhs, cpplox_string* rhs)
 {
-    cpplox_callable* new_function = new user_function(stmt, env, env_manager, is_initializer);
-    _callables.insert(new_function);
-    return new_function;
+    size_t length = lhs->length() + rhs->length();
+
+    if (length <= flat_concatenation_limit)
+    {
+        std::string text;
+        text.reserve(length);
+        text += lhs->value();
+        text += rhs->value();
+        return allocate_string(std::move(text));
+    }
+
+    // The pieces of a rope being built in a loop stay alive until it is read.  In the nursery, a few of
+    // them promoted in place would keep each chunk they were allocated in from being reused.
+    if (lhs->is_rope() && !rhs->is_rope())
+    {
+        cpplox_string* tail = lhs->_right;
+        if (!tail->is_rope() && tail->length() + rhs->length() <= flat_concatenation_limit)
+        {
+            std::string text;
+            text.reserve(tail->length() + rhs->length());
+            text += tail->value();
+            text += rhs->value();
+
+            cpplox_string* new_tail = allocate_old<cpplox_string>(std::move(text));
+            charge(new_tail, new_tail->_value.capacity());
+            return allocate_old<cpplox_string>(lhs->_left, new_tail);
+        }
+    }
+
+    return allocate_old<cpplox_string>(lhs, rhs);
+}
+
+cpplox_string* memory_manager::intern_string(std::string_view value)
+{
+    const symbol* name = symbol_table::instance().intern(value);
+
+    auto it = _interned_strings.find(name);
+    if (it != _interned_strings.end())
+        return it->second;
+
+    cpplox_string* new_string = allocate_string(std::string(value));
+    new_string->interned = true;
+    _pinned.push_back(new_string);
+    _interned_strings.emplace(name, new_string);
+    return new_string;
+}
+
+cpplox_callable* memory_manager::allocate_class(const std::string& name,
+        symbol_map<cpplox_callable*>&& methods, cpplox_class* superclass)
+{
+    return allocate<cpplox_class>(name, std::move(methods), superclass);
 }
 
 cpplox_instance* memory_manager::allocate_instance(cpplox_class* class_)
 {
-    cpplox_instance* new_instance = new cpplox_instance(class_);
-    _instances.insert(new_instance);
-    return new_instance;
+    return allocate<cpplox_instance>(class_);
 }
 
 environment* memory_manager::allocate_environment()
 {
-    environment* new_environment = new environment();
-    _environments.insert(new_environment);
-    return new_environment;
+    return allocate<environment>();
 }
 
 environment* memory_manager::allocate_environment(environment* parent_scope)
 {
-    environment* new_environment = new environment(parent_scope);
-    _environments.insert(new_environment);
-    return new_environment;
+    return allocate<environment>(parent_scope);
+}
+
+void memory_manager::add_root_source(gc_root_source* source)
+{
+    _root_sources.push_back(source);
+}
+
+void memory_manager::remove_root_source(gc_root_source* source)
+{
+    _root_sources.erase(std::remove(_root_sources.begin(), _root_sources.end(), source), _root_sources.end());
+}
+
+void memory_manager::push_temporary(const literal_value& value)
+{
+    _temporaries.push_back(value);
+}
+
+void memory_manager::truncate_temporaries(size_t count) noexcept
+{
+    _temporaries.resize(count);
+}
+
+size_t memory_manager::temporary_count() const noexcept
+{
+    return _temporaries.size();
+}
+
+void memory_manager::collect()
+{
+    if (_phase != gc_phase::idle)
+    {
+        finish_cycle();
+        return;
+    }
+
+    // Every object gets traced, the remembered set has nothing to add
+    for (heap_object* object : _remembered_set)
+        object->_remembered = false;
+    _remembered_set.clear();
+
+    _mark_mode = mark_mode::full;
+    mark_roots();
+    trace_references();
+    sweep();
+    sweep_young();
+    retire_nursery();
+
+    ++_stats.collections;
+    set_next_collection();
+}
+
+void memory_manager::collect_young()
+{
+    _mark_mode = mark_mode::young;
+    mark_roots();
+
+    for (heap_object* object : _remembered_set)
+    {
+        object->_remembered = false;
+        object->trace(*this);
+    }
+    _remembered_set.clear();
+
+    trace_references();
+    sweep_young();
+    retire_nursery();
+
+    _mark_mode = mark_mode::full;
+    ++_stats.minor_collections;
+}
+
+void memory_manager::mark(heap_object* object)
+{
+    if (!object || object->_marked)
+        return;
+
+    switch (_mark_mode)
+    {
+        case mark_mode::young:
+        {
+            // Old objects are assumed live during a minor collection
+            if (!object->_young)
+                return;
+        } break;
+        case mark_mode::old:
+        {
+            // Young objects are left to the minor collections, their survivors are shaded when promoted
+            if (object->_young)
+                return;
+
+            object->_marked = true;
+            _incremental_gray_stack.push_back(object);
+            return;
+        } break;
+        case mark_mode::full:
+            break;
+    }
+
+    object->_marked = true;
+    _gray_stack.push_back(object);
+}
+
+void memory_manager::mark(const literal_value& value)
+{
+    mark(as_heap_object(value));
+}
+
+const gc_stats& memory_manager::stats() const noexcept
+{
+    return _stats;
+}
+
+void memory_manager::print_stats(std::ostream& os) const
+{
+    os << "[ GC Stats ]\n";
+    os << "mode:              " << (_config.incremental ? "incremental" : "stop the world") << '\n';
+    if (_config.incremental)
+        os << "pause budget:      " << _config.pause_budget_us << "us\n";
+    os << "major collections: " << _stats.collections << '\n';
+    os << "minor collections: " << _stats.minor_collections << '\n';
+    os << "incremental slices: " << _stats.incremental_slices << '\n';
+    os << "total pause:       " << _stats.total_pause_us << "us\n";
+    os << "max pause:         " << _stats.max_pause_us << "us\n";
+    os << "p50 pause:         < " << _stats.pauses.percentile(0.50) << "us\n";
+    os << "p99 pause:         < " << _stats.pauses.percentile(0.99) << "us\n";
+    os << "objects freed:     " << _stats.objects_freed << '\n';
+    os << "objects promoted:  " << _stats.objects_promoted << '\n';
+    os << "bytes freed:       " << _stats.bytes_freed << '\n';
+    os << "peak heap:         " << _stats.peak_bytes << " bytes\n";
+    os << "live heap:         " << _bytes_allocated << " bytes in " << _object_count << " objects\n";
+    os << "pause histogram:\n";
+
+    for (size_t i = 0; i < pause_histogram::bucket_count; ++i)
+    {
+        if (_stats.pauses.buckets[i] == 0)
+            continue;
+
+        os << "  < " << (1L << i) << "us: " << _stats.pauses.buckets[i] << '\n';
+    }
+}
+
+void memory_manager::refill_nursery()
+{
+    nursery_chunk* chunk = nullptr;
+
+    if (!_free_chunks.empty())
+    {
+        chunk = _free_chunks.back();
+        _free_chunks.pop_back();
+    }
+    else
+    {
+        chunk = static_cast<nursery_chunk*>(::operator new(chunk_size, std::align_val_t{ chunk_size }));
+    }
+
+    new (chunk) nursery_chunk();
+    _nursery_chunks.push_back(chunk);
+
+    _nursery_top = reinterpret_cast<std::byte*>(chunk) + chunk_header_size;
+    _nursery_end = reinterpret_cast<std::byte*>(chunk) + chunk_size;
+}
+
+void memory_manager::release_chunk(nursery_chunk* chunk)
+{
+    // Keep enough chunks around to refill the nursery without going back to the system allocator
+    size_t nursery_chunks = _config.nursery_size / chunk_size + 1;
+
+    if (_free_chunks.size() < nursery_chunks)
+        _free_chunks.push_back(chunk);
+    else
+        ::operator delete(chunk, std::align_val_t{ chunk_size });
+}
+
+void memory_manager::retire_nursery()
+{
+    for (nursery_chunk* chunk : _nursery_chunks)
+    {
+        if (chunk->live_objects == 0)
+        {
+            release_chunk(chunk);
+            continue;
+        }
+
+        chunk->retired = true;
+        ++_retired_chunks;
+    }
+
+    _nursery_chunks.clear();
+    _nursery_top = nullptr;
+    _nursery_end = nullptr;
+    _young_bytes = 0;
+}
+
+void memory_manager::track_young(heap_object* object, size_t size)
+{
+    object->_young = true;
+    object->_in_chunk = true;
+    ++chunk_of(object)->live_objects;
+
+    object->_next_object = _young_objects;
+    _young_objects = object;
+    _young_bytes += size;
+
+    object->_size = size;
+    _bytes_allocated += size;
+    ++_object_count;
+    _stats.peak_bytes = std::max(_stats.peak_bytes, _bytes_allocated);
+}
+
+void memory_manager::track_old(heap_object* object, size_t size)
+{
+    object->_next_object = _objects;
+    _objects = object;
+
+    // Whatever the constructor stored in it may be young or white
+    remember(object);
+    shade(object);
+
+    object->_size = size;
+    _bytes_allocated += size;
+    ++_object_count;
+    _stats.peak_bytes = std::max(_stats.peak_bytes, _bytes_allocated);
+}
+
+void memory_manager::charge(heap_object* object, size_t size)
+{
+    object->_size += size;
+    _bytes_allocated += size;
+    if (object->_young)
+        _young_bytes += size;
+
+    _stats.peak_bytes = std::max(_stats.peak_bytes, _bytes_allocated);
+}
+
+void memory_manager::remember(heap_object* object)
+{
+    object->_remembered = true;
+    _remembered_set.push_back(object);
+}
+
+void memory_manager::shade(heap_object* object)
+{
+    if (_phase != gc_phase::marking || object->_marked || object->_young)
+        return;
+
+    object->_marked = true;
+    _incremental_gray_stack.push_back(object);
+}
+
+void memory_manager::destroy(heap_object* object)
+{
+    _bytes_allocated -= object->_size;
+    --_object_count;
+
+    if (!object->_in_chunk)
+    {
+        delete object;
+        return;
+    }
+
+    nursery_chunk* chunk = chunk_of(object);
+    object->~heap_object();
+
+    if (--chunk->live_objects == 0 && chunk->retired)
+    {
+        --_retired_chunks;
+        release_chunk(chunk);
+    }
+}
+
+void memory_manager::collect_garbage()
+{
+    auto start = gc_clock::now();
+
+    if (_phase == gc_phase::idle && old_generation_bytes() >= _next_collection)
+    {
+        if (!_config.incremental)
+        {
+            collect();
+            record_pause(elapsed_us(start));
+            return;
+        }
+
+        begin_cycle();
+    }
+
+    if (_young_bytes >= _config.nursery_size)
+        collect_young();
+
+    if (_phase != gc_phase::idle)
+    {
+        // Give up on bounded pauses rather than letting the heap run away from the collector
+        if (old_generation_bytes() >= _cycle_limit)
+            finish_cycle();
+        else
+            incremental_step(_config.pause_budget_us - elapsed_us(start));
+    }
+
+    record_pause(elapsed_us(start));
+}
+
+void memory_manager::begin_cycle()
+{
+    _phase = gc_phase::marking;
+    _next_collection = std::numeric_limits<size_t>::max();
+    _cycle_limit = std::max(static_cast<size_t>(static_cast<double>(old_generation_bytes()) * _config.growth_factor),
+            old_generation_bytes() + _config.initial_threshold);
+
+    _mark_mode = mark_mode::old;
+    mark_roots();
+    _mark_mode = mark_mode::full;
+}
+
+void memory_manager::incremental_step(long budget_us)
+{
+    ++_stats.incremental_slices;
+
+    if (_phase == gc_phase::marking)
+    {
+        if (trace_incremental(budget_us))
+            finish_marking();
+
+        return;
+    }
+
+    if (sweep_incremental(budget_us))
+    {
+        _phase = gc_phase::idle;
+        ++_stats.collections;
+        set_next_collection();
+    }
+}
+
+bool memory_manager::trace_incremental(long budget_us)
+{
+    // Checking the clock is not free, so the budget is only looked at every few objects
+    static constexpr size_t objects_per_check = 64;
+
+    auto start = gc_clock::now();
+    size_t traced = 0;
+    _mark_mode = mark_mode::old;
+
+    while (!_incremental_gray_stack.empty())
+    {
+        heap_object* object = _incremental_gray_stack.back();
+        _incremental_gray_stack.pop_back();
+        object->trace(*this);
+
+        if (++traced % objects_per_check == 0 && elapsed_us(start) >= budget_us)
+            break;
+    }
+
+    _mark_mode = mark_mode::full;
+    return _incremental_gray_stack.empty();
+}
+
+void memory_manager::finish_marking()
+{
+    // With the nursery empty every root is an old object.  The roots are not covered by the write
+    // barrier, so they are scanned again and whatever they reach is marked in one go.
+    if (_young_objects)
+        collect_young();
+
+    _mark_mode = mark_mode::old;
+    mark_roots();
+    trace_incremental(std::numeric_limits<long>::max());
+
+    _sweep_list = _objects;
+    _objects = nullptr;
+    _phase = gc_phase::sweeping;
+}
+
+bool memory_manager::sweep_incremental(long budget_us)
+{
+    static constexpr size_t objects_per_check = 256;
+
+    auto start = gc_clock::now();
+    size_t swept = 0;
+
+    while (_sweep_list)
+    {
+        heap_object* object = _sweep_list;
+        _sweep_list = object->_next_object;
+
+        if (object->_marked)
+        {
+            object->_marked = false;
+            object->_next_object = _objects;
+            _objects = object;
+        }
+        else
+        {
+            ++_stats.objects_freed;
+            _stats.bytes_freed += object->_size;
+            destroy(object);
+        }
+
+        if (++swept % objects_per_check == 0 && elapsed_us(start) >= budget_us)
+            break;
+    }
+
+    return _sweep_list == nullptr;
+}
+
+void memory_manager::finish_cycle()
+{
+    if (_phase == gc_phase::marking)
+    {
+        trace_incremental(std::numeric_limits<long>::max());
+        finish_marking();
+    }
+
+    sweep_incremental(std::numeric_limits<long>::max());
+    _phase = gc_phase::idle;
+    ++_stats.collections;
+    set_next_collection();
+}
+
+void memory_manager::mark_roots()
+{
+    for (gc_root_source* source : _root_sources)
+        source->mark_roots(*this);
+
+    for (const literal_value& value : _temporaries)
+        mark(value);
+
+    for (heap_object* object : _pinned)
+        mark(object);
+}
+
+void memory_manager::trace_references()
+{
+    while (!_gray_stack.empty())
+    {
+        heap_object* object = _gray_stack.back();
+        _gray_stack.pop_back();
+        object->trace(*this);
+    }
+}
+
+void memory_manager::sweep()
+{
+    heap_object** link = &_objects;
+
+    while (*link)
+    {
+        heap_object* object = *link;
+
+        if (object->_marked)
+        {
+            object->_marked = false;
+            link = &object->_next_object;
+            continue;
+        }
+
+        *link = object->_next_object;
+        ++_stats.objects_freed;
+        _stats.bytes_freed += object->_size;
+        destroy(object);
+    }
+}
+
+void memory_manager::sweep_young()
+{
+    heap_object* object = _young_objects;
+    _young_objects = nullptr;
+
+    while (object)
+    {
+        heap_object* next = object->_next_object;
+
+        if (object->_marked)
+        {
+            // Survivors are promoted where they are, and start out gray if the old generation is being marked
+            object->_marked = false;
+            object->_young = false;
+            object->_next_object = _objects;
+            _objects = object;
+            shade(object);
+            ++_stats.objects_promoted;
+        }
+        else
+        {
+            ++_stats.objects_freed;
+            _stats.bytes_freed += object->_size;
+            destroy(object);
+        }
+
+        object = next;
+    }
+}
+
+void memory_manager::set_next_collection()
+{
+    _next_collection = std::max(static_cast<size_t>(static_cast<double>(old_generation_bytes()) * _config.growth_factor),
+            _config.initial_threshold);
+}
+
+void memory_manager::record_pause(long pause_us)
+{
+    _stats.total_pause_us += pause_us;
+    _stats.max_pause_us = std::max(_stats.max_pause_us, pause_us);
+    _stats.pauses.record(pause_us);
 }
 
 NAMESPACE_END
@@ -0,0 +1,418 @@
+#include "optimizer.h"
+#include "cpplox_types.h"
+#include "debug_timer.h"
+#include "exceptions.h"
+#include "expressions.h"
+#include "memory_manager.h"
+#include "statements.h"
+#include "tokens.h"
+#include "typedefs.h"
+#include <cmath>
+#include <cstddef>
+#include <memory>
+
+NAMESPACE_BEGIN(cpplox)
+
+namespace
+{
+    literal_expression* as_literal(const unique_ptr_t<expression>& expr)
+    {
+        return dynamic_cast<literal_expression*>(expr.get());
+    }
+
+    // A number literal equal to value, but not -0, which behaves differently from 0 in x - 0
+    bool is_number_literal(const unique_ptr_t<expression>& expr, double value)
+    {
+        literal_expression* literal = as_literal(expr);
+        if (!literal || !literal->literal_val.is_number())
+            return false;
+
+        double number = literal->literal_val.as_number();
+        return number == value && !std::signbit(number);
+    }
+
+    // Whether expr evaluates to a number whenever it doesn't raise an error
+    bool yields_number(const unique_ptr_t<expression>& expr)
+    {
+        if (literal_expression* literal = as_literal(expr))
+            return literal->literal_val.is_number();
+
+        if (unary_expression* unary = dynamic_cast<unary_expression*>(expr.get()))
+            return unary->oper.type != token_type::bang_;
+
+        if (dynamic_cast<postfix_expression*>(expr.get()))
+            return true;
+
+        if (binary_expression* binary = dynamic_cast<binary_expression*>(expr.get()))
+        {
+            switch (binary->oper.type)
+            {
+                case token_type::minus_:
+                case token_type::star_:
+                case token_type::slash_:
+                case token_type::modulo_:
+                    return true;
+                case token_type::plus_:
+                    return yields_number(binary->expr_lhs) && yields_number(binary->expr_rhs);
+                default:
+                    return false;
+            }
+        }
+
+        return false;
+    }
+
+    // Whether evaluating expr can neither fail nor have an effect
+    bool is_pure(const unique_ptr_t<expression>& expr)
+    {
+        if (as_literal(expr) || dynamic_cast<this_expression*>(expr.get()))
+            return true;
+
+        // Globals are looked up by name and fail if they were never defined, and so does a local declared
+        // without an initializer until it is assigned
+        if (variable_expression* variable = dynamic_cast<variable_expression*>(expr.get()))
+            return variable->resolved.is_local() && variable->initialized;
+
+        if (logical_expression* logical = dynamic_cast<logical_expression*>(expr.get()))
+            return is_pure(logical->expr_lhs) && is_pure(logical->expr_rhs);
+
+        return false;
+    }
+
+    bool is_jump(statement& stmt)
+    {
+        return dynamic_cast<return_statement*>(&stmt) || dynamic_cast<break_statement*>(&stmt) ||
+            dynamic_cast<continue_statement*>(&stmt);
+    }
+
+    bool is_constant_false(const unique_ptr_t<expression>& condition)
+    {
+        literal_expression* literal = as_literal(condition);
+        return literal && !is_truthy(literal->literal_val);
+    }
+}
+
+optimizer::optimizer(arena_memory_pool* arena)
+    : _arena(arena)
+    , _replacement()
+    , _statement_replacement()
+    , _drop_statement(false) { }
+
+void optimizer::optimize_all(vector_t<unique_ptr_t<statement>>& statements)
+{
+    debug_timer dt("optimizer::optimize_all()");
+    optimize(statements);
+    dt.stop();
+}
+
+void optimizer::optimize(vector_t<unique_ptr_t<statement>>& statements)
+{
+    size_t kept = 0;
+
+    for (size_t i = 0; i < statements.size(); ++i)
+    {
+        optimize(statements[i]);
+
+        if (!statements[i])
+            continue;
+
+        bool jumps = is_jump(*statements[i]);
+        statements[kept++] = std::move(statements[i]);
+
+        // Nothing after a return, break or continue in the same block can run
+        if (jumps)
+            break;
+    }
+
+    statements.erase(statements.begin() + static_cast<std::ptrdiff_t>(kept), statements.end());
+}
+
+void optimizer::optimize(unique_ptr_t<statement>& stmt)
+{
+    stmt->accept_visitor(*this);
+
+    if (_drop_statement)
+    {
+        _drop_statement = false;
+        stmt.reset();
+    }
+    else if (_statement_replacement)
+    {
+        stmt = std::move(_statement_replacement);
+    }
+}
+
+void optimizer::optimize_branch(unique_ptr_t<statement>& stmt)
+{
+    optimize(stmt);
+
+    if (!stmt)
+        stmt = make_unique_t<block_statement>(_arena, vector_t<unique_ptr_t<statement>>(pool_resource(_arena)));
+}
+
+void optimizer::optimize(unique_ptr_t<expression>& expr)
+{
+    expr->accept_visitor(*this);
+
+    if (_replacement)
+        expr = std::move(_replacement);
+}
+
+void optimizer::replace_with_literal(const literal_value& value)
+{
+    // Strings made here are only referenced from the AST, interning keeps them alive for as long as it
+    if (value.is_string())
+        _replacement = make_unique_t<literal_expression>(_arena, memory_manager::instance().intern_string(value.as_string()->value()));
+    else
+        _replacement = make_unique_t<literal_expression>(_arena, value);
+}
+
+void optimizer::visit_debug_statement(debug_statement& stmt)
+{
+
+}
+
+void optimizer::visit_function_declaration_statement(function_declaration_statement& stmt)
+{
+    if (!stmt.referenced)
+    {
+        _drop_statement = true;
+        return;
+    }
+
+    optimize(stmt.body);
+}
+
+void optimizer::visit_variable_declaration_statement(variable_declaration_statement& stmt)
+{
+    if (stmt.initializer_expr)
+        optimize(stmt.initializer_expr);
+
+    if (stmt.referenced)
+        return;
+
+    if (!stmt.initializer_expr || is_pure(stmt.initializer_expr))
+        _drop_statement = true;
+    else
+        _statement_replacement = make_unique_t<expression_statement>(_arena, std::move(stmt.initializer_expr));
+}
+
+void optimizer::visit_if_statement(if_statement& stmt)
+{
+    optimize(stmt.condition);
+    optimize_branch(stmt.if_branch);
+
+    if (stmt.else_branch)
+        optimize(stmt.else_branch);
+
+    literal_expression* condition = as_literal(stmt.condition);
+    if (!condition)
+        return;
+
+    // The branch taken is resolved in the same scope as the if itself, so it can take its place
+    if (is_truthy(condition->literal_val))
+        _statement_replacement = std::move(stmt.if_branch);
+    else if (stmt.else_branch)
+        _statement_replacement = std::move(stmt.else_branch);
+    else
+        _drop_statement = true;
+}
+
+void optimizer::visit_while_statement(while_statement& stmt)
+{
+    optimize(stmt.condition);
+    optimize_branch(stmt.stmt_body);
+
+    if (is_constant_false(stmt.condition))
+        _drop_statement = true;
+}
+
+void optimizer::visit_for_statement(for_statement& stmt)
+{
+    if (stmt.initializer)
+        optimize(stmt.initializer);
+
+    if (stmt.condition)
+        optimize(stmt.condition);
+
+    if (stmt.increment)
+        optimize(stmt.increment);
+
+    optimize_branch(stmt.stmt_body);
+
+    // The initializer lives in a scope of the loop's own, it can't simply replace the loop
+    if (!stmt.initializer && is_constant_false(stmt.condition))
+        _drop_statement = true;
+}
+
+void optimizer::visit_break_statement(break_statement& stmt)
+{
+
+}
+
+void optimizer::visit_continue_statement(continue_statement& stmt)
+{
+
+}
+
+void optimizer::visit_return_statement(return_statement& stmt)
+{
+    if (stmt.return_expr)
+        optimize(stmt.return_expr);
+}
+
+void optimizer::visit_block_statement(block_statement& stmt)
+{
+    optimize(stmt.statements);
+
+    if (stmt.statements.empty())
+        _drop_statement = true;
+}
+
+void optimizer::visit_class_statement(class_statement& stmt)
+{
+    for (unique_ptr_t<function_declaration_statement>& method : stmt.methods)
+    {
+        method->accept_visitor(*this);
+    }
+}
+
+void optimizer::visit_expression_statement(expression_statement& stmt)
+{
+    optimize(stmt.expr);
+}
+
+void optimizer::visit_unary(unary_expression& expr)
+{
+    // The operand of ++ and -- has to stay the variable it was written as, even inside a grouping
+    if (expr.oper.type == token_type::plus_plus_ || expr.oper.type == token_type::minus_minus_)
+        return;
+
+    optimize(expr.expr_rhs);
+
+    if (literal_expression* rhs = as_literal(expr.expr_rhs))
+    {
+        try
+        {
+            replace_with_literal(apply_unary_operator(expr.oper, rhs->literal_val));
+        }
+        catch (const cpplox_runtime_error&) { }
+    }
+}
+
+void optimizer::visit_binary(binary_expression& expr)
+{
+    optimize(expr.expr_lhs);
+    optimize(expr.expr_rhs);
+
+    literal_expression* lhs = as_literal(expr.expr_lhs);
+    literal_expression* rhs = as_literal(expr.expr_rhs);
+
+    if (lhs && rhs)
+    {
+        try
+        {
+            replace_with_literal(apply_binary_operator(expr.oper, lhs->literal_val, rhs->literal_val));
+        }
+        catch (const cpplox_runtime_error&) { }
+
+        return;
+    }
+
+    // x * 1, 1 * x, x / 1 and x - 0 are x for every number, x + 0 is not when x is -0
+    switch (expr.oper.type)
+    {
+        case token_type::star_:
+        {
+            if (is_number_literal(expr.expr_rhs, 1.0) && yields_number(expr.expr_lhs))
+                _replacement = std::move(expr.expr_lhs);
+            else if (is_number_literal(expr.expr_lhs, 1.0) && yields_number(expr.expr_rhs))
+                _replacement = std::move(expr.expr_rhs);
+        } break;
+        case token_type::slash_:
+        {
+            if (is_number_literal(expr.expr_rhs, 1.0) && yields_number(expr.expr_lhs))
+                _replacement = std::move(expr.expr_lhs);
+        } break;
+        case token_type::minus_:
+        {
+            if (is_number_literal(expr.expr_rhs, 0.0) && yields_number(expr.expr_lhs))
+                _replacement = std::move(expr.expr_lhs);
+        } break;
+        default:
+            break;
+    }
+}
+
+void optimizer::visit_literal(literal_expression& expr)
+{
+
+}
+
+void optimizer::visit_grouping(grouping_expression& expr)
+{
+    optimize(expr.expr_group);
+    _replacement = std::move(expr.expr_group);
+}
+
+void optimizer::visit_variable(variable_expression& expr)
+{
+
+}
+
+void optimizer::visit_assignment(assignment_expression& expr)
+{
+    optimize(expr.initializer_expr);
+}
+
+void optimizer::visit_logical(logical_expression& expr)
+{
+    optimize(expr.expr_lhs);
+    optimize(expr.expr_rhs);
+
+    literal_expression* lhs = as_literal(expr.expr_lhs);
+    if (!lhs)
+        return;
+
+    // A literal on the left decides which operand the expression evaluates to
+    bool short_circuits = expr.oper.type == token_type::or_ ? is_truthy(lhs->literal_val) : !is_truthy(lhs->literal_val);
+    _replacement = short_circuits ? std::move(expr.expr_lhs) : std::move(expr.expr_rhs);
+}
+
+void optimizer::visit_postfix(postfix_expression& expr)
+{
+
+}
+
+void optimizer::visit_call(call_expression& expr)
+{
+    optimize(expr.callee);
+
+    for (unique_ptr_t<expression>& argument : expr.arguments)
+    {
+        optimize(argument);
+    }
+}
+
+void optimizer::visit_get(get_expression& expr)
+{
+    optimize(expr.object);
+}
+
+void optimizer::visit_set(set_expression& expr)
+{
+    optimize(expr.object);
+    optimize(expr.value);
+}
+
+void optimizer::visit_this(this_expression& expr)
+{
+
+}
+
+void optimizer::visit_super(super_expression& expr)
+{
+
+}
+
+NAMESPACE_END
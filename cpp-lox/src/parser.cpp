@@ -1,8 +1,10 @@
 #include "parser.h"
+#include "arena_memory_pool.h"
 #include "console_io.h"
 #include "debug_timer.h"
 #include "exceptions.h"
 #include "expressions.h"
+#include "lexer.h"
 #include "tokens.h"
 #include "typedefs.h"
 #include "statements.h"
@@ -14,61 +16,66 @@
 
 NAMESPACE_BEGIN(cpplox)
 
-parser::parser(const std::vector<token>& lexer_tokens, console_io* io)
-    : _lexer_tokens(lexer_tokens)
-    , _position(0)
+parser::parser(lexer& source, console_io* io, arena_memory_pool* arena)
+    : _lexer(source)
+    , _previous()
+    , _next(source.next_token())
     , _io(io)
+    , _arena(arena)
     , _parser_error(false)
 {
-
+    // bof only marks the start of the input, the first declaration starts after it
+    if (_next->type == token_type::bof_)
+        _next = _lexer.next_token();
 }
 
 bool parser::error_occurred() const noexcept { return _parser_error; }
 void parser::reset_error_flag() noexcept { _parser_error = false; }
+void parser::set_arena(arena_memory_pool* arena) noexcept { _arena = arena; }
+token_type parser::next_token_type() const noexcept { return _next ? _next->type : token_type::eof_; }
 
-recursive_descent_parser::recursive_descent_parser(const std::vector<token>& lexer_tokens, console_io* io)
-    : parser(lexer_tokens, io) { }
+recursive_descent_parser::recursive_descent_parser(lexer& source, console_io* io, arena_memory_pool* arena)
+    : parser(source, io, arena) { }
 
-std::vector<std::unique_ptr<statement>> recursive_descent_parser::parse()
+vector_t<unique_ptr_t<statement>> recursive_descent_parser::parse()
 {
     debug_timer dt("recursive_descent_parser::parse()");
 
-    std::vector<std::unique_ptr<statement>> statements;
-    // Estimate the number of statements to reserve
-    statements.reserve(_lexer_tokens.size() / 4);
+    vector_t<unique_ptr_t<statement>> statements(pool_resource(_arena));
+
+    while (unique_ptr_t<statement> stmt = next_declaration())
+        statements.push_back(std::move(stmt));
+
+    dt.stop();
 
+    return statements;
+}
+
+unique_ptr_t<statement> recursive_descent_parser::next_declaration()
+{
     while (peek_next_token().has_value())
     {
-        if (peek_next_token()->type == token_type::bof_)
-        {
-            advance_parser();
-            continue;
-        }
-
         if (peek_next_token()->type == token_type::eof_)
             break;
 
         try
         {
-            std::unique_ptr<statement> stmt = declaration_precedence();
+            unique_ptr_t<statement> stmt = declaration_precedence();
             if (stmt)
-            {
-                statements.push_back(std::move(stmt));
-            }
+                return stmt;
         }
         catch (const cpplox_runtime_error& e)
         {
+            _parser_error = true;
             _io->err() << e.what() << '\n';
             synchronize();
         }
     }
 
-    dt.stop();
-
-    return statements;
+    return nullptr;
 }
 
-std::unique_ptr<statement> recursive_descent_parser::declaration_precedence()
+unique_ptr_t<statement> recursive_descent_parser::declaration_precedence()
 {
     // declaration -> func_declaration | variable_declaration_statement | statement ;
 
@@ -76,7 +83,7 @@ std::unique_ptr<statement> recursive_descent_parser::declaration_precedence()
     if (matches_token({ token_type::debug_ }))
     {
         consume_if_matches(token_type::semicolon_, "Expected ';' after debug statement");
-        return std::make_unique<debug_statement>();
+        return make_unique_t<debug_statement>(_arena);
     }
 
     if (matches_token({ token_type::func_ }))
@@ -98,7 +105,7 @@ std::unique_ptr<statement> recursive_descent_parser::declaration_precedence()
     return statement_precedence();
 }
 
-std::unique_ptr<statement> recursive_descent_parser::create_function_declaration_statement(std::string& kind)
+unique_ptr_t<statement> recursive_descent_parser::create_function_declaration_statement(std::string& kind)
 {
     // func_declaration -> "func" | "static" function ;
     // function -> IDENTIFIER "(" parameters? ")" block ;
@@ -115,7 +122,7 @@ std::unique_ptr<statement> recursive_descent_parser::create_function_declaration
 
     token ident = consume_if_matches(token_type::identifier_, "Expected a " + kind + " name.");
     consume_if_matches(token_type::left_paren_, "Expect '(' after " + kind + " name.");
-    std::vector<token> parameters;
+    vector_t<token> parameters(pool_resource(_arena));
     if (!check_type(token_type::right_paren_))
     {
         do
@@ -129,52 +136,52 @@ std::unique_ptr<statement> recursive_descent_parser::create_function_declaration
     consume_if_matches(token_type::right_paren_, "Expect ')' after " + kind + " declaration.");
     consume_if_matches(token_type::left_brace_, "Expect '{' before " + kind + " body.");
 
-    std::vector<std::unique_ptr<statement>> body = create_block_statement();
-    return std::make_unique<function_declaration_statement>(ident, parameters, std::move(body), static_method);
+    vector_t<unique_ptr_t<statement>> body = create_block_statement();
+    return make_unique_t<function_declaration_statement>(_arena, ident, std::move(parameters), std::move(body), static_method);
 }
 
-std::unique_ptr<statement> recursive_descent_parser::create_variable_declaration_statement()
+unique_ptr_t<statement> recursive_descent_parser::create_variable_declaration_statement()
 {
     // variable_declaration -> "var" IDENTIFIER ( "=" expression )? ";" ;
     token ident_name = consume_if_matches(token_type::identifier_, "Expected variable name after 'var'");
 
-    std::unique_ptr<expression> initializer_expr = nullptr;
+    unique_ptr_t<expression> initializer_expr = nullptr;
     if (matches_token({ token_type::equal_ }))
     {
         initializer_expr = expression_precedence();
     }
     consume_if_matches(token_type::semicolon_, "Expected ';' after variable declaration");
-    return std::make_unique<variable_declaration_statement>(ident_name, std::move(initializer_expr));
+    return make_unique_t<variable_declaration_statement>(_arena, ident_name, std::move(initializer_expr));
 }
 
-std::unique_ptr<statement> recursive_descent_parser::create_class_declaration_statement()
+unique_ptr_t<statement> recursive_descent_parser::create_class_declaration_statement()
 {
     // class_declaration -> "class" IDENTIFIER ( "<" IDENTIFIER )? "{" function* "}" ;
     token ident = consume_if_matches(token_type::identifier_, "Expected class name after 'class'");
 
-    std::unique_ptr<variable_expression> superclass = nullptr;
+    unique_ptr_t<variable_expression> superclass = nullptr;
     if (matches_token({ token_type::less_ }))
     {
         consume_if_matches(token_type::identifier_, "Expected superclass name after '<'");
-        superclass = std::make_unique<variable_expression>(*previous_token());
+        superclass = make_unique_t<variable_expression>(_arena, *previous_token());
     }
 
     consume_if_matches(token_type::left_brace_, "Expected '{' after class name");
 
-    std::vector<std::unique_ptr<function_declaration_statement>> methods;
+    vector_t<unique_ptr_t<function_declaration_statement>> methods(pool_resource(_arena));
 
     while (!check_type(token_type::right_brace_) && peek_next_token()->type != token_type::eof_)
     {
         std::string kind = "method";
-        methods.emplace_back(std::unique_ptr<function_declaration_statement>(
+        methods.emplace_back(unique_ptr_t<function_declaration_statement>(
             dynamic_cast<function_declaration_statement*>(create_function_declaration_statement(kind).release())));
     }
 
     consume_if_matches(token_type::right_brace_, "Expected '}' after class body");
-    return std::make_unique<class_statement>(ident, std::move(methods), std::move(superclass));
+    return make_unique_t<class_statement>(_arena, ident, std::move(methods), std::move(superclass));
 }
 
-std::unique_ptr<statement> recursive_descent_parser::statement_precedence()
+unique_ptr_t<statement> recursive_descent_parser::statement_precedence()
 {
     // statement -> if_statement | while_statement | for_statement | break | continue | return | block | expression_statement ;
 
@@ -198,45 +205,45 @@ std::unique_ptr<statement> recursive_descent_parser::statement_precedence()
 
     if (matches_token({ token_type::left_brace_ }))
     {
-        std::vector<std::unique_ptr<statement>> statements = create_block_statement();
-        return std::make_unique<block_statement>(std::move(statements));
+        vector_t<unique_ptr_t<statement>> statements = create_block_statement();
+        return make_unique_t<block_statement>(_arena, std::move(statements));
     }
 
     return create_expression_statement();
 }
 
-std::unique_ptr<statement> recursive_descent_parser::create_if_statement()
+unique_ptr_t<statement> recursive_descent_parser::create_if_statement()
 {
     consume_if_matches(token_type::left_paren_, "Expected '(' after 'if'");
-    std::unique_ptr<expression> cond = expression_precedence();
+    unique_ptr_t<expression> cond = expression_precedence();
     consume_if_matches(token_type::right_paren_, "Expected ')' after if condition");
 
-    std::unique_ptr<statement> then_branch = statement_precedence();
-    std::unique_ptr<statement> else_branch = nullptr;
+    unique_ptr_t<statement> then_branch = statement_precedence();
+    unique_ptr_t<statement> else_branch = nullptr;
 
     if (matches_token({ token_type::else_ }))
         else_branch = statement_precedence();
 
-    return std::make_unique<if_statement>(std::move(cond), std::move(then_branch), std::move(else_branch));
+    return make_unique_t<if_statement>(_arena, std::move(cond), std::move(then_branch), std::move(else_branch));
 }
 
-std::unique_ptr<statement> recursive_descent_parser::create_while_statement()
+unique_ptr_t<statement> recursive_descent_parser::create_while_statement()
 {
     consume_if_matches(token_type::left_paren_, "Expected '(' after 'while'");
-    std::unique_ptr<expression> cond = expression_precedence();
+    unique_ptr_t<expression> cond = expression_precedence();
     consume_if_matches(token_type::right_paren_, "Expected ')' after while condition");
 
-    std::unique_ptr<statement> stmt_body = statement_precedence();
-    return std::make_unique<while_statement>(std::move(cond), std::move(stmt_body));
+    unique_ptr_t<statement> stmt_body = statement_precedence();
+    return make_unique_t<while_statement>(_arena, std::move(cond), std::move(stmt_body));
 }
 
-std::unique_ptr<statement> recursive_descent_parser::create_for_statement()
+unique_ptr_t<statement> recursive_descent_parser::create_for_statement()
 {
     token for_token = *previous_token();
 
     consume_if_matches(token_type::left_paren_, "Expected '(' after 'for'");
 
-    std::unique_ptr<statement> initializer = nullptr;
+    unique_ptr_t<statement> initializer = nullptr;
     if (matches_token({ token_type::semicolon_ }))
         initializer = nullptr;
     else if (matches_token({ token_type::var_ }))
@@ -244,59 +251,59 @@ std::unique_ptr<statement> recursive_descent_parser::create_for_statement()
     else
         initializer = create_expression_statement();
 
-    std::unique_ptr<expression> condition = nullptr;
+    unique_ptr_t<expression> condition = nullptr;
     if (!check_type(token_type::semicolon_))
         condition = expression_precedence();
     else
-        condition = std::make_unique<literal_expression>(true);
+        condition = make_unique_t<literal_expression>(_arena, true);
 
     consume_if_matches(token_type::semicolon_, "Expected ';' after for clauses");
 
-    std::unique_ptr<expression> increment = nullptr;
+    unique_ptr_t<expression> increment = nullptr;
     if (!check_type(token_type::right_paren_))
         increment = expression_precedence();
 
     consume_if_matches(token_type::right_paren_, "Expected ')' after for clauses");
 
-    std::unique_ptr<statement> stmt_body = statement_precedence();
+    unique_ptr_t<statement> stmt_body = statement_precedence();
 
-    return std::make_unique<for_statement>(std::move(initializer), std::move(condition),
+    return make_unique_t<for_statement>(_arena, std::move(initializer), std::move(condition),
             std::move(increment), std::move(stmt_body), for_token);
 }
 
-std::unique_ptr<statement> recursive_descent_parser::create_break_statement()
+unique_ptr_t<statement> recursive_descent_parser::create_break_statement()
 {
     token break_token = consume_if_matches(token_type::semicolon_, "Expected ';' after 'break'");
-    return std::make_unique<break_statement>(break_token);
+    return make_unique_t<break_statement>(_arena, break_token);
 }
 
-std::unique_ptr<statement> recursive_descent_parser::create_continue_statement()
+unique_ptr_t<statement> recursive_descent_parser::create_continue_statement()
 {
     token continue_token = consume_if_matches(token_type::semicolon_, "Expected ';' after 'continue'");
-    return std::make_unique<continue_statement>(continue_token);
+    return make_unique_t<continue_statement>(_arena, continue_token);
 }
 
-std::unique_ptr<statement> recursive_descent_parser::create_return_statement()
+unique_ptr_t<statement> recursive_descent_parser::create_return_statement()
 {
     token keyword = *previous_token();
 
-    std::unique_ptr<expression> return_expr = nullptr;
+    unique_ptr_t<expression> return_expr = nullptr;
     if (!check_type(token_type::semicolon_))
     {
         return_expr = expression_precedence();
     }
 
     consume_if_matches(token_type::semicolon_, "Expected ';' after return statement");
-    return std::make_unique<return_statement>(keyword, std::move(return_expr));
+    return make_unique_t<return_statement>(_arena, keyword, std::move(return_expr));
 }
 
-std::vector<std::unique_ptr<statement>> recursive_descent_parser::create_block_statement()
+vector_t<unique_ptr_t<statement>> recursive_descent_parser::create_block_statement()
 {
     // block -> "{" declaration* "}" ;
-    std::vector<std::unique_ptr<statement>> statements;
+    vector_t<unique_ptr_t<statement>> statements(pool_resource(_arena));
     while (!check_type(token_type::right_brace_) && peek_next_token()->type != token_type::eof_)
     {
-        std::unique_ptr<statement> stmt = declaration_precedence();
+        unique_ptr_t<statement> stmt = declaration_precedence();
         if (stmt)
         {
             statements.push_back(std::move(stmt));
@@ -307,29 +314,29 @@ std::vector<std::unique_ptr<statement>> recursive_descent_parser::create_block_s
     return statements;
 }
 
-std::unique_ptr<statement> recursive_descent_parser::create_expression_statement()
+unique_ptr_t<statement> recursive_descent_parser::create_expression_statement()
 {
     // expression_statement -> expression ";" ;
-    std::unique_ptr<expression> expr = expression_precedence();
+    unique_ptr_t<expression> expr = expression_precedence();
     consume_if_matches(token_type::semicolon_, "Expected ';' after expression");
-    return std::make_unique<expression_statement>(std::move(expr));
+    return make_unique_t<expression_statement>(_arena, std::move(expr));
 }
 
-std::unique_ptr<expression> recursive_descent_parser::expression_precedence()
+unique_ptr_t<expression> recursive_descent_parser::expression_precedence()
 {
     // expression -> assignment;
     return assignment_precedence();
 }
 
-std::unique_ptr<expression> recursive_descent_parser::assignment_precedence()
+unique_ptr_t<expression> recursive_descent_parser::assignment_precedence()
 {
     // assignment -> ( call "." )? IDENTIFIER "=" assignment ) | logic_or ;
-    std::unique_ptr<expression> expr = logic_or_precedence();
+    unique_ptr_t<expression> expr = logic_or_precedence();
 
     if (matches_token({ token_type::equal_ }))
     {
         token equals = *previous_token();
-        std::unique_ptr<expression> value = assignment_precedence();
+        unique_ptr_t<expression> value = assignment_precedence();
 
         // We check the lhs for validity, by making sure its actually a variable expression.
         // If it is, we create an assignment expression, otherwise we throw an error.
@@ -338,11 +345,11 @@ std::unique_ptr<expression> recursive_descent_parser::assignment_precedence()
         {
             // L-value, valid to assign
             token ident_name = var_expr->ident_name;
-            return std::make_unique<assignment_expression>(ident_name, std::move(value));
+            return make_unique_t<assignment_expression>(_arena, ident_name, std::move(value));
         }
         else if (get_expression* get_expr = dynamic_cast<get_expression*>(expr.get()))
         {
-            return std::make_unique<set_expression>(std::move(get_expr->object), get_expr->name, std::move(value));
+            return make_unique_t<set_expression>(_arena, std::move(get_expr->object), get_expr->name, std::move(value));
         }
 
         // R-value, invalid
@@ -352,140 +359,140 @@ std::unique_ptr<expression> recursive_descent_parser::assignment_precedence()
     return expr;
 }
 
-std::unique_ptr<expression> recursive_descent_parser::logic_or_precedence()
+unique_ptr_t<expression> recursive_descent_parser::logic_or_precedence()
 {
     // logic_or -> logic_and ( "or" logic_and )* ;
     validate_binary_has_lhs({ token_type::or_ });
 
-    std::unique_ptr<expression> expr = logic_and_precedence();
+    unique_ptr_t<expression> expr = logic_and_precedence();
 
     while (matches_token({ token_type::or_ }))
     {
         token oper = *previous_token();
-        std::unique_ptr<expression> rhs = logic_and_precedence();
-        expr = std::make_unique<logical_expression>(std::move(expr), oper, std::move(rhs));
+        unique_ptr_t<expression> rhs = logic_and_precedence();
+        expr = make_unique_t<logical_expression>(_arena, std::move(expr), oper, std::move(rhs));
     }
 
     return expr;
 }
 
-std::unique_ptr<expression> recursive_descent_parser::logic_and_precedence()
+unique_ptr_t<expression> recursive_descent_parser::logic_and_precedence()
 {
     // logic_and -> equality ( "and" equality )* ;
     validate_binary_has_lhs({ token_type::and_ });
 
-    std::unique_ptr<expression> expr = equality_precedence();
+    unique_ptr_t<expression> expr = equality_precedence();
 
     while (matches_token({ token_type::and_ }))
     {
         token oper = *previous_token();
-        std::unique_ptr<expression> rhs = equality_precedence();
-        expr = std::make_unique<logical_expression>(std::move(expr), oper, std::move(rhs));
+        unique_ptr_t<expression> rhs = equality_precedence();
+        expr = make_unique_t<logical_expression>(_arena, std::move(expr), oper, std::move(rhs));
     }
 
     return expr;
 }
 
-std::unique_ptr<expression> recursive_descent_parser::equality_precedence()
+unique_ptr_t<expression> recursive_descent_parser::equality_precedence()
 {
     // equality -> comparison ( ( "!=" | "\==" ) comparison)* ;
     validate_binary_has_lhs({ token_type::bang_equal_, token_type::equal_equal_ });
 
-    std::unique_ptr<expression> expr = comparison_precedence();
+    unique_ptr_t<expression> expr = comparison_precedence();
 
     while (matches_token({ token_type::bang_equal_, token_type::equal_equal_ }))
     {
         token oper = *previous_token();
-        std::unique_ptr<expression> rhs = comparison_precedence();
-        expr = std::make_unique<binary_expression>(std::move(expr), oper, std::move(rhs));
+        unique_ptr_t<expression> rhs = comparison_precedence();
+        expr = make_unique_t<binary_expression>(_arena, std::move(expr), oper, std::move(rhs));
     }
 
     return expr;
 }
 
-std::unique_ptr<expression> recursive_descent_parser::comparison_precedence()
+unique_ptr_t<expression> recursive_descent_parser::comparison_precedence()
 {
 
     // comparison -> term ( ( ">" | ">=" | "<" | "<=" ) term )* ;
     validate_binary_has_lhs({ token_type::greater_, token_type::greater_equal_, token_type::less_, token_type::less_equal_ });
 
-    std::unique_ptr<expression> expr = addition_precedence();
+    unique_ptr_t<expression> expr = addition_precedence();
 
     while (matches_token({ token_type::greater_, token_type::greater_equal_, token_type::less_, token_type::less_equal_ }))
     {
         token oper = *previous_token();
-        std::unique_ptr<expression> rhs = addition_precedence();
-        expr = std::make_unique<binary_expression>(std::move(expr), oper, std::move(rhs));
+        unique_ptr_t<expression> rhs = addition_precedence();
+        expr = make_unique_t<binary_expression>(_arena, std::move(expr), oper, std::move(rhs));
     }
 
     return expr;
 }
 
-std::unique_ptr<expression> recursive_descent_parser::addition_precedence()
+unique_ptr_t<expression> recursive_descent_parser::addition_precedence()
 {
     // term -> factor ( ( "-" | "+" ) factor )* ;
     validate_binary_has_lhs({ token_type::plus_ });
 
-    std::unique_ptr<expression> expr = multiplication_precedence();
+    unique_ptr_t<expression> expr = multiplication_precedence();
 
     while (matches_token({ token_type::minus_, token_type::plus_ }))
     {
         token oper = *previous_token();
-        std::unique_ptr<expression> rhs = multiplication_precedence();
-        expr = std::make_unique<binary_expression>(std::move(expr), oper, std::move(rhs));
+        unique_ptr_t<expression> rhs = multiplication_precedence();
+        expr = make_unique_t<binary_expression>(_arena, std::move(expr), oper, std::move(rhs));
     }
 
     return expr;
 }
 
-std::unique_ptr<expression> recursive_descent_parser::multiplication_precedence()
+unique_ptr_t<expression> recursive_descent_parser::multiplication_precedence()
 {
     // factor -> unary ( ( "\*" | "/" ) unary )* ;
     validate_binary_has_lhs({ token_type::star_, token_type::slash_ });
 
-    std::unique_ptr<expression> expr = unary_precedence();
+    unique_ptr_t<expression> expr = unary_precedence();
 
     while (matches_token({ token_type::star_, token_type::slash_, token_type::modulo_ }))
     {
         token oper = *previous_token();
-        std::unique_ptr<expression> rhs = unary_precedence();
-        expr = std::make_unique<binary_expression>(std::move(expr), oper, std::move(rhs));
+        unique_ptr_t<expression> rhs = unary_precedence();
+        expr = make_unique_t<binary_expression>(_arena, std::move(expr), oper, std::move(rhs));
     }
 
     return expr;
 }
 
-std::unique_ptr<expression> recursive_descent_parser::unary_precedence()
+unique_ptr_t<expression> recursive_descent_parser::unary_precedence()
 {
     // unary -> ( "!" | "-" | "++" | "--" ) unary | postfix ;
     if (matches_token({ token_type::bang_, token_type::minus_, token_type::plus_plus_, token_type::minus_minus_ }))
     {
         token oper = *previous_token();
-        std::unique_ptr<expression> rhs = unary_precedence();
-        return std::make_unique<unary_expression>(oper, std::move(rhs));
+        unique_ptr_t<expression> rhs = unary_precedence();
+        return make_unique_t<unary_expression>(_arena, oper, std::move(rhs));
     }
 
     return postfix_precedence();
 }
 
-std::unique_ptr<expression> recursive_descent_parser::postfix_precedence()
+unique_ptr_t<expression> recursive_descent_parser::postfix_precedence()
 {
     // postfix -> call ( "++" | "--" )* ;
-    std::unique_ptr<expression> expr = call_precedence();
+    unique_ptr_t<expression> expr = call_precedence();
 
     while (matches_token({ token_type::plus_plus_, token_type::minus_minus_ }))
     {
         token oper = *previous_token();
-        expr = std::make_unique<postfix_expression>(std::move(expr), oper);
+        expr = make_unique_t<postfix_expression>(_arena, std::move(expr), oper);
     }
 
     return expr;
 }
 
-std::unique_ptr<expression> recursive_descent_parser::call_precedence()
+unique_ptr_t<expression> recursive_descent_parser::call_precedence()
 {
     // call -> primary ( "(" arguments? ")" )* ;
-    std::unique_ptr<expression> expr = primary_precedence();
+    unique_ptr_t<expression> expr = primary_precedence();
 
     while (true)
     {
@@ -496,7 +503,7 @@ std::unique_ptr<expression> recursive_descent_parser::call_precedence()
         else if (matches_token({ token_type::dot_ }))
         {
             token name = consume_if_matches(token_type::identifier_, "Expected property name after '.'");
-            expr = std::make_unique<get_expression>(std::move(expr), name);
+            expr = make_unique_t<get_expression>(_arena, std::move(expr), name);
         }
         else
         {
@@ -507,31 +514,31 @@ std::unique_ptr<expression> recursive_descent_parser::call_precedence()
     return expr;
 }
 
-std::unique_ptr<expression> recursive_descent_parser::primary_precedence()
+unique_ptr_t<expression> recursive_descent_parser::primary_precedence()
 {
     // primary -> NUMBER | STRING | "true" | "false" | "null" | "(" expression ") | IDENTIFIER | "super" "." IDENTIFIER;
-    if (matches_token({ token_type::false_ })) return std::make_unique<literal_expression>(false);
-    if (matches_token({ token_type::true_ }))  return std::make_unique<literal_expression>(true);
-    if (matches_token({ token_type::null_ }))  return std::make_unique<literal_expression>(std::monostate{});
+    if (matches_token({ token_type::false_ })) return make_unique_t<literal_expression>(_arena, false);
+    if (matches_token({ token_type::true_ }))  return make_unique_t<literal_expression>(_arena, true);
+    if (matches_token({ token_type::null_ }))  return make_unique_t<literal_expression>(_arena, std::monostate{});
 
     if (matches_token({ token_type::number_, token_type::string_ }))
-        return std::make_unique<literal_expression>(previous_token()->literal);
+        return make_unique_t<literal_expression>(_arena, previous_token()->literal());
 
     if (matches_token({ token_type::left_paren_ }))
     {
-        std::unique_ptr<expression> expr = expression_precedence();
+        unique_ptr_t<expression> expr = expression_precedence();
         consume_if_matches(token_type::right_paren_, "Expected ')' after expression.");
-        return std::make_unique<grouping_expression>(std::move(expr));
+        return make_unique_t<grouping_expression>(_arena, std::move(expr));
     }
 
     if (matches_token({ token_type::this_ }))
     {
-        return std::make_unique<this_expression>(*previous_token());
+        return make_unique_t<this_expression>(_arena, *previous_token());
     }
 
     if (matches_token({ token_type::identifier_ }))
     {
-        return std::make_unique<variable_expression>(*previous_token());
+        return make_unique_t<variable_expression>(_arena, *previous_token());
     }
 
     if (matches_token({ token_type::super_ }))
@@ -539,15 +546,15 @@ std::unique_ptr<expression> recursive_descent_parser::primary_precedence()
         token keyword = *previous_token();
         consume_if_matches(token_type::dot_, "Expected '.' after 'super'");
         token method = consume_if_matches(token_type::identifier_, "Expected superclass method name after '.'");
-        return std::make_unique<super_expression>(keyword, method);
+        return make_unique_t<super_expression>(_arena, keyword, method);
     }
 
     throw error("Expected expression but none was given", *previous_token());
 }
 
-std::unique_ptr<expression> recursive_descent_parser::finish_call(std::unique_ptr<expression> callee)
+unique_ptr_t<expression> recursive_descent_parser::finish_call(unique_ptr_t<expression> callee)
 {
-    std::vector<std::unique_ptr<expression>> arguments;
+    vector_t<unique_ptr_t<expression>> arguments(pool_resource(_arena));
     if (!check_type(token_type::right_paren_))
     {
         do
@@ -561,33 +568,31 @@ std::unique_ptr<expression> recursive_descent_parser::finish_call(std::unique_pt
     }
 
     token paren = consume_if_matches(token_type::right_paren_, "Expected ')' after function arguments");
-    return std::make_unique<call_expression>(std::move(callee), paren, std::move(arguments));
+    return make_unique_t<call_expression>(_arena, std::move(callee), paren, std::move(arguments));
 }
 
 std::optional<token> recursive_descent_parser::advance_parser()
 {
-    const std::optional<token>& token = peek_next_token();
-    if (token.has_value())
-        ++_position;
+    if (_next.has_value())
+    {
+        _previous = _next;
+        if (_next->type == token_type::eof_)
+            _next.reset();
+        else
+            _next = _lexer.next_token();
+    }
 
-    return previous_token();
+    return _previous;
 }
 
 std::optional<token> recursive_descent_parser::previous_token() const
 {
-    uint32 index = _position - 1;
-    if (index == std::numeric_limits<uint32>::max())
-        return std::nullopt;
-
-    return _lexer_tokens[index];
+    return _previous;
 }
 
 std::optional<token> recursive_descent_parser::peek_next_token() const
 {
-    if (_position >= _lexer_tokens.size())
-        return std::nullopt;
-
-    return _lexer_tokens[_position];
+    return _next;
 }
 
 token recursive_descent_parser::consume_if_matches(token_type type, const std::string& msg)
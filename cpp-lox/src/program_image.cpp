@@ -0,0 +1,1166 @@
+#include "program_image.h"
+#include "char_scan.h"
+#include "cpplox_types.h"
+#include "expression_visitors.h"
+#include "expressions.h"
+#include "memory_manager.h"
+#include "source_manager.h"
+#include "statement_visitors.h"
+#include "statements.h"
+#include "symbol_table.h"
+#include "tokens.h"
+#include "typedefs.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define CPPLOX_IMAGE_MMAP 1
+#else
+#define CPPLOX_IMAGE_MMAP 0
+#endif
+
+NAMESPACE_BEGIN(cpplox)
+
+namespace
+{
+    // Bumped whenever the layout of the image or of the nodes in it changes
+    constexpr uint32 image_format = 1;
+    constexpr char image_magic[4] = { 'L', 'O', 'X', 'C' };
+    constexpr const char* image_extension = ".loxc";
+
+    // Offset of a token that is not in the source, such as the dummy tokens
+    constexpr uint32 dummy_offset = ~uint32{ 0 };
+
+    struct image_header
+    {
+        char magic[4];
+        uint32 format;
+        char version[32];
+        uint64 source_hash;
+        uint64 source_size;
+        // Of the header with this field set to 0, followed by the payload
+        uint64 checksum;
+        // The payload follows the header: the names, the statements and the warnings, in 32-bit words
+        uint32 payload_words;
+        uint32 name_count;
+        uint32 statement_count;
+        uint32 warnings_size;
+    };
+
+    static_assert(sizeof(image_header) % sizeof(uint32) == 0, "the payload has to start on a word");
+
+    enum class node_kind : uint32
+    {
+        none,
+
+        debug_statement,
+        function_declaration,
+        variable_declaration,
+        if_statement,
+        while_statement,
+        for_statement,
+        break_statement,
+        continue_statement,
+        return_statement,
+        block_statement,
+        class_statement,
+        expression_statement,
+
+        unary,
+        binary,
+        literal,
+        grouping,
+        variable,
+        assignment,
+        logical,
+        postfix,
+        call,
+        get,
+        set,
+        this_,
+        super_,
+    };
+
+    enum class literal_kind : uint32
+    {
+        bits,
+        string,
+    };
+
+    // Thrown while writing a program the image can't hold, or reading an image that doesn't add up
+    struct image_error { };
+
+    // Not cryptographic, only to tell a changed source or a damaged image apart from the one expected
+    uint64 hash_bytes(const void* data, size_t size, uint64 hash = 0xcbf29ce484222325)
+    {
+        const unsigned char* bytes = static_cast<const unsigned char*>(data);
+
+        for (; size >= sizeof(uint64); size -= sizeof(uint64), bytes += sizeof(uint64))
+        {
+            uint64 chunk;
+            std::memcpy(&chunk, bytes, sizeof(chunk));
+            hash = (hash ^ chunk) * 0x9e3779b97f4a7c15;
+            hash ^= hash >> 32;
+        }
+
+        for (; size > 0; --size, ++bytes)
+            hash = (hash ^ *bytes) * 0x100000001b3;
+
+        return hash;
+    }
+
+    uint64 image_checksum(image_header header, const std::byte* payload)
+    {
+        header.checksum = 0;
+        uint64 hash = hash_bytes(&header, sizeof(header));
+        return hash_bytes(payload, size_t{ header.payload_words } * sizeof(uint32), hash);
+    }
+
+    void set_version(image_header& header)
+    {
+        std::memset(header.version, 0, sizeof(header.version));
+        std::strncpy(header.version, CPPLOX_VERSION, sizeof(header.version) - 1);
+    }
+
+    size_t words_for(size_t bytes) { return (bytes + sizeof(uint32) - 1) / sizeof(uint32); }
+
+    // The image file, read-only.  Mapped where that is available, so that the nodes are built straight
+    // from the page cache without copying the file into a buffer first, and read into one anywhere else.
+    class mapped_file
+    {
+    public:
+        explicit mapped_file(const std::string& path)
+            : _data(nullptr)
+            , _size(0)
+        {
+#if CPPLOX_IMAGE_MMAP
+            int fd = ::open(path.c_str(), O_RDONLY);
+            if (fd < 0)
+                return;
+
+            struct stat info;
+            if (::fstat(fd, &info) == 0 && info.st_size > 0)
+            {
+                void* mapping = ::mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+                if (mapping != MAP_FAILED)
+                {
+                    _data = static_cast<const std::byte*>(mapping);
+                    _size = static_cast<size_t>(info.st_size);
+                }
+            }
+
+            ::close(fd);
+#else
+            std::ifstream file(path, std::ios::binary);
+            if (!file)
+                return;
+
+            file.seekg(0, std::ios::end);
+            std::streamoff size = file.tellg();
+            if (size <= 0)
+                return;
+
+            // Words, so that the buffer is aligned like a mapping would be
+            _buffer.resize(words_for(static_cast<size_t>(size)));
+            file.seekg(0, std::ios::beg);
+            file.read(reinterpret_cast<char*>(_buffer.data()), size);
+            if (file.gcount() != size)
+                return;
+
+            _data = reinterpret_cast<const std::byte*>(_buffer.data());
+            _size = static_cast<size_t>(size);
+#endif
+        }
+
+        ~mapped_file()
+        {
+#if CPPLOX_IMAGE_MMAP
+            if (_data)
+                ::munmap(const_cast<std::byte*>(_data), _size);
+#endif
+        }
+
+        mapped_file(const mapped_file&) = delete;
+        mapped_file& operator=(const mapped_file&) = delete;
+
+        const std::byte* data() const noexcept { return _data; }
+        size_t size() const noexcept { return _size; }
+
+    private:
+        const std::byte* _data;
+        size_t _size;
+#if !CPPLOX_IMAGE_MMAP
+        std::vector<uint32> _buffer;
+#endif
+    };
+
+    class image_writer : public statement_visitor, public expression_visitor<void>
+    {
+    public:
+        image_writer(std::string_view source, uint32 source_offset)
+            : _source_size(static_cast<uint32>(source.size()))
+            , _source_offset(source_offset)
+            , _names()
+            , _name_indices()
+            , _nodes() { }
+
+        void write_all(const vector_t<unique_ptr_t<statement>>& statements)
+        {
+            for (const unique_ptr_t<statement>& stmt : statements)
+                write(stmt.get());
+        }
+
+        // The names as their length followed by their characters, padded to a word
+        std::vector<uint32> name_words() const
+        {
+            std::vector<uint32> words;
+
+            for (std::string_view name : _names)
+            {
+                words.push_back(static_cast<uint32>(name.size()));
+                size_t start = words.size();
+                words.resize(start + words_for(name.size()));
+                std::memcpy(words.data() + start, name.data(), name.size());
+            }
+
+            return words;
+        }
+
+        uint32 name_count() const noexcept { return static_cast<uint32>(_names.size()); }
+        const std::vector<uint32>& node_words() const noexcept { return _nodes; }
+
+        virtual void visit_debug_statement(debug_statement& stmt) override
+        {
+            kind(node_kind::debug_statement);
+        }
+
+        virtual void visit_function_declaration_statement(function_declaration_statement& stmt) override
+        {
+            kind(node_kind::function_declaration);
+            write(stmt.ident_name);
+
+            count(stmt.params.size());
+            for (const token& param : stmt.params)
+                write(param);
+
+            count(stmt.body.size());
+            for (const unique_ptr_t<statement>& body_stmt : stmt.body)
+                write(body_stmt.get());
+
+            word(stmt.static_method);
+            word(static_cast<uint32>(stmt.slot));
+            word(stmt.referenced);
+        }
+
+        virtual void visit_variable_declaration_statement(variable_declaration_statement& stmt) override
+        {
+            kind(node_kind::variable_declaration);
+            write(stmt.ident_name);
+            write(stmt.initializer_expr.get());
+            word(static_cast<uint32>(stmt.slot));
+            word(stmt.referenced);
+        }
+
+        virtual void visit_if_statement(if_statement& stmt) override
+        {
+            kind(node_kind::if_statement);
+            write(stmt.condition.get());
+            write(stmt.if_branch.get());
+            write(stmt.else_branch.get());
+        }
+
+        virtual void visit_while_statement(while_statement& stmt) override
+        {
+            kind(node_kind::while_statement);
+            write(stmt.condition.get());
+            write(stmt.stmt_body.get());
+        }
+
+        virtual void visit_for_statement(for_statement& stmt) override
+        {
+            kind(node_kind::for_statement);
+            write(stmt.initializer.get());
+            write(stmt.condition.get());
+            write(stmt.increment.get());
+            write(stmt.stmt_body.get());
+            write(stmt.for_token);
+        }
+
+        virtual void visit_break_statement(break_statement& stmt) override
+        {
+            kind(node_kind::break_statement);
+            write(stmt.break_token);
+        }
+
+        virtual void visit_continue_statement(continue_statement& stmt) override
+        {
+            kind(node_kind::continue_statement);
+            write(stmt.continue_token);
+        }
+
+        virtual void visit_return_statement(return_statement& stmt) override
+        {
+            kind(node_kind::return_statement);
+            write(stmt.keyword);
+            write(stmt.return_expr.get());
+        }
+
+        virtual void visit_block_statement(block_statement& stmt) override
+        {
+            kind(node_kind::block_statement);
+            count(stmt.statements.size());
+            for (const unique_ptr_t<statement>& block_stmt : stmt.statements)
+                write(block_stmt.get());
+        }
+
+        virtual void visit_class_statement(class_statement& stmt) override
+        {
+            kind(node_kind::class_statement);
+            write(stmt.name);
+            write(stmt.superclass.get());
+
+            count(stmt.methods.size());
+            for (const unique_ptr_t<function_declaration_statement>& method : stmt.methods)
+                write(method.get());
+
+            word(static_cast<uint32>(stmt.slot));
+        }
+
+        virtual void visit_expression_statement(expression_statement& stmt) override
+        {
+            kind(node_kind::expression_statement);
+            write(stmt.expr.get());
+        }
+
+        virtual void visit_unary(unary_expression& expr) override
+        {
+            kind(node_kind::unary);
+            write(expr.oper);
+            write(expr.expr_rhs.get());
+        }
+
+        virtual void visit_binary(binary_expression& expr) override
+        {
+            kind(node_kind::binary);
+            write(expr.expr_lhs.get());
+            write(expr.oper);
+            write(expr.expr_rhs.get());
+        }
+
+        virtual void visit_literal(literal_expression& expr) override
+        {
+            kind(node_kind::literal);
+            write(expr.literal_val);
+        }
+
+        virtual void visit_grouping(grouping_expression& expr) override
+        {
+            kind(node_kind::grouping);
+            write(expr.expr_group.get());
+        }
+
+        virtual void visit_variable(variable_expression& expr) override
+        {
+            kind(node_kind::variable);
+            write(expr.ident_name);
+            write(expr.resolved);
+        }
+
+        virtual void visit_assignment(assignment_expression& expr) override
+        {
+            kind(node_kind::assignment);
+            write(expr.ident_name);
+            write(expr.initializer_expr.get());
+            write(expr.resolved);
+        }
+
+        virtual void visit_logical(logical_expression& expr) override
+        {
+            kind(node_kind::logical);
+            write(expr.expr_lhs.get());
+            write(expr.oper);
+            write(expr.expr_rhs.get());
+        }
+
+        virtual void visit_postfix(postfix_expression& expr) override
+        {
+            kind(node_kind::postfix);
+            write(expr.expr_lhs.get());
+            write(expr.oper);
+        }
+
+        virtual void visit_call(call_expression& expr) override
+        {
+            kind(node_kind::call);
+            write(expr.callee.get());
+            write(expr.paren);
+
+            count(expr.arguments.size());
+            for (const unique_ptr_t<expression>& argument : expr.arguments)
+                write(argument.get());
+        }
+
+        virtual void visit_get(get_expression& expr) override
+        {
+            kind(node_kind::get);
+            write(expr.object.get());
+            write(expr.name);
+        }
+
+        virtual void visit_set(set_expression& expr) override
+        {
+            kind(node_kind::set);
+            write(expr.object.get());
+            write(expr.name);
+            write(expr.value.get());
+        }
+
+        virtual void visit_this(this_expression& expr) override
+        {
+            kind(node_kind::this_);
+            write(expr.keyword);
+            write(expr.resolved);
+        }
+
+        virtual void visit_super(super_expression& expr) override
+        {
+            kind(node_kind::super_);
+            write(expr.keyword);
+            write(expr.method);
+            write(expr.resolved);
+        }
+
+    private:
+        uint32 _source_size;
+        uint32 _source_offset;
+        std::vector<std::string_view> _names;
+        std::unordered_map<std::string_view, uint32> _name_indices;
+        std::vector<uint32> _nodes;
+
+        void word(uint32 w) { _nodes.push_back(w); }
+        void kind(node_kind k) { word(static_cast<uint32>(k)); }
+        void count(size_t n) { word(static_cast<uint32>(n)); }
+
+        void name(std::string_view text)
+        {
+            auto [it, inserted] = _name_indices.try_emplace(text, static_cast<uint32>(_names.size()));
+            if (inserted)
+                _names.push_back(text);
+
+            word(it->second);
+        }
+
+        void write(statement* stmt)
+        {
+            if (stmt)
+                stmt->accept_visitor(*this);
+            else
+                kind(node_kind::none);
+        }
+
+        void write(expression* expr)
+        {
+            if (expr)
+                expr->accept_visitor(*this);
+            else
+                kind(node_kind::none);
+        }
+
+        void write(const token& t)
+        {
+            word(static_cast<uint32>(t.type));
+
+            if (t.offset >= _source_offset && t.offset - _source_offset + t.length <= _source_size)
+            {
+                word(t.offset - _source_offset);
+            }
+            else
+            {
+                // Only the dummy tokens come from anywhere else, those are made again when the image is read
+                token dummy = create_dummy_token(t.type);
+                if (t.offset != dummy.offset || t.length != dummy.length)
+                    throw image_error{};
+
+                word(dummy_offset);
+            }
+
+            word(t.length);
+
+            if (t.type == token_type::identifier_)
+                name(t.name()->name);
+            else if (t.type == token_type::string_ || t.type == token_type::number_)
+                write(t.literal());
+        }
+
+        void write(const literal_value& value)
+        {
+            if (value.is_string())
+            {
+                kind_of(literal_kind::string);
+                name(value.as_string()->value());
+                return;
+            }
+
+            // Anything else in the tree is a number, a bool or null, which are nothing but their bits
+            if (!value.is_number() && !value.is_bool() && !value.is_null())
+                throw image_error{};
+
+            kind_of(literal_kind::bits);
+            word(static_cast<uint32>(value.raw_bits()));
+            word(static_cast<uint32>(value.raw_bits() >> 32));
+        }
+
+        void kind_of(literal_kind k) { word(static_cast<uint32>(k)); }
+
+        void write(const variable_slot& resolved)
+        {
+            word(static_cast<uint32>(resolved.depth));
+            word(static_cast<uint32>(resolved.slot));
+        }
+    };
+
+    // Builds the nodes from the words of an image whose checksum matched, still checking every index
+    // and count against what is there, so that an image can never make it read out of bounds
+    class image_reader
+    {
+    public:
+        image_reader(const std::byte* words, size_t word_count, uint32 source_offset, uint32 source_size, arena_memory_pool* arena)
+            : _words(words)
+            , _word_count(word_count)
+            , _next(0)
+            , _source_offset(source_offset)
+            , _source_size(source_size)
+            , _arena(arena)
+            , _names()
+            , _scopes() { }
+
+        void read_names(uint32 name_count)
+        {
+            symbol_table& symbols = symbol_table::instance();
+            _names.reserve(count_at_most(name_count));
+
+            for (uint32 i = 0; i < name_count; ++i)
+            {
+                uint32 length = word();
+                size_t length_words = words_for(length);
+                if (length_words > _word_count - _next)
+                    throw image_error{};
+
+                std::string_view text(reinterpret_cast<const char*>(_words) + _next * sizeof(uint32), length);
+                _names.push_back(symbols.intern(text));
+                _next += length_words;
+            }
+        }
+
+        vector_t<unique_ptr_t<statement>> read_statements(uint32 statement_count)
+        {
+            vector_t<unique_ptr_t<statement>> statements(pool_resource(_arena));
+            statements.reserve(count_at_most(statement_count));
+
+            for (uint32 i = 0; i < statement_count; ++i)
+                statements.push_back(required(read_statement()));
+
+            return statements;
+        }
+
+        size_t position() const noexcept { return _next; }
+
+    private:
+        const std::byte* _words;
+        size_t _word_count;
+        size_t _next;
+        uint32 _source_offset;
+        uint32 _source_size;
+        arena_memory_pool* _arena;
+        std::vector<const symbol*> _names;
+
+        // The slots of a scope the resolver had around the nodes being read: those it starts with, such as
+        // parameters, the end of those declared in it, and the highest one referred to from inside it
+        struct scope_bounds
+        {
+            int reserved;
+            int declared;
+            int referenced;
+        };
+
+        // Innermost last, mirroring the resolver so that every depth and slot can be checked against them;
+        // the interpreter and the vm index their environments and stacks with them unchecked
+        std::vector<scope_bounds> _scopes;
+
+        uint32 word()
+        {
+            if (_next >= _word_count)
+                throw image_error{};
+
+            uint32 w;
+            std::memcpy(&w, _words + _next * sizeof(uint32), sizeof(w));
+            ++_next;
+            return w;
+        }
+
+        int signed_word() { return static_cast<int>(static_cast<int32>(word())); }
+        bool flag() { return word() != 0; }
+
+        // Every element takes at least a word, a count larger than the words left is corrupt
+        uint32 count_at_most(uint32 n) const
+        {
+            if (n > _word_count - _next)
+                throw image_error{};
+
+            return n;
+        }
+
+        uint32 count() { return count_at_most(word()); }
+
+        const symbol* name()
+        {
+            uint32 index = word();
+            if (index >= _names.size())
+                throw image_error{};
+
+            return _names[index];
+        }
+
+        template<typename T>
+        static unique_ptr_t<T> required(unique_ptr_t<T> node)
+        {
+            if (!node)
+                throw image_error{};
+
+            return node;
+        }
+
+        token read_token()
+        {
+            uint32 type = word();
+            if (type > static_cast<uint32>(token_type::debug_))
+                throw image_error{};
+
+            token t{ static_cast<token_type>(type), word(), word(), 0 };
+
+            if (t.offset == dummy_offset)
+                t = create_dummy_token(t.type);
+            else if (t.offset > _source_size || t.length > _source_size - t.offset)
+                throw image_error{};
+            else
+                t.offset += _source_offset;
+
+            if (t.type == token_type::identifier_)
+                t.payload = name()->id;
+            else if (t.type == token_type::string_ || t.type == token_type::number_)
+                t.payload = source_manager::instance().add_literal(read_literal());
+
+            return t;
+        }
+
+        literal_value read_literal()
+        {
+            switch (static_cast<literal_kind>(word()))
+            {
+                case literal_kind::bits:
+                {
+                    uint64 low = word();
+                    uint64 bits = low | (uint64{ word() } << 32);
+                    literal_value value = literal_value::from_bits(bits);
+
+                    // Bits that would make a pointer are never written
+                    if (!value.is_number() && !value.is_bool() && !value.is_null())
+                        throw image_error{};
+
+                    return value;
+                }
+                case literal_kind::string:
+                    return memory_manager::instance().intern_string(name()->name);
+            }
+
+            throw image_error{};
+        }
+
+        void begin_scope(int reserved)
+        {
+            _scopes.push_back({ reserved, 0, -1 });
+        }
+
+        // Slots can be referred to before their declaration has been read, from inside a function
+        // declared in the same scope, so references are only checked once the scope is complete
+        void end_scope()
+        {
+            scope_bounds scope = _scopes.back();
+            _scopes.pop_back();
+
+            if (scope.referenced >= std::max(scope.reserved, scope.declared))
+                throw image_error{};
+        }
+
+        // A declaration has a slot of the innermost scope, globals have none.  There can be gaps where the
+        // optimizer removed a declaration, but no scope has more variables than the source has characters.
+        int declared_slot(int slot)
+        {
+            if (_scopes.empty())
+            {
+                if (slot != -1)
+                    throw image_error{};
+
+                return slot;
+            }
+
+            scope_bounds& scope = _scopes.back();
+            if (slot < 0 || static_cast<uint32>(slot) >= _source_size)
+                throw image_error{};
+
+            scope.declared = std::max(scope.declared, slot + 1);
+            return slot;
+        }
+
+        variable_slot read_slot()
+        {
+            variable_slot resolved;
+            resolved.depth = signed_word();
+            resolved.slot = signed_word();
+
+            // Globals are looked up by name
+            if (resolved.depth == -1 && resolved.slot == -1)
+                return resolved;
+
+            if (resolved.depth < 0 || static_cast<size_t>(resolved.depth) >= _scopes.size() || resolved.slot < 0)
+                throw image_error{};
+
+            scope_bounds& scope = _scopes[_scopes.size() - 1 - static_cast<size_t>(resolved.depth)];
+            scope.referenced = std::max(scope.referenced, resolved.slot);
+            return resolved;
+        }
+
+        vector_t<unique_ptr_t<statement>> read_block()
+        {
+            uint32 n = count();
+            vector_t<unique_ptr_t<statement>> statements(pool_resource(_arena));
+            statements.reserve(n);
+
+            for (uint32 i = 0; i < n; ++i)
+                statements.push_back(required(read_statement()));
+
+            return statements;
+        }
+
+        unique_ptr_t<function_declaration_statement> read_function(bool method)
+        {
+            token ident_name = read_token();
+
+            uint32 param_count = count();
+            vector_t<token> params(pool_resource(_arena));
+            params.reserve(param_count);
+            for (uint32 i = 0; i < param_count; ++i)
+                params.push_back(read_token());
+
+            // A method's receiver comes before the parameters, unless the method turns out to be static
+            int first_param = method ? 1 : 0;
+            begin_scope(first_param + static_cast<int>(param_count));
+            vector_t<unique_ptr_t<statement>> body = read_block();
+            bool static_method = flag();
+
+            if (static_method && !method)
+                throw image_error{};
+
+            _scopes.back().reserved = (static_method ? 0 : first_param) + static_cast<int>(param_count);
+            end_scope();
+
+            auto stmt = make_unique_t<function_declaration_statement>(_arena, ident_name, std::move(params), std::move(body), static_method);
+
+            // Methods are not variables of any scope
+            int slot = signed_word();
+            if (method && slot != -1)
+                throw image_error{};
+
+            stmt->slot = method ? slot : declared_slot(slot);
+            stmt->referenced = flag();
+            return stmt;
+        }
+
+        unique_ptr_t<statement> read_statement()
+        {
+            switch (static_cast<node_kind>(word()))
+            {
+                case node_kind::none:
+                    return nullptr;
+
+                case node_kind::debug_statement:
+                    return make_unique_t<debug_statement>(_arena);
+
+                case node_kind::function_declaration:
+                    return read_function(false);
+
+                case node_kind::variable_declaration:
+                {
+                    token ident_name = read_token();
+                    unique_ptr_t<expression> initializer = read_expression();
+
+                    auto stmt = make_unique_t<variable_declaration_statement>(_arena, ident_name, std::move(initializer));
+                    stmt->slot = declared_slot(signed_word());
+                    stmt->referenced = flag();
+                    return stmt;
+                }
+
+                case node_kind::if_statement:
+                {
+                    unique_ptr_t<expression> condition = required(read_expression());
+                    unique_ptr_t<statement> if_branch = required(read_statement());
+                    unique_ptr_t<statement> else_branch = read_statement();
+                    return make_unique_t<if_statement>(_arena, std::move(condition), std::move(if_branch), std::move(else_branch));
+                }
+
+                case node_kind::while_statement:
+                {
+                    unique_ptr_t<expression> condition = required(read_expression());
+                    unique_ptr_t<statement> body = required(read_statement());
+                    return make_unique_t<while_statement>(_arena, std::move(condition), std::move(body));
+                }
+
+                case node_kind::for_statement:
+                {
+                    begin_scope(0);
+                    unique_ptr_t<statement> initializer = read_statement();
+                    unique_ptr_t<expression> condition = read_expression();
+                    unique_ptr_t<expression> increment = read_expression();
+                    unique_ptr_t<statement> body = required(read_statement());
+                    end_scope();
+
+                    token for_token = read_token();
+                    return make_unique_t<for_statement>(_arena, std::move(initializer), std::move(condition),
+                            std::move(increment), std::move(body), for_token);
+                }
+
+                case node_kind::break_statement:
+                    return make_unique_t<break_statement>(_arena, read_token());
+
+                case node_kind::continue_statement:
+                    return make_unique_t<continue_statement>(_arena, read_token());
+
+                case node_kind::return_statement:
+                {
+                    token keyword = read_token();
+                    return make_unique_t<return_statement>(_arena, keyword, read_expression());
+                }
+
+                case node_kind::block_statement:
+                {
+                    begin_scope(0);
+                    vector_t<unique_ptr_t<statement>> statements = read_block();
+                    end_scope();
+                    return make_unique_t<block_statement>(_arena, std::move(statements));
+                }
+
+                case node_kind::class_statement:
+                {
+                    token name = read_token();
+                    unique_ptr_t<expression> superclass = read_expression();
+
+                    // The methods of a subclass see 'super' in a scope of its own
+                    if (superclass)
+                        begin_scope(1);
+
+                    uint32 method_count = count();
+                    vector_t<unique_ptr_t<function_declaration_statement>> methods(pool_resource(_arena));
+                    methods.reserve(method_count);
+                    for (uint32 i = 0; i < method_count; ++i)
+                    {
+                        if (static_cast<node_kind>(word()) != node_kind::function_declaration)
+                            throw image_error{};
+
+                        methods.push_back(read_function(true));
+                    }
+
+                    if (superclass)
+                        end_scope();
+
+                    auto stmt = make_unique_t<class_statement>(_arena, name, std::move(methods), std::move(superclass));
+                    stmt->slot = declared_slot(signed_word());
+                    return stmt;
+                }
+
+                case node_kind::expression_statement:
+                    return make_unique_t<expression_statement>(_arena, required(read_expression()));
+
+                default:
+                    throw image_error{};
+            }
+        }
+
+        unique_ptr_t<expression> read_expression()
+        {
+            switch (static_cast<node_kind>(word()))
+            {
+                case node_kind::none:
+                    return nullptr;
+
+                case node_kind::unary:
+                {
+                    token oper = read_token();
+                    return make_unique_t<unary_expression>(_arena, oper, required(read_expression()));
+                }
+
+                case node_kind::binary:
+                {
+                    unique_ptr_t<expression> lhs = required(read_expression());
+                    token oper = read_token();
+                    unique_ptr_t<expression> rhs = required(read_expression());
+                    return make_unique_t<binary_expression>(_arena, std::move(lhs), oper, std::move(rhs));
+                }
+
+                case node_kind::literal:
+                    return make_unique_t<literal_expression>(_arena, read_literal());
+
+                case node_kind::grouping:
+                    return make_unique_t<grouping_expression>(_arena, required(read_expression()));
+
+                case node_kind::variable:
+                {
+                    auto expr = make_unique_t<variable_expression>(_arena, read_token());
+                    expr->resolved = read_slot();
+                    return expr;
+                }
+
+                case node_kind::assignment:
+                {
+                    token ident_name = read_token();
+                    auto expr = make_unique_t<assignment_expression>(_arena, ident_name, required(read_expression()));
+                    expr->resolved = read_slot();
+                    return expr;
+                }
+
+                case node_kind::logical:
+                {
+                    unique_ptr_t<expression> lhs = required(read_expression());
+                    token oper = read_token();
+                    unique_ptr_t<expression> rhs = required(read_expression());
+                    return make_unique_t<logical_expression>(_arena, std::move(lhs), oper, std::move(rhs));
+                }
+
+                case node_kind::postfix:
+                {
+                    unique_ptr_t<expression> lhs = required(read_expression());
+                    return make_unique_t<postfix_expression>(_arena, std::move(lhs), read_token());
+                }
+
+                case node_kind::call:
+                {
+                    unique_ptr_t<expression> callee = required(read_expression());
+                    token paren = read_token();
+
+                    uint32 argument_count = count();
+                    vector_t<unique_ptr_t<expression>> arguments(pool_resource(_arena));
+                    arguments.reserve(argument_count);
+                    for (uint32 i = 0; i < argument_count; ++i)
+                        arguments.push_back(required(read_expression()));
+
+                    return make_unique_t<call_expression>(_arena, std::move(callee), paren, std::move(arguments));
+                }
+
+                case node_kind::get:
+                {
+                    unique_ptr_t<expression> object = required(read_expression());
+                    return make_unique_t<get_expression>(_arena, std::move(object), read_token());
+                }
+
+                case node_kind::set:
+                {
+                    unique_ptr_t<expression> object = required(read_expression());
+                    token name = read_token();
+                    unique_ptr_t<expression> value = required(read_expression());
+                    return make_unique_t<set_expression>(_arena, std::move(object), name, std::move(value));
+                }
+
+                case node_kind::this_:
+                {
+                    auto expr = make_unique_t<this_expression>(_arena, read_token());
+                    expr->resolved = read_slot();
+                    return expr;
+                }
+
+                case node_kind::super_:
+                {
+                    token keyword = read_token();
+                    token method = read_token();
+                    auto expr = make_unique_t<super_expression>(_arena, keyword, method);
+                    expr->resolved = read_slot();
+                    return expr;
+                }
+
+                default:
+                    throw image_error{};
+            }
+        }
+    };
+}
+
+std::string default_image_cache_dir()
+{
+    auto variable = [](const char* name) -> std::string {
+        const char* value = std::getenv(name);
+        return value ? value : "";
+    };
+
+    if (std::string dir = variable("CPPLOX_CACHE_DIR"); !dir.empty())
+        return dir;
+
+    if (std::string dir = variable("XDG_CACHE_HOME"); !dir.empty())
+        return (std::filesystem::path(dir) / "cpp-lox").string();
+
+    if (std::string home = variable("HOME"); !home.empty())
+        return (std::filesystem::path(home) / ".cache" / "cpp-lox").string();
+
+    return {};
+}
+
+std::string program_image_path(const std::string& source_path, const std::string& cache_dir)
+{
+    std::filesystem::path path(source_path);
+    if (path.extension() == image_extension)
+        return {};
+
+    std::error_code error;
+    std::filesystem::path absolute = std::filesystem::absolute(path, error);
+    std::string key = error ? path.string() : absolute.lexically_normal().string();
+
+    char hash[17];
+    std::snprintf(hash, sizeof(hash), "%016llx", static_cast<unsigned long long>(hash_bytes(key.data(), key.size())));
+
+    std::string name = path.stem().string() + '-' + hash + image_extension;
+    return (std::filesystem::path(cache_dir) / name).string();
+}
+
+bool write_program_image(const std::string& path, std::string_view source, uint32 source_offset,
+        const vector_t<unique_ptr_t<statement>>& statements, std::string_view warnings)
+{
+    image_writer writer(source, source_offset);
+
+    try
+    {
+        writer.write_all(statements);
+    }
+    catch (const image_error&)
+    {
+        return false;
+    }
+
+    std::vector<uint32> payload = writer.name_words();
+    const std::vector<uint32>& nodes = writer.node_words();
+    payload.insert(payload.end(), nodes.begin(), nodes.end());
+
+    size_t warnings_start = payload.size();
+    payload.resize(warnings_start + words_for(warnings.size()));
+    std::memcpy(payload.data() + warnings_start, warnings.data(), warnings.size());
+
+    image_header header;
+    std::memcpy(header.magic, image_magic, sizeof(header.magic));
+    header.format = image_format;
+    set_version(header);
+    header.source_hash = hash_bytes(source.data(), source.size());
+    header.source_size = source.size();
+    header.checksum = 0;
+    header.payload_words = static_cast<uint32>(payload.size());
+    header.name_count = writer.name_count();
+    header.statement_count = static_cast<uint32>(statements.size());
+    header.warnings_size = static_cast<uint32>(warnings.size());
+    header.checksum = image_checksum(header, reinterpret_cast<const std::byte*>(payload.data()));
+
+    // Written next to the image under a name no other run picks, then renamed over it in one step
+    std::error_code error;
+    std::filesystem::path image(path);
+    if (image.has_parent_path())
+        std::filesystem::create_directories(image.parent_path(), error);
+
+    std::string temporary = path + ".tmp" + std::to_string(std::random_device{}());
+    {
+        std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(payload.data()), static_cast<std::streamsize>(payload.size() * sizeof(uint32)));
+
+        if (!file)
+        {
+            file.close();
+            std::filesystem::remove(temporary, error);
+            return false;
+        }
+    }
+
+    std::filesystem::rename(temporary, path, error);
+    if (error)
+    {
+        std::filesystem::remove(temporary, error);
+        return false;
+    }
+
+    return true;
+}
+
+std::optional<program_image> load_program_image(const std::string& path, std::string_view source, arena_memory_pool* arena)
+{
+    mapped_file file(path);
+    if (!file.data() || file.size() < sizeof(image_header))
+        return std::nullopt;
+
+    image_header header;
+    std::memcpy(&header, file.data(), sizeof(header));
+
+    image_header expected;
+    set_version(expected);
+
+    if (std::memcmp(header.magic, image_magic, sizeof(header.magic)) != 0 || header.format != image_format
+        || std::memcmp(header.version, expected.version, sizeof(header.version)) != 0)
+        return std::nullopt;
+
+    if (header.source_size != source.size() || header.source_hash != hash_bytes(source.data(), source.size()))
+        return std::nullopt;
+
+    const std::byte* payload = file.data() + sizeof(image_header);
+    if (file.size() - sizeof(image_header) != size_t{ header.payload_words } * sizeof(uint32)
+        || header.checksum != image_checksum(header, payload))
+        return std::nullopt;
+
+    size_t warnings_words = words_for(header.warnings_size);
+    if (warnings_words > header.payload_words)
+        return std::nullopt;
+
+    // What the lexer would have done with the source
+    source_manager& sources = source_manager::instance();
+    uint32 source_offset = sources.add_source(source);
+    std::string_view text = sources.text(source_offset, static_cast<uint32>(source.size()));
+    const char* last = text.data() + text.size();
+    for (const char* newline = find_char(text.data(), last, '\n'); newline != last; newline = find_char(newline + 1, last, '\n'))
+        sources.add_line_start(source_offset + static_cast<uint32>(newline + 1 - text.data()));
+
+    size_t node_words = header.payload_words - warnings_words;
+    image_reader reader(payload, node_words, source_offset, static_cast<uint32>(source.size()), arena);
+    program_image program{ vector_t<unique_ptr_t<statement>>(pool_resource(arena)), {} };
+
+    try
+    {
+        reader.read_names(header.name_count);
+        program.statements = reader.read_statements(header.statement_count);
+    }
+    catch (const image_error&)
+    {
+        return std::nullopt;
+    }
+
+    if (reader.position() != node_words)
+        return std::nullopt;
+
+    program.warnings.assign(reinterpret_cast<const char*>(payload + node_words * sizeof(uint32)), header.warnings_size);
+    return program;
+}
+
+NAMESPACE_END
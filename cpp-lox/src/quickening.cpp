@@ -0,0 +1,159 @@
+#include "quickening.h"
+#include "cpplox_types.h"
+#include "tokens.h"
+#include "typedefs.h"
+#include <ostream>
+
+NAMESPACE_BEGIN(cpplox)
+
+namespace
+{
+    quickening_stats& counters() noexcept
+    {
+        static quickening_stats stats;
+        return stats;
+    }
+
+    binary_form number_form(token_type oper) noexcept
+    {
+        switch (oper)
+        {
+            case token_type::plus_:          return binary_form::number_add;
+            case token_type::minus_:         return binary_form::number_subtract;
+            case token_type::star_:          return binary_form::number_multiply;
+            case token_type::slash_:         return binary_form::number_divide;
+            case token_type::modulo_:        return binary_form::number_modulo;
+            case token_type::greater_:       return binary_form::number_greater;
+            case token_type::greater_equal_: return binary_form::number_greater_equal;
+            case token_type::less_:          return binary_form::number_less;
+            case token_type::less_equal_:    return binary_form::number_less_equal;
+            case token_type::equal_equal_:   return binary_form::number_equal;
+            case token_type::bang_equal_:    return binary_form::number_not_equal;
+            default:                         return binary_form::generic;
+        }
+    }
+
+    const char* form_name(binary_form form) noexcept
+    {
+        switch (form)
+        {
+            case binary_form::uninitialized:        return "uninitialized";
+            case binary_form::number_add:           return "number +";
+            case binary_form::number_subtract:      return "number -";
+            case binary_form::number_multiply:      return "number *";
+            case binary_form::number_divide:        return "number /";
+            case binary_form::number_modulo:        return "number %";
+            case binary_form::number_greater:       return "number >";
+            case binary_form::number_greater_equal: return "number >=";
+            case binary_form::number_less:          return "number <";
+            case binary_form::number_less_equal:    return "number <=";
+            case binary_form::number_equal:         return "number ==";
+            case binary_form::number_not_equal:     return "number !=";
+            case binary_form::string_concatenate:   return "string +";
+            case binary_form::generic:              return "generic";
+            case binary_form::count:                break;
+        }
+
+        return "unknown";
+    }
+
+    const char* form_name(unary_form form) noexcept
+    {
+        switch (form)
+        {
+            case unary_form::uninitialized: return "uninitialized";
+            case unary_form::number_negate: return "number -";
+            case unary_form::bool_not:      return "bool !";
+            case unary_form::generic:       return "generic";
+            case unary_form::count:         break;
+        }
+
+        return "unknown";
+    }
+
+    template<typename Form>
+    Form record(Form form, std::array<uint64, static_cast<size_t>(Form::count)>& forms) noexcept
+    {
+        quickening_stats& stats = counters();
+
+        if (form == Form::generic)
+            ++stats.generic;
+        else
+            ++stats.specialized;
+
+        ++forms[static_cast<size_t>(form)];
+        return form;
+    }
+}
+
+binary_form quickening::specialize(token_type oper, const literal_value& lhs, const literal_value& rhs) noexcept
+{
+    binary_form form = binary_form::generic;
+
+    if (lhs.is_number() && rhs.is_number())
+        form = number_form(oper);
+    else if (oper == token_type::plus_ && lhs.is_string() && rhs.is_string())
+        form = binary_form::string_concatenate;
+
+    return record(form, counters().binary_forms);
+}
+
+unary_form quickening::specialize(token_type oper, const literal_value& rhs) noexcept
+{
+    unary_form form = unary_form::generic;
+
+    if (oper == token_type::minus_ && rhs.is_number())
+        form = unary_form::number_negate;
+    else if (oper == token_type::bang_ && rhs.is_bool())
+        form = unary_form::bool_not;
+
+    return record(form, counters().unary_forms);
+}
+
+binary_form quickening::deoptimize(binary_form form) noexcept
+{
+    quickening_stats& stats = counters();
+    ++stats.deoptimized;
+    --stats.binary_forms[static_cast<size_t>(form)];
+    ++stats.binary_forms[static_cast<size_t>(binary_form::generic)];
+    return binary_form::generic;
+}
+
+unary_form quickening::deoptimize(unary_form form) noexcept
+{
+    quickening_stats& stats = counters();
+    ++stats.deoptimized;
+    --stats.unary_forms[static_cast<size_t>(form)];
+    ++stats.unary_forms[static_cast<size_t>(unary_form::generic)];
+    return unary_form::generic;
+}
+
+const quickening_stats& quickening::stats() noexcept
+{
+    return counters();
+}
+
+void quickening::print_stats(std::ostream& os)
+{
+    const quickening_stats& stats = counters();
+
+    os << "[ Quickening Stats ]\n";
+    os << "specialized: " << stats.specialized << '\n';
+    os << "deoptimized: " << stats.deoptimized << '\n';
+    os << "generic:     " << stats.generic << '\n';
+
+    // Forms nodes are in now, deoptimized ones counted as generic
+    for (size_t i = 0; i < stats.binary_forms.size(); ++i)
+    {
+        if (stats.binary_forms[i] > 0)
+            os << "  binary " << form_name(static_cast<binary_form>(i)) << ": " << stats.binary_forms[i] << '\n';
+    }
+
+    for (size_t i = 0; i < stats.unary_forms.size(); ++i)
+    {
+        if (stats.unary_forms[i] > 0)
+            os << "  unary " << form_name(static_cast<unary_form>(i)) << ": " << stats.unary_forms[i] << '\n';
+    }
+}
+
+NAMESPACE_END
@@ -9,6 +9,7 @@
 #include "typedefs.h"
 #include <cassert>
 #include <memory>
+#include <string>
 #include <vector>
 #include <unordered_map>
 
@@ -20,14 +21,18 @@ resolver::resolver(interpreter& interpreter_)
     , _scopes()
     , _current_function_type(function_type::none)
     , _current_class_type(class_type::none_)
-    , _had_error(false) { }
+    , _loop_depth(0)
+    , _had_error(false)
+    , _warnings() { }
 
 bool resolver::error_occurred() const noexcept { return _had_error; }
 void resolver::reset_error_flag() noexcept { _had_error = false; }
+const std::string& resolver::warnings() const noexcept { return _warnings; }
 
-void resolver::resolve_all(const std::vector<std::unique_ptr<statement>>& statements)
+void resolver::resolve_all(const vector_t<unique_ptr_t<statement>>& statements)
 {
     debug_timer dt("resolver::resolve()");
+    _warnings.clear();
 
     try
     {
@@ -37,12 +42,19 @@ void resolver::resolve_all(const std::vector<std::unique_ptr<statement>>& statem
     {
         _io->err() << e.what() << '\n';
         _had_error = true;
+
+        // The scopes left open refer to declarations that may be freed before the next statements
+        // are resolved
+        _scopes.clear();
+        _current_function_type = function_type::none;
+        _current_class_type = class_type::none_;
+        _loop_depth = 0;
     }
 
     dt.stop();
 }
 
-void resolver::resolve(const std::vector<std::unique_ptr<statement>>& statements)
+void resolver::resolve(const vector_t<unique_ptr_t<statement>>& statements)
 {
     for (const auto& stmt : statements)
     {
@@ -50,12 +62,12 @@ void resolver::resolve(const std::vector<std::unique_ptr<statement>>& statements
     }
 }
 
-void resolver::resolve(const std::unique_ptr<statement>& stmt)
+void resolver::resolve(const unique_ptr_t<statement>& stmt)
 {
     stmt->accept_visitor(*this);
 }
 
-void resolver::resolve(const std::unique_ptr<expression>& expr)
+void resolver::resolve(const unique_ptr_t<expression>& expr)
 {
     expr->accept_visitor(*this);
 }
@@ -67,7 +79,7 @@ void resolver::visit_debug_statement(debug_statement& stmt)
 
 void resolver::visit_function_declaration_statement(function_declaration_statement& stmt)
 {
-    declare(stmt.ident_name);
+    stmt.slot = declare(stmt.ident_name, &stmt.referenced);
     define(stmt.ident_name);
 
     resolve_function(stmt, function_type::function);
@@ -75,10 +87,13 @@ void resolver::visit_function_declaration_statement(function_declaration_stateme
 
 void resolver::visit_variable_declaration_statement(variable_declaration_statement& stmt)
 {
-    declare(stmt.ident_name);
+    stmt.slot = declare(stmt.ident_name, &stmt.referenced);
     if (stmt.initializer_expr)
         resolve(stmt.initializer_expr);
     define(stmt.ident_name);
+
+    if (!stmt.initializer_expr && !_scopes.empty())
+        _scopes.back().find(stmt.ident_name.lexeme())->second.initialized = false;
 }
 
 void resolver::visit_if_statement(if_statement& stmt)
@@ -93,7 +108,10 @@ void resolver::visit_if_statement(if_statement& stmt)
 void resolver::visit_while_statement(while_statement& stmt)
 {
     resolve(stmt.condition);
+
+    ++_loop_depth;
     resolve(stmt.stmt_body);
+    --_loop_depth;
 }
 
 void resolver::visit_for_statement(for_statement& stmt)
@@ -109,18 +127,22 @@ void resolver::visit_for_statement(for_statement& stmt)
     if (stmt.increment)
         resolve(stmt.increment);
 
+    ++_loop_depth;
     resolve(stmt.stmt_body);
+    --_loop_depth;
     end_scope();
 }
 
 void resolver::visit_break_statement(break_statement& stmt)
 {
-
+    if (_loop_depth == 0)
+        throw cpplox_runtime_error("Cannot use 'break' outside of a loop", stmt.break_token);
 }
 
 void resolver::visit_continue_statement(continue_statement& stmt)
 {
-
+    if (_loop_depth == 0)
+        throw cpplox_runtime_error("Cannot use 'continue' outside of a loop", stmt.continue_token);
 }
 
 void resolver::visit_return_statement(return_statement& stmt)
@@ -146,7 +168,7 @@ void resolver::visit_block_statement(block_statement& stmt)
 
 void resolver::visit_class_statement(class_statement& stmt)
 {
-    declare(stmt.name);
+    stmt.slot = declare(stmt.name);
     define(stmt.name);
 
     if (stmt.superclass)
@@ -154,7 +176,7 @@ void resolver::visit_class_statement(class_statement& stmt)
         _current_class_type = class_type::subclass_;
 
         variable_expression* var_expr = dynamic_cast<variable_expression*>(stmt.superclass.get());
-        if (var_expr && stmt.name.lexeme == var_expr->ident_name.lexeme)
+        if (var_expr && stmt.name.lexeme() == var_expr->ident_name.lexeme())
             throw cpplox_runtime_error("A class cannot inherit from itself", stmt.name);
 
         resolve(stmt.superclass);
@@ -163,22 +185,17 @@ void resolver::visit_class_statement(class_statement& stmt)
     if (stmt.superclass)
     {
         begin_scope();
-        _scopes.back()["super"] = variable_info{ true, true, create_dummy_token(token_type::super_) };
+        _scopes.back()["super"] = variable_info{ true, true, create_dummy_token(token_type::super_), 0 };
     }
 
     class_type enclosing_class = _current_class_type;
     _current_class_type = (stmt.superclass ? class_type::subclass_ : class_type::class_);
 
-    begin_scope();
-
-    token this_token = token{ token_type::this_, "this", "", { 0, 0 }, std::string("") };
-    _scopes.back()["this"] = variable_info{ true, true, this_token };
-
-    for (const std::unique_ptr<function_declaration_statement>& method : stmt.methods)
+    for (const unique_ptr_t<function_declaration_statement>& method : stmt.methods)
     {
         function_type declaration = method->static_method ? function_type::static_method : function_type::method;
 
-        if (method->ident_name.lexeme == "init")
+        if (method->ident_name.lexeme() == "init")
         {
             if (declaration == function_type::static_method)
                 throw cpplox_runtime_error("Cannot use 'init' as a static method", method->ident_name);
@@ -192,8 +209,6 @@ void resolver::visit_class_statement(class_statement& stmt)
     if (stmt.superclass)
         end_scope();
 
-    end_scope();
-
     _current_class_type = enclosing_class;
 }
 
@@ -227,25 +242,29 @@ void resolver::visit_variable(variable_expression& expr)
 {
     if (!_scopes.empty())
     {
-        std::unordered_map<std::string, variable_info>& scope = _scopes.back();
-        std::unordered_map<std::string, variable_info>::iterator it = scope.find(expr.ident_name.lexeme);
+        string_map<variable_info>& scope = _scopes.back();
+        string_map<variable_info>::iterator it = scope.find(expr.ident_name.lexeme());
 
         if (it != scope.end())
         {
             if (it->second.defined == false)
                 throw cpplox_runtime_error("Can't read local variable in its own initializer: " + it->first);
-
-            it->second.used = true;
         }
 
-        resolve_local(expr, expr.ident_name);
+        if (variable_info* info = resolve_local(expr.resolved, expr.ident_name))
+        {
+            info->used = true;
+            expr.initialized = info->initialized;
+        }
     }
 }
 
 void resolver::visit_assignment(assignment_expression& expr)
 {
     resolve(expr.initializer_expr);
-    resolve_local(expr, expr.ident_name);
+
+    if (variable_info* info = resolve_local(expr.resolved, expr.ident_name))
+        info->assigned = true;
 }
 
 void resolver::visit_logical(logical_expression& expr)
@@ -263,7 +282,7 @@ void resolver::visit_call(call_expression& expr)
 {
     resolve(expr.callee);
 
-    for (const std::unique_ptr<expression>& arg : expr.arguments) 
+    for (const unique_ptr_t<expression>& arg : expr.arguments) 
     {
         resolve(arg);
     }
@@ -285,7 +304,7 @@ void resolver::visit_this(this_expression& expr)
     if (_current_class_type == class_type::none_)
         throw cpplox_runtime_error("Cannot use 'this' outside of a class", expr.keyword);
 
-    resolve_local(expr, expr.keyword);
+    resolve_local(expr.resolved, expr.keyword);
 }
 
 void resolver::visit_super(super_expression& expr)
@@ -295,12 +314,12 @@ void resolver::visit_super(super_expression& expr)
     else if (_current_class_type != class_type::subclass_)
         throw cpplox_runtime_error("Can't use 'super' in a class with no superclass.");
 
-    resolve_local(expr, expr.keyword);
+    resolve_local(expr.resolved, expr.keyword);
 }
 
 void resolver::begin_scope()
 {
-    _scopes.push_back(std::unordered_map<std::string, variable_info>());
+    _scopes.push_back(string_map<variable_info>());
 }
 
 void resolver::end_scope()
@@ -312,28 +331,39 @@ void resolver::end_scope()
         {
             if (!info.used)
             {
-                _io->err() << "Variable declared but never used: " << name << '\n';
+                std::string warning = "Variable declared but never used: " + name + '\n';
+                _io->err() << warning;
+                _warnings += warning;
             }
+
+            if (info.referenced)
+                *info.referenced = info.used || info.assigned;
         }
     }
 
     _scopes.pop_back();
 }
 
-void resolver::declare(const token& t)
+int resolver::declare(const token& t, bool* referenced)
 {
     if (_scopes.empty())
-        return;
+        return -1;
 
     auto& scope = _scopes.back();
 
-    auto it = scope.find(t.lexeme);
-    if (it != scope.end() && it->second.defined)
+    auto it = scope.find(t.lexeme());
+    if (it != scope.end())
     {
-        throw cpplox_runtime_error("Variable with this name already declared in this scope: " + t.lexeme);
+        if (it->second.defined)
+            throw cpplox_runtime_error("Variable with this name already declared in this scope: " + std::string(t.lexeme()));
+
+        it->second = variable_info{ false, false, t, it->second.slot, false, referenced };
+        return it->second.slot;
     }
 
-    scope[t.lexeme] = variable_info{ false, false, t };
+    int slot = static_cast<int>(scope.size());
+    scope[std::string(t.lexeme())] = variable_info{ false, false, t, slot, false, referenced };
+    return slot;
 }
 
 void resolver::define(const token& t)
@@ -342,24 +372,28 @@ void resolver::define(const token& t)
         return;
 
     auto& scope = _scopes.back();
-    auto it = scope.find(t.lexeme);
+    auto it = scope.find(t.lexeme());
     assert(it != scope.end());
 
-    scope[t.lexeme].defined = true;
+    scope[std::string(t.lexeme())].defined = true;
 }
 
-void resolver::resolve_local(expression& expr, const token& t)
+variable_info* resolver::resolve_local(variable_slot& resolved, const token& t)
 {
     for (int i = static_cast<int>(_scopes.size()) - 1; i >= 0; --i)
     {
         auto& curr_scope = _scopes[static_cast<size_t>(i)];
-        auto it = curr_scope.find(t.lexeme);
+        auto it = curr_scope.find(t.lexeme());
         if (it != curr_scope.end())
         {
-            _interpreter.resolve(expr, static_cast<int>(static_cast<int>(_scopes.size()) - i - 1));
-            return;
+            resolved.depth = static_cast<int>(_scopes.size()) - i - 1;
+            resolved.slot = it->second.slot;
+            return &it->second;
         }
     }
+
+    resolved = variable_slot{};
+    return nullptr;
 }
 
 void resolver::resolve_function(function_declaration_statement& expr, function_type type)
@@ -367,8 +401,19 @@ void resolver::resolve_function(function_declaration_statement& expr, function_t
     function_type enclosing_function = _current_function_type;
     _current_function_type = type;
 
+    // A loop around the declaration can not be broken out of from inside the function
+    int enclosing_loop_depth = _loop_depth;
+    _loop_depth = 0;
+
     begin_scope();
 
+    // A method's receiver lives in the first slot of its environment, ahead of the parameters.  Static
+    // methods are called without one.
+    if (type == function_type::method || type == function_type::initializer)
+    {
+        _scopes.back()["this"] = variable_info{ true, true, create_dummy_token(token_type::this_), 0 };
+    }
+
     for (const token& t : expr.params)
     {
         declare(t);
@@ -379,6 +424,7 @@ void resolver::resolve_function(function_declaration_statement& expr, function_t
     end_scope();
 
     _current_function_type = enclosing_function;
+    _loop_depth = enclosing_loop_depth;
 }
 
 NAMESPACE_END
@@ -0,0 +1,60 @@
+#include "shape.h"
+#include "typedefs.h"
+#include "symbol_table.h"
+#include <memory>
+
+NAMESPACE_BEGIN(cpplox)
+
+shape* shape::root()
+{
+    static shape root_shape(nullptr, nullptr);
+    return &root_shape;
+}
+
+shape::shape(shape* parent, const symbol* name)
+    : _parent(parent)
+    , _name(name)
+    , _field_count(parent ? parent->_field_count + 1 : 0)
+    , _transitions()
+    , _last_transition(nullptr)
+    , _lookup_table() { }
+
+int shape::find(const symbol* name) const
+{
+    if (_field_count <= linear_search_limit)
+    {
+        // The most recently added field is this shape's own, so the walk starts from the last slot
+        for (const shape* s = this; s->_parent; s = s->_parent)
+        {
+            if (s->_name == name)
+                return s->_field_count - 1;
+        }
+
+        return -1;
+    }
+
+    if (_lookup_table.empty())
+    {
+        for (const shape* s = this; s->_parent; s = s->_parent)
+            _lookup_table.emplace(s->_name, s->_field_count - 1);
+    }
+
+    auto it = _lookup_table.find(name);
+    return it != _lookup_table.end() ? it->second : -1;
+}
+
+shape* shape::add_field(const symbol* name)
+{
+    // Instances of a class usually get their fields in the same order, check the last transition first
+    if (_last_transition && _last_transition->_name == name)
+        return _last_transition;
+
+    auto it = _transitions.find(name);
+    if (it == _transitions.end())
+        it = _transitions.emplace(name, std::unique_ptr<shape>(new shape(this, name))).first;
+
+    _last_transition = it->second.get();
+    return _last_transition;
+}
+
+NAMESPACE_END
@@ -0,0 +1,83 @@
+#include "source_manager.h"
+#include "cpplox_types.h"
+#include "typedefs.h"
+#include <algorithm>
+#include <string_view>
+#include <variant>
+
+NAMESPACE_BEGIN(cpplox)
+
+source_manager& source_manager::instance()
+{
+    static source_manager manager;
+    return manager;
+}
+
+source_manager::source_manager()
+    : _text()
+    , _sources()
+    , _line_starts()
+    , _literals()
+{
+    _literals.push_back(std::monostate{});
+}
+
+uint32 source_manager::add_source(std::string_view text)
+{
+    uint32 begin = static_cast<uint32>(_text.size());
+
+    _text.append(text);
+    _sources.push_back(source{ begin, static_cast<uint32>(_line_starts.size()) });
+    _line_starts.push_back(begin);
+    return begin;
+}
+
+void source_manager::add_line_start(uint32 offset)
+{
+    _line_starts.push_back(offset);
+}
+
+uint32 source_manager::add_literal(const literal_value& literal)
+{
+    _literals.push_back(literal);
+    return static_cast<uint32>(_literals.size() - 1);
+}
+
+coord source_manager::position(uint32 offset) const
+{
+    const source& s = find_source(offset);
+    uint32 line = find_line(offset);
+    return { line - s.first_line + 1, offset - _line_starts[line] + 1 };
+}
+
+std::string_view source_manager::source_line(uint32 offset) const
+{
+    const source& s = find_source(offset);
+    uint32 line_start = _line_starts[find_line(offset)];
+
+    std::string_view rest(_text.data() + line_start, source_end(s) - line_start);
+    return rest.substr(0, rest.find('\n'));
+}
+
+const source_manager::source& source_manager::find_source(uint32 offset) const
+{
+    auto it = std::upper_bound(_sources.begin(), _sources.end(), offset, [](uint32 value, const source& s) {
+        return value < s.begin;
+    });
+
+    return *(it - 1);
+}
+
+uint32 source_manager::source_end(const source& s) const noexcept
+{
+    const source* next = &s + 1;
+    return next != _sources.data() + _sources.size() ? next->begin : static_cast<uint32>(_text.size());
+}
+
+uint32 source_manager::find_line(uint32 offset) const
+{
+    auto it = std::upper_bound(_line_starts.begin(), _line_starts.end(), offset);
+    return static_cast<uint32>(it - _line_starts.begin()) - 1;
+}
+
+NAMESPACE_END
@@ -16,27 +16,33 @@ void debug_statement::accept_visitor(statement_visitor& v) { v.visit_debug_state
 // DEBUG STATEMENT
 // --------------------------------------------------
 
-function_declaration_statement::function_declaration_statement(const token& ident_name_, const std::vector<token>& params_, std::vector<std::unique_ptr<statement>>&& body_, bool static_method_)
+function_declaration_statement::function_declaration_statement(const token& ident_name_, vector_t<token>&& params_, vector_t<unique_ptr_t<statement>>&& body_, bool static_method_)
     : ident_name(ident_name_)
-    , params(params_)
+    , params(std::move(params_))
     , body(std::move(body_))
-    , static_method(static_method_) { }
+    , static_method(static_method_)
+    , slot(-1)
+    , referenced(true)
+    , hotness(0)
+    , jit_code(nullptr) { }
 
-variable_declaration_statement::variable_declaration_statement(const token& ident_name_, std::unique_ptr<expression> initializer_expr_)
+variable_declaration_statement::variable_declaration_statement(const token& ident_name_, unique_ptr_t<expression> initializer_expr_)
     : ident_name(ident_name_)
-    , initializer_expr(std::move(initializer_expr_)) { }
+    , initializer_expr(std::move(initializer_expr_))
+    , slot(-1)
+    , referenced(true) { }
 
-if_statement::if_statement(std::unique_ptr<expression> condition_, std::unique_ptr<statement> if_branch_, std::unique_ptr<statement> else_branch_)
+if_statement::if_statement(unique_ptr_t<expression> condition_, unique_ptr_t<statement> if_branch_, unique_ptr_t<statement> else_branch_)
     : condition(std::move(condition_))
     , if_branch(std::move(if_branch_))
     , else_branch(std::move(else_branch_)) { }
 
-while_statement::while_statement(std::unique_ptr<expression> condition_, std::unique_ptr<statement> stmt_body_)
+while_statement::while_statement(unique_ptr_t<expression> condition_, unique_ptr_t<statement> stmt_body_)
     : condition(std::move(condition_))
     , stmt_body(std::move(stmt_body_)) { }
 
-for_statement::for_statement(std::unique_ptr<statement> initializer_, std::unique_ptr<expression> condition_,
-        std::unique_ptr<expression> increment_, std::unique_ptr<statement>&& stmt_body_, const token& for_token_)
+for_statement::for_statement(unique_ptr_t<statement> initializer_, unique_ptr_t<expression> condition_,
+        unique_ptr_t<expression> increment_, unique_ptr_t<statement>&& stmt_body_, const token& for_token_)
     : initializer(std::move(initializer_))
     , condition(std::move(condition_))
     , increment(std::move(increment_))
@@ -50,18 +56,18 @@ break_statement::break_statement(const token& t)
 continue_statement::continue_statement(const token& t)
     : continue_token(t) { }
 
-return_statement::return_statement(const token& keyword_, std::unique_ptr<expression> expr_)
+return_statement::return_statement(const token& keyword_, unique_ptr_t<expression> expr_)
     : keyword(keyword_)
     , return_expr(std::move(expr_)) { }
 
-block_statement::block_statement(std::vector<std::unique_ptr<statement>>&& statements_)
+block_statement::block_statement(vector_t<unique_ptr_t<statement>>&& statements_)
     : statements(std::move(statements_)) { }
 
-class_statement::class_statement(const token& name_, std::vector<std::unique_ptr<function_declaration_statement>>&& methods_,
-        std::unique_ptr<expression> superclass_)
-    : name(name_), methods(std::move(methods_)), superclass(std::move(superclass_)) { }
+class_statement::class_statement(const token& name_, vector_t<unique_ptr_t<function_declaration_statement>>&& methods_,
+        unique_ptr_t<expression> superclass_)
+    : name(name_), methods(std::move(methods_)), superclass(std::move(superclass_)), slot(-1) { }
 
-expression_statement::expression_statement(std::unique_ptr<expression> expr_)
+expression_statement::expression_statement(unique_ptr_t<expression> expr_)
     : expr(std::move(expr_)) { }
 
 void function_declaration_statement::accept_visitor(statement_visitor& v) { v.visit_function_declaration_statement(*this); }
@@ -76,4 +82,44 @@ void block_statement::accept_visitor(statement_visitor& v)                { v.vi
 void class_statement::accept_visitor(statement_visitor& v)                { v.visit_class_statement(*this); }
 void expression_statement::accept_visitor(statement_visitor& v)           { v.visit_expression_statement(*this); }
 
+namespace
+{
+    class callable_finder final : public statement_visitor
+    {
+    public:
+        bool found = false;
+
+        void find(const unique_ptr_t<statement>& stmt)
+        {
+            if (stmt && !found)
+                stmt->accept_visitor(*this);
+        }
+
+        virtual void visit_debug_statement(debug_statement&) override { }
+        virtual void visit_function_declaration_statement(function_declaration_statement&) override { found = true; }
+        virtual void visit_variable_declaration_statement(variable_declaration_statement&) override { }
+        virtual void visit_if_statement(if_statement& stmt) override { find(stmt.if_branch); find(stmt.else_branch); }
+        virtual void visit_while_statement(while_statement& stmt) override { find(stmt.stmt_body); }
+        virtual void visit_for_statement(for_statement& stmt) override { find(stmt.initializer); find(stmt.stmt_body); }
+        virtual void visit_break_statement(break_statement&) override { }
+        virtual void visit_continue_statement(continue_statement&) override { }
+        virtual void visit_return_statement(return_statement&) override { }
+        virtual void visit_class_statement(class_statement&) override { found = true; }
+        virtual void visit_expression_statement(expression_statement&) override { }
+
+        virtual void visit_block_statement(block_statement& stmt) override
+        {
+            for (const unique_ptr_t<statement>& s : stmt.statements)
+                find(s);
+        }
+    };
+}
+
+bool declares_callable(statement& stmt)
+{
+    callable_finder finder;
+    stmt.accept_visitor(finder);
+    return finder.found;
+}
+
 NAMESPACE_END
@@ -0,0 +1,52 @@
+#include "symbol_table.h"
+#include "typedefs.h"
+#include <functional>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+NAMESPACE_BEGIN(cpplox)
+
+symbol_table& symbol_table::instance()
+{
+    static symbol_table table;
+    return table;
+}
+
+symbol_table::symbol_table()
+    : _symbols()
+    , _by_id()
+    , _lookup()
+    , _name_bytes(0)
+    , _intern_calls(0) { }
+
+const symbol* symbol_table::intern(std::string_view name)
+{
+    ++_intern_calls;
+
+    auto it = _lookup.find(name);
+    if (it != _lookup.end())
+        return it->second;
+
+    size_t hash = std::hash<std::string_view>{}(name);
+    const symbol& s = _symbols.emplace_back(symbol{ std::string(name), hash, static_cast<uint32>(_by_id.size()) });
+    _by_id.push_back(&s);
+    _lookup.emplace(std::string_view(s.name), &s);
+    _name_bytes += name.size();
+    return &s;
+}
+
+size_t symbol_table::size() const noexcept
+{
+    return _symbols.size();
+}
+
+void symbol_table::print_stats(std::ostream& os) const
+{
+    os << "[ Symbol Table Stats ]\n";
+    os << "symbols:      " << _symbols.size() << '\n';
+    os << "name bytes:   " << _name_bytes << '\n';
+    os << "intern calls: " << _intern_calls << '\n';
+}
+
+NAMESPACE_END
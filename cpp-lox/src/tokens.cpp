@@ -1,4 +1,5 @@
 #include "tokens.h"
+#include "source_manager.h"
 #include "typedefs.h"
 #include <ostream>
 #include <sstream>
@@ -73,19 +74,28 @@ std::string debug_to_string(const token& t)
 
 token create_dummy_token(token_type type)
 {
-    token t{ type, token_type_tostr.at(type), "", { 0, 0 }, "" };
-    return t;
+    // The names of all types are added to the sources together on the first call.  A streaming lexer
+    // makes that call before it adds its own source, which has to stay the last one while it runs.
+    static const std::unordered_map<token_type, token> dummy_tokens = []() {
+        std::unordered_map<token_type, token> tokens;
+        for (const auto& [t, name] : token_type_tostr)
+            tokens.emplace(t, token{ t, source_manager::instance().add_source(name), static_cast<uint32>(name.size()), 0 });
+        return tokens;
+    }();
+
+    return dummy_tokens.at(type);
 }
 
 NAMESPACE_END
 
 std::ostream& operator<<(std::ostream& os, const cpplox::token& t)
 {
+    cpplox::coord position = t.position();
     os << "token [type: "
        << cpplox::token_type_tostr.at(t.type)
-       << ", lexeme: " << t.lexeme
-       << ", literal: " << cpplox::literal_value_to_runtime_string(t.literal)
-       << ", line/col: " << t.position.first << ":" << t.position.second
+       << ", lexeme: " << t.lexeme()
+       << ", literal: " << (t.type == cpplox::token_type::identifier_ ? "null" : cpplox::literal_value_to_runtime_string(t.literal()))
+       << ", line/col: " << position.first << ":" << position.second
        << "]";
     return os;
 }
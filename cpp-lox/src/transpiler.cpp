@@ -0,0 +1,735 @@
+#include "transpiler.h"
+#include "cpplox_types.h"
+#include "expressions.h"
+#include "inline_cache.h"
+#include "statements.h"
+#include "tokens.h"
+#include "typedefs.h"
+#include <cstdio>
+#include <string>
+#include <string_view>
+#include <vector>
+
+NAMESPACE_BEGIN(cpplox)
+
+namespace
+{
+    // The contents of a C++ string literal with the given text
+    std::string escape(std::string_view text)
+    {
+        std::string escaped;
+        escaped.reserve(text.size());
+
+        for (char c : text)
+        {
+            switch (c)
+            {
+                case '\\': escaped += "\\\\"; break;
+                case '"':  escaped += "\\\""; break;
+                case '\n': escaped += "\\n"; break;
+                case '\t': escaped += "\\t"; break;
+                case '\r': escaped += "\\r"; break;
+                default:
+                {
+                    unsigned char u = static_cast<unsigned char>(c);
+                    if (u < 0x20 || u >= 0x7f)
+                    {
+                        // Always three digits, so a digit that follows isn't taken as part of the escape
+                        char octal[5];
+                        std::snprintf(octal, sizeof(octal), "\\%03o", u);
+                        escaped += octal;
+                    }
+                    else
+                    {
+                        escaped += c;
+                    }
+                }
+            }
+        }
+
+        return escaped;
+    }
+
+    std::string hex(uint64 value)
+    {
+        char buffer[24];
+        std::snprintf(buffer, sizeof(buffer), "0x%016llxull", static_cast<unsigned long long>(value));
+        return buffer;
+    }
+
+    std::string slot(const variable_slot& resolved)
+    {
+        return "variable_slot{ " + std::to_string(resolved.depth) + ", " + std::to_string(resolved.slot) + " }";
+    }
+
+    // The operators aot_unary and aot_binary have a fast path for, nullptr for anything else
+    const char* operator_name(token_type type)
+    {
+        switch (type)
+        {
+            case token_type::plus_:          return "token_type::plus_";
+            case token_type::minus_:         return "token_type::minus_";
+            case token_type::star_:          return "token_type::star_";
+            case token_type::slash_:         return "token_type::slash_";
+            case token_type::modulo_:        return "token_type::modulo_";
+            case token_type::greater_:       return "token_type::greater_";
+            case token_type::greater_equal_: return "token_type::greater_equal_";
+            case token_type::less_:          return "token_type::less_";
+            case token_type::less_equal_:    return "token_type::less_equal_";
+            case token_type::equal_equal_:   return "token_type::equal_equal_";
+            case token_type::bang_equal_:    return "token_type::bang_equal_";
+            case token_type::bang_:          return "token_type::bang_";
+            default:                         return nullptr;
+        }
+    }
+
+    const char* kind_name(property_site_kind kind)
+    {
+        switch (kind)
+        {
+            case property_site_kind::get:    return "property_site_kind::get";
+            case property_site_kind::set:    return "property_site_kind::set";
+            case property_site_kind::invoke: return "property_site_kind::invoke";
+        }
+
+        return "property_site_kind::get";
+    }
+
+    // Tables that would be empty still need a size
+    constexpr std::string_view entry_parameters = "(aot_function& self, [[maybe_unused]] cpplox_instance* receiver, const std::vector<literal_value>& args)";
+}
+
+transpiler::transpiler(std::string_view source, uint32 source_offset, std::string_view source_name)
+    : _source(source)
+    , _source_offset(source_offset)
+    , _source_name(source_name)
+    , _token_indices()
+    , _token_inits()
+    , _string_indices()
+    , _string_inits()
+    , _cache_inits()
+    , _function_declarations()
+    , _function_definitions()
+    , _out(nullptr)
+    , _indent(0)
+    , _in_initializer(false)
+    , _loops()
+    , _next_name(0)
+    , _calls(0) { }
+
+std::string transpiler::transpile(vector_t<unique_ptr_t<statement>>& statements)
+{
+    std::string program;
+    _out = &program;
+    _indent = 2;
+
+    for (const auto& stmt : statements)
+        emit(*stmt);
+
+    std::string cpp;
+    cpp += "// Generated by cpp-lox-aot from " + _source_name + "\n";
+    cpp += "#include \"aot_runtime.h\"\n";
+    cpp += "#include <string_view>\n";
+    cpp += "#include <vector>\n\n";
+    cpp += "using namespace cpplox;\n\n";
+    cpp += "namespace\n{\n";
+
+    // The source is kept for the positions and lines of errors
+    cpp += "    const char source_text[] =\n";
+    size_t line_start = 0;
+    while (line_start < _source.size())
+    {
+        size_t line_end = _source.find('\n', line_start);
+        line_end = line_end == std::string_view::npos ? _source.size() : line_end + 1;
+        cpp += "        \"" + escape(_source.substr(line_start, line_end - line_start)) + "\"\n";
+        line_start = line_end;
+    }
+    cpp += "        \"\";\n\n";
+
+    // Tables nothing refers to are left out, an array can't be empty
+    cpp += "    aot_runtime* rt = nullptr;\n";
+    if (!_token_inits.empty())
+        cpp += "    token tokens[" + std::to_string(_token_inits.size()) + "];\n";
+    if (!_string_inits.empty())
+        cpp += "    literal_value strings[" + std::to_string(_string_inits.size()) + "];\n";
+    if (!_cache_inits.empty())
+        cpp += "    inline_cache* caches[" + std::to_string(_cache_inits.size()) + "];\n";
+    cpp += "\n";
+
+    for (const std::string& declaration : _function_declarations)
+        cpp += "    " + declaration + "\n";
+    if (!_function_declarations.empty())
+        cpp += "\n";
+
+    cpp += "    void make_constants()\n    {\n";
+    for (size_t i = 0; i < _token_inits.size(); ++i)
+        cpp += "        tokens[" + std::to_string(i) + "] = " + _token_inits[i] + ";\n";
+    for (size_t i = 0; i < _string_inits.size(); ++i)
+        cpp += "        strings[" + std::to_string(i) + "] = " + _string_inits[i] + ";\n";
+    for (size_t i = 0; i < _cache_inits.size(); ++i)
+        cpp += "        caches[" + std::to_string(i) + "] = " + _cache_inits[i] + ";\n";
+    cpp += "    }\n\n";
+
+    for (const std::string& definition : _function_definitions)
+        cpp += definition + "\n";
+
+    cpp += "    void run_program()\n    {\n" + program + "    }\n";
+    cpp += "}\n\n";
+
+    cpp += "int main()\n{\n";
+    cpp += "    aot_runtime runtime(std::string_view(source_text, sizeof(source_text) - 1));\n";
+    cpp += "    rt = &runtime;\n";
+    cpp += "    make_constants();\n";
+    cpp += "    return runtime.run(run_program);\n";
+    cpp += "}\n";
+
+    return cpp;
+}
+
+void transpiler::visit_debug_statement(debug_statement& stmt)
+{
+
+}
+
+void transpiler::visit_function_declaration_statement(function_declaration_statement& stmt)
+{
+    std::string entry = function(stmt, false);
+    line("rt->define(" + token_ref(stmt.ident_name) + ", " + std::to_string(stmt.slot) + ", rt->make_function(&" + entry + ", "
+            + token_ref(stmt.ident_name) + ", " + std::to_string(stmt.params.size()) + "));");
+}
+
+void transpiler::visit_variable_declaration_statement(variable_declaration_statement& stmt)
+{
+    open_block();
+    std::string value = stmt.initializer_expr ? emit(*stmt.initializer_expr) : "literal_value(undefined{})";
+    line("rt->define(" + token_ref(stmt.ident_name) + ", " + std::to_string(stmt.slot) + ", " + value + ");");
+    close_block();
+}
+
+void transpiler::visit_if_statement(if_statement& stmt)
+{
+    std::string taken = condition(stmt.condition.get());
+
+    line("if (" + taken + ")");
+    open_block();
+    emit(*stmt.if_branch);
+    close_block();
+
+    if (stmt.else_branch)
+    {
+        line("else");
+        open_block();
+        emit(*stmt.else_branch);
+        close_block();
+    }
+}
+
+void transpiler::visit_while_statement(while_statement& stmt)
+{
+    line("while (true)");
+    open_block();
+
+    std::string taken = condition(stmt.condition.get());
+    line("if (!" + taken + ")");
+    line("    break;");
+
+    _loops.push_back(loop{});
+    open_block();
+    emit(*stmt.stmt_body);
+    close_block();
+    _loops.pop_back();
+
+    close_block();
+}
+
+void transpiler::visit_for_statement(for_statement& stmt)
+{
+    open_block();
+    line("aot_scope " + new_name("scope") + "(rt->environments());");
+
+    if (stmt.initializer)
+        emit(*stmt.initializer);
+
+    line("while (true)");
+    open_block();
+
+    std::string taken = condition(stmt.condition.get());
+    line("if (!" + taken + ")");
+    line("    break;");
+
+    // A continue skips the rest of the body but still runs the increment
+    _loops.push_back(loop{ new_name("continue_") });
+    open_block();
+    emit(*stmt.stmt_body);
+    close_block();
+    loop body = _loops.back();
+    _loops.pop_back();
+
+    if (body.continued)
+        line(body.continue_label + ":;");
+
+    if (stmt.increment)
+    {
+        open_block();
+        discard(emit(*stmt.increment));
+        close_block();
+    }
+
+    close_block();
+    close_block();
+}
+
+void transpiler::visit_break_statement(break_statement& stmt)
+{
+    line("break;");
+}
+
+void transpiler::visit_continue_statement(continue_statement& stmt)
+{
+    loop& innermost = _loops.back();
+
+    if (innermost.continue_label.empty())
+    {
+        line("continue;");
+    }
+    else
+    {
+        innermost.continued = true;
+        line("goto " + innermost.continue_label + ";");
+    }
+}
+
+void transpiler::visit_return_statement(return_statement& stmt)
+{
+    open_block();
+    std::string value = stmt.return_expr ? emit(*stmt.return_expr) : "literal_value()";
+
+    // An initializer gives back its receiver whatever it returns
+    if (_in_initializer)
+        line("return receiver;");
+    else
+        line("return " + value + ";");
+
+    close_block();
+}
+
+void transpiler::visit_block_statement(block_statement& stmt)
+{
+    open_block();
+    line("aot_scope " + new_name("scope") + "(rt->environments());");
+
+    for (const auto& s : stmt.statements)
+        emit(*s);
+
+    close_block();
+}
+
+void transpiler::visit_class_statement(class_statement& stmt)
+{
+    open_block();
+
+    std::string superclass = "nullptr";
+    if (stmt.superclass)
+    {
+        std::string value = emit(*stmt.superclass);
+        std::string name = new_name("s");
+        line("literal_value " + name + " = " + value + ";");
+        superclass = "&" + name;
+    }
+
+    std::vector<std::string> methods;
+    for (const auto& method : stmt.methods)
+    {
+        std::string entry = function(*method, method->ident_name.lexeme() == "init");
+        methods.push_back("aot_method{ &" + entry + ", " + token_ref(method->ident_name) + ", " + std::to_string(method->params.size())
+                + ", " + (method->static_method ? "true" : "false") + " },");
+    }
+
+    line("rt->define_class(" + token_ref(stmt.name) + ", " + std::to_string(stmt.slot) + ", " + superclass + ", {");
+    for (const std::string& method : methods)
+        line("    " + method);
+    line("});");
+
+    close_block();
+}
+
+void transpiler::visit_expression_statement(expression_statement& stmt)
+{
+    open_block();
+    discard(emit(*stmt.expr));
+    close_block();
+}
+
+std::string transpiler::visit_unary(unary_expression& expr)
+{
+    const token& oper = expr.oper;
+
+    if (oper.type == token_type::plus_plus_ || oper.type == token_type::minus_minus_)
+        return increment(oper, *expr.expr_rhs, true);
+
+    std::string rhs = emit(*expr.expr_rhs);
+
+    if (const char* name = operator_name(oper.type))
+        return temporary("aot_unary<" + std::string(name) + ">(" + token_ref(oper) + ", " + rhs + ")");
+
+    return temporary("apply_unary_operator(" + token_ref(oper) + ", " + rhs + ")");
+}
+
+std::string transpiler::visit_binary(binary_expression& expr)
+{
+    std::string lhs = emit(*expr.expr_lhs);
+
+    size_t calls = _calls;
+    std::string rhs_code;
+    std::string rhs = emit_deferred(*expr.expr_rhs, rhs_code);
+
+    // The left operand only has to be rooted when evaluating the right one can reach a safe point
+    if (_calls != calls)
+    {
+        std::string roots = new_name("r");
+        line("temporary_roots " + roots + ";");
+        line("if (!" + lhs + ".is_number())");
+        line("    " + roots + ".add(" + lhs + ");");
+    }
+
+    _out->append(rhs_code);
+
+    const token& oper = expr.oper;
+    if (const char* name = operator_name(oper.type))
+        return temporary("aot_binary<" + std::string(name) + ">(" + token_ref(oper) + ", " + lhs + ", " + rhs + ")");
+
+    return temporary("apply_binary_operator(" + token_ref(oper) + ", " + lhs + ", " + rhs + ")");
+}
+
+std::string transpiler::visit_literal(literal_expression& expr)
+{
+    const literal_value& value = expr.literal_val;
+
+    switch (value.type())
+    {
+        case cpplox_type::number_:    return "literal_value::from_bits(" + hex(value.raw_bits()) + ")";
+        case cpplox_type::string_:    return string_ref(value.as_string()->value());
+        case cpplox_type::bool_:      return value.as_bool() ? "literal_value(true)" : "literal_value(false)";
+        case cpplox_type::undefined_: return "literal_value(undefined{})";
+        default:                      return "literal_value()";
+    }
+}
+
+std::string transpiler::visit_grouping(grouping_expression& expr)
+{
+    return emit(*expr.expr_group);
+}
+
+std::string transpiler::visit_variable(variable_expression& expr)
+{
+    return temporary("rt->lookup(" + token_ref(expr.ident_name) + ", " + slot(expr.resolved) + ")");
+}
+
+std::string transpiler::visit_assignment(assignment_expression& expr)
+{
+    std::string value = emit(*expr.initializer_expr);
+    line("rt->assign(" + token_ref(expr.ident_name) + ", " + slot(expr.resolved) + ", " + value + ");");
+    return value;
+}
+
+std::string transpiler::visit_logical(logical_expression& expr)
+{
+    std::string result = temporary(emit(*expr.expr_lhs));
+
+    if (expr.oper.type == token_type::or_)
+        line("if (!aot_truthy(" + result + "))");
+    else
+        line("if (aot_truthy(" + result + "))");
+
+    open_block();
+    std::string rhs = emit(*expr.expr_rhs);
+    line(result + " = " + rhs + ";");
+    close_block();
+
+    return result;
+}
+
+std::string transpiler::visit_postfix(postfix_expression& expr)
+{
+    return increment(expr.oper, *expr.expr_lhs, false);
+}
+
+std::string transpiler::visit_call(call_expression& expr)
+{
+    std::string roots;
+
+    // Method calls pass the receiver straight to the method, like in the tree-walker
+    if (get_expression* get_expr = dynamic_cast<get_expression*>(expr.callee.get()))
+    {
+        std::string object = emit(*get_expr->object);
+        deferred_arguments args = defer_arguments(expr.arguments);
+
+        if (args.total_calls > 0)
+        {
+            roots = new_name("r");
+            line("temporary_roots " + roots + ";");
+            line(roots + ".add(" + object + ");");
+        }
+
+        std::string method = new_name("m");
+        line("cpplox_callable* " + method + ";");
+        std::string callee = temporary("rt->method_target(*" + cache_ref(property_site_kind::invoke, get_expr->name) + ", " + object + ", " + method + ")");
+
+        if (!roots.empty())
+        {
+            line("if (!" + method + ")");
+            line("    " + roots + ".add(" + callee + ");");
+        }
+
+        std::string arguments = emit_arguments(args, roots);
+        ++_calls;
+        return temporary(method + " ? rt->call_method(" + method + ", " + object + ".as_instance(), " + arguments + ") : rt->call("
+                + token_ref(expr.paren) + ", " + callee + ", " + arguments + ")");
+    }
+
+    std::string callee = emit(*expr.callee);
+    deferred_arguments args = defer_arguments(expr.arguments);
+
+    if (args.total_calls > 0)
+    {
+        roots = new_name("r");
+        line("temporary_roots " + roots + ";");
+        line(roots + ".add(" + callee + ");");
+    }
+
+    std::string arguments = emit_arguments(args, roots);
+    ++_calls;
+    return temporary("rt->call(" + token_ref(expr.paren) + ", " + callee + ", " + arguments + ")");
+}
+
+std::string transpiler::visit_get(get_expression& expr)
+{
+    std::string object = emit(*expr.object);
+    return temporary("rt->get_property(*" + cache_ref(property_site_kind::get, expr.name) + ", " + object + ")");
+}
+
+std::string transpiler::visit_set(set_expression& expr)
+{
+    std::string object = emit(*expr.object);
+    std::string instance = new_name("i");
+    line("cpplox_instance* " + instance + " = rt->settable(" + token_ref(expr.name) + ", " + object + ");");
+
+    size_t calls = _calls;
+    std::string value_code;
+    std::string value = emit_deferred(*expr.value, value_code);
+
+    if (_calls != calls)
+    {
+        std::string roots = new_name("r");
+        line("temporary_roots " + roots + ";");
+        line(roots + ".add(" + object + ");");
+    }
+
+    _out->append(value_code);
+    line("rt->set_property(*" + cache_ref(property_site_kind::set, expr.name) + ", " + instance + ", " + value + ");");
+    return value;
+}
+
+std::string transpiler::visit_this(this_expression& expr)
+{
+    return temporary("rt->lookup(" + token_ref(expr.keyword) + ", " + slot(expr.resolved) + ")");
+}
+
+std::string transpiler::visit_super(super_expression& expr)
+{
+    return temporary("rt->super_method(" + token_ref(expr.keyword) + ", " + token_ref(expr.method) + ", " + slot(expr.resolved) + ")");
+}
+
+std::string transpiler::function(function_declaration_statement& stmt, bool initializer)
+{
+    std::string name = new_name("fn_") + "_" + std::string(stmt.ident_name.lexeme());
+    _function_declarations.push_back("literal_value " + name + std::string(entry_parameters) + ";");
+
+    std::string body;
+    std::string* enclosing_out = _out;
+    int enclosing_indent = _indent;
+    bool enclosing_initializer = _in_initializer;
+    std::vector<loop> enclosing_loops = std::move(_loops);
+
+    _out = &body;
+    _indent = 2;
+    _in_initializer = initializer;
+    _loops.clear();
+
+    line("aot_frame frame(rt->environments(), self, receiver, args);");
+    for (const auto& s : stmt.body)
+        emit(*s);
+    line("return literal_value();");
+
+    _out = enclosing_out;
+    _indent = enclosing_indent;
+    _in_initializer = enclosing_initializer;
+    _loops = std::move(enclosing_loops);
+
+    _function_definitions.push_back("    literal_value " + name + std::string(entry_parameters) + "\n    {\n" + body + "    }\n");
+    return name;
+}
+
+void transpiler::emit(statement& stmt)
+{
+    line("aot_safe_point();");
+    stmt.accept_visitor(*this);
+}
+
+std::string transpiler::emit(expression& expr)
+{
+    return expr.accept_visitor(*this);
+}
+
+std::string transpiler::emit_deferred(expression& expr, std::string& code)
+{
+    std::string* enclosing_out = _out;
+    _out = &code;
+    std::string value = emit(expr);
+    _out = enclosing_out;
+    return value;
+}
+
+std::string transpiler::condition(expression* expr)
+{
+    if (!expr)
+        return "true";
+
+    std::string name = new_name("c");
+    line("bool " + name + ";");
+    open_block();
+    std::string value = emit(*expr);
+    line(name + " = aot_truthy(" + value + ");");
+    close_block();
+    return name;
+}
+
+std::string transpiler::increment(const token& oper, expression& operand, bool prefix)
+{
+    variable_expression* variable = dynamic_cast<variable_expression*>(&operand);
+    std::string is_prefix = prefix ? "true" : "false";
+
+    if (!variable)
+    {
+        line("rt->invalid_increment_operand(" + token_ref(oper) + ", " + is_prefix + ");");
+        return "literal_value()";
+    }
+
+    return temporary("rt->increment(" + token_ref(oper) + ", " + token_ref(variable->ident_name) + ", " + slot(variable->resolved) + ", " + is_prefix + ")");
+}
+
+transpiler::deferred_arguments transpiler::defer_arguments(vector_t<unique_ptr_t<expression>>& arguments)
+{
+    deferred_arguments args;
+
+    for (const auto& arg : arguments)
+    {
+        size_t calls = _calls;
+        args.code.emplace_back();
+        args.values.push_back(emit_deferred(*arg, args.code.back()));
+        args.calls.push_back(_calls - calls);
+        args.total_calls += _calls - calls;
+    }
+
+    return args;
+}
+
+std::string transpiler::emit_arguments(const deferred_arguments& arguments, const std::string& roots)
+{
+    std::string name = new_name("a");
+    line("std::vector<literal_value> " + name + ";");
+    if (!arguments.values.empty())
+        line(name + ".reserve(" + std::to_string(arguments.values.size()) + ");");
+
+    size_t calls_after = arguments.total_calls;
+    for (size_t i = 0; i < arguments.values.size(); ++i)
+    {
+        calls_after -= arguments.calls[i];
+        _out->append(arguments.code[i]);
+        line(name + ".push_back(" + arguments.values[i] + ");");
+
+        if (calls_after > 0)
+            line(roots + ".add(" + name + ".back());");
+    }
+
+    return name;
+}
+
+void transpiler::line(std::string_view text)
+{
+    _out->append(static_cast<size_t>(_indent) * 4, ' ');
+    _out->append(text);
+    _out->push_back('\n');
+}
+
+void transpiler::open_block()
+{
+    line("{");
+    ++_indent;
+}
+
+void transpiler::close_block()
+{
+    --_indent;
+    line("}");
+}
+
+std::string transpiler::new_name(std::string_view prefix)
+{
+    return std::string(prefix) + std::to_string(_next_name++);
+}
+
+std::string transpiler::temporary(const std::string& code)
+{
+    std::string name = new_name("t");
+    line("literal_value " + name + " = " + code + ";");
+    return name;
+}
+
+void transpiler::discard(const std::string& value)
+{
+    line("(void)" + value + ";");
+}
+
+std::string transpiler::token_ref(const token& t)
+{
+    uint64 key = (static_cast<uint64>(t.type) << 56) | (static_cast<uint64>(t.length & 0xffffff) << 32) | t.offset;
+    auto it = _token_indices.find(key);
+    if (it != _token_indices.end())
+        return "tokens[" + std::to_string(it->second) + "]";
+
+    std::string type = "static_cast<token_type>(" + std::to_string(static_cast<int>(t.type)) + ")";
+    bool in_source = t.offset >= _source_offset && t.offset + t.length <= _source_offset + _source.size();
+
+    // Tokens the parser made up are looked up again the same way, the rest are rebuilt from the program's text
+    if (in_source)
+        _token_inits.push_back("rt->source_token(" + type + ", " + std::to_string(t.offset - _source_offset) + ", " + std::to_string(t.length) + ")");
+    else
+        _token_inits.push_back("create_dummy_token(" + type + ")");
+
+    size_t index = _token_inits.size() - 1;
+    _token_indices.emplace(key, index);
+    return "tokens[" + std::to_string(index) + "]";
+}
+
+std::string transpiler::string_ref(std::string_view text)
+{
+    std::string key(text);
+    auto it = _string_indices.find(key);
+    if (it != _string_indices.end())
+        return "strings[" + std::to_string(it->second) + "]";
+
+    _string_inits.push_back("memory_manager::instance().intern_string(std::string_view(\"" + escape(text) + "\", " + std::to_string(text.size()) + "))");
+
+    size_t index = _string_inits.size() - 1;
+    _string_indices.emplace(std::move(key), index);
+    return "strings[" + std::to_string(index) + "]";
+}
+
+std::string transpiler::cache_ref(property_site_kind kind, const token& name)
+{
+    _cache_inits.push_back("rt->add_cache(" + std::string(kind_name(kind)) + ", " + token_ref(name) + ")");
+    return "caches[" + std::to_string(_cache_inits.size() - 1) + "]";
+}
+
+NAMESPACE_END
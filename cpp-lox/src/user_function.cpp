@@ -0,0 +1,104 @@
+#include "cpplox_types.h"
+#include "environment.h"
+#include "interpreter.h"
+#include "jit.h"
+#include "memory_manager.h"
+#include "statements.h"
+#include "typedefs.h"
+#include <string>
+#include <variant>
+#include <vector>
+
+NAMESPACE_BEGIN(cpplox)
+
+user_function::user_function(function_declaration_statement& declaration_,
+        environment* closure_,
+        environment_manager* env_manager,
+        bool is_initializer,
+        cpplox_instance* receiver)
+    : declaration(declaration_)
+    , closure(closure_)
+    , _env_manager(env_manager)
+    , _is_initializer(is_initializer)
+    , _receiver(receiver) { }
+
+int user_function::arity() { return static_cast<int>(declaration.params.size()); }
+std::string user_function::to_string() const { return std::string("<user fn>" + std::string(declaration.ident_name.lexeme())); }
+
+literal_value user_function::call(interpreter& i, const std::vector<literal_value>& args)
+{
+    return call_method(i, _receiver, args);
+}
+
+literal_value user_function::call_method(interpreter& i, cpplox_instance* receiver, const std::vector<literal_value>& args)
+{
+    if (i._jit && !receiver && !_is_initializer)
+    {
+        literal_value result;
+        if (i._jit->try_call(declaration, args, result))
+            return result;
+    }
+
+    _env_manager->push_environment(closure);
+    environment* env = _env_manager->get_current_environment();
+
+    // Static methods have no slot for 'this', even when called through an instance
+    int first_param = 0;
+    if (receiver && !declaration.static_method)
+    {
+        env->define_slot(0, receiver);
+        first_param = 1;
+    }
+
+    for (size_t i = 0; i < declaration.params.size(); ++i)
+    {
+        env->define_slot(first_param + static_cast<int>(i), args[i]);
+    }
+
+    // Loops in the body make the function hotter while the jit is on and may still compile it
+    uint32* enclosing_hotness = i._loop_hotness;
+    if (i._jit)
+        i._loop_hotness = !receiver && !_is_initializer && !declaration.jit_code ? &declaration.hotness : nullptr;
+
+    try
+    {
+        i.execute_block(declaration.body, env);
+    }
+    catch (...)
+    {
+        i._loop_hotness = enclosing_hotness;
+        _env_manager->pop_environment();
+        throw;
+    }
+
+    i._loop_hotness = enclosing_hotness;
+    _env_manager->pop_environment();
+
+    if (i._completion != interpreter::completion::return_)
+        return std::monostate{};
+
+    i._completion = interpreter::completion::normal;
+
+    if (_is_initializer)
+        return receiver;
+
+    return std::move(i._return_value);
+}
+
+cpplox_callable* user_function::bind(cpplox_instance* instance)
+{
+    return memory_manager::instance().allocate<user_function>(declaration, closure, _env_manager, _is_initializer, instance);
+}
+
+void user_function::trace(memory_manager& mm)
+{
+    mm.mark(closure);
+    mm.mark(_receiver);
+}
+
+cpplox_callable* memory_manager::allocate_user_function(function_declaration_statement& stmt, environment* env, environment_manager* env_manager, bool is_initializer)
+{
+    return allocate<user_function>(stmt, env, env_manager, is_initializer);
+}
+
+NAMESPACE_END
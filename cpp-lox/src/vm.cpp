@@ -0,0 +1,689 @@
+#include "vm.h"
+#include "chunk.h"
+#include "compiler.h"
+#include "console_io.h"
+#include "cpplox_types.h"
+#include "debug_timer.h"
+#include "exceptions.h"
+#include "inline_cache.h"
+#include "memory_manager.h"
+#include "statements.h"
+#include "symbol_table.h"
+#include "tokens.h"
+#include "typedefs.h"
+#include "vm_types.h"
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <string>
+#include <variant>
+#include <vector>
+
+NAMESPACE_BEGIN(cpplox)
+
+vm::vm(console_io* io)
+    : _io(io)
+    , _stack(initial_stack_size)
+    , _stack_top(_stack.data())
+    , _frames()
+    , _globals()
+    , _global_slots()
+    , _scripts()
+    , _open_upvalues(nullptr)
+    , _had_error(false)
+{
+    memory_manager::instance().add_root_source(this);
+    instantiate_standard_library();
+}
+
+vm::~vm()
+{
+    memory_manager::instance().remove_root_source(this);
+}
+
+void vm::instantiate_standard_library()
+{
+    memory_manager& mm = memory_manager::instance();
+
+    define_native("clock", mm.allocate<class clock>());
+    define_native("print", mm.allocate<class print>(_io));
+    define_native("input", mm.allocate<class input>(_io));
+}
+
+void vm::define_native(const std::string& name, cpplox_callable* native)
+{
+    global_variable& global = _globals[global_slot(name)];
+    global.value = native;
+    global.defined = true;
+}
+
+uint16 vm::global_slot(const std::string& name)
+{
+    auto slot_it = _global_slots.find(name);
+    if (slot_it != _global_slots.end())
+        return slot_it->second;
+
+    if (_globals.size() >= std::numeric_limits<uint16>::max())
+        throw cpplox_runtime_error("Too many global variables");
+
+    uint16 slot = static_cast<uint16>(_globals.size());
+    _globals.push_back(global_variable{ name, undefined{}, false });
+    _global_slots[name] = slot;
+    return slot;
+}
+
+void vm::interpret(const vector_t<unique_ptr_t<statement>>& statements)
+{
+    try
+    {
+        compiler c(*this);
+        _scripts.push_back(c.compile(statements));
+    }
+    catch (const cpplox_runtime_error& e)
+    {
+        _had_error = true;
+        _io->err() << e.what() << '\n';
+        return;
+    }
+
+    debug_timer dt("vm::interpret()");
+
+    try
+    {
+        vm_closure* script = memory_manager::instance().allocate<vm_closure>(_scripts.back().get());
+
+        push(static_cast<cpplox_callable*>(script));
+        call_closure(script, 0);
+        run();
+    }
+    catch (const cpplox_runtime_error& e)
+    {
+        _had_error = true;
+        _io->err() << e.what() << '\n';
+        reset_stack();
+    }
+    catch (...)
+    {
+        _had_error = true;
+        _io->err() << "Exception swallower hit\n";
+        reset_stack();
+    }
+
+    // Only closures of the functions a script declares can refer to it after it has finished
+    if (_scripts.back()->code.functions.empty())
+        _scripts.pop_back();
+
+    dt.stop();
+}
+
+bool vm::error_occurred() const noexcept { return _had_error; }
+void vm::reset_error_flag() noexcept { _had_error = false; }
+
+void vm::mark_roots(memory_manager& mm)
+{
+    for (literal_value* slot = _stack.data(); slot < _stack_top; ++slot)
+        mm.mark(*slot);
+
+    for (const call_frame& frame : _frames)
+        mm.mark(frame.closure);
+
+    for (const global_variable& global : _globals)
+        mm.mark(global.value);
+
+    for (vm_upvalue* upvalue = _open_upvalues; upvalue != nullptr; upvalue = upvalue->next)
+        mm.mark(upvalue);
+}
+
+void vm::reset_stack()
+{
+    // Closures that escaped into globals may still reference these slots
+    close_upvalues(_stack.data());
+    _stack_top = _stack.data();
+    _frames.clear();
+}
+
+void vm::push(const literal_value& value)
+{
+    *_stack_top = value;
+    ++_stack_top;
+}
+
+literal_value vm::pop()
+{
+    --_stack_top;
+    return std::move(*_stack_top);
+}
+
+literal_value& vm::peek(size_t distance)
+{
+    return _stack_top[-1 - static_cast<std::ptrdiff_t>(distance)];
+}
+
+void vm::run()
+{
+    call_frame* frame = &_frames.back();
+    const chunk* code = &frame->closure->function->code;
+
+#define READ_BYTE() (*frame->ip++)
+#define READ_SHORT() (frame->ip += 2, static_cast<uint16>((frame->ip[-2] << 8) | frame->ip[-1]))
+#define CURRENT_TOKEN() (code->token_at(static_cast<size_t>(frame->ip - code->code.data() - 1)))
+#define REFRESH_FRAME() do { frame = &_frames.back(); code = &frame->closure->function->code; } while (false)
+#define NUMBER_BINARY_OP(apply)                                                                       \
+    do {                                                                                              \
+        literal_value& lhs = peek(1);                                                                 \
+        const literal_value& rhs = peek(0);                                                           \
+        if (literal_value::both_integers(lhs, rhs) || (lhs.is_number() && rhs.is_number()))             \
+            lhs = apply(lhs, rhs);                                                                    \
+        else                                                                                          \
+            lhs = apply_binary_operator(CURRENT_TOKEN(), lhs, rhs);                                   \
+        --_stack_top;                                                                                 \
+    } while (false)
+
+    while (true)
+    {
+        opcode instruction = static_cast<opcode>(READ_BYTE());
+
+        switch (instruction)
+        {
+            case opcode::constant_:
+            {
+                push(code->constants[READ_SHORT()]);
+            } break;
+            case opcode::null_:
+            {
+                push(std::monostate{});
+            } break;
+            case opcode::true_:
+            {
+                push(true);
+            } break;
+            case opcode::false_:
+            {
+                push(false);
+            } break;
+            case opcode::undefined_:
+            {
+                push(undefined{});
+            } break;
+            case opcode::pop_:
+            {
+                --_stack_top;
+            } break;
+            case opcode::get_local_:
+            {
+                const literal_value& value = frame->slots[READ_BYTE()];
+                if (value.is_undefined())
+                {
+                    const token& t = CURRENT_TOKEN();
+                    throw cpplox_runtime_error("Variable '" + std::string(t.lexeme()) + "' is undefined", t);
+                }
+
+                push(value);
+            } break;
+            case opcode::set_local_:
+            {
+                frame->slots[READ_BYTE()] = peek(0);
+            } break;
+            case opcode::get_global_:
+            {
+                const global_variable& global = _globals[READ_SHORT()];
+
+                if (!global.defined)
+                    throw cpplox_runtime_error("Undefined variable '" + global.name + "'", CURRENT_TOKEN());
+
+                if (global.value.is_undefined())
+                    throw cpplox_runtime_error("Variable '" + global.name + "' is undefined", CURRENT_TOKEN());
+
+                push(global.value);
+            } break;
+            case opcode::define_global_:
+            {
+                global_variable& global = _globals[READ_SHORT()];
+
+                if (global.defined)
+                    throw cpplox_runtime_error("Variable '" + global.name + "' already defined, did you mean to reassign it?");
+
+                global.value = pop();
+                global.defined = true;
+            } break;
+            case opcode::set_global_:
+            {
+                global_variable& global = _globals[READ_SHORT()];
+
+                if (!global.defined)
+                    throw cpplox_runtime_error("Undefined variable '" + global.name + "' can not be assigned to");
+
+                global.value = peek(0);
+            } break;
+            case opcode::get_upvalue_:
+            {
+                const literal_value& value = *frame->closure->upvalues[READ_BYTE()]->location;
+                if (value.is_undefined())
+                {
+                    const token& t = CURRENT_TOKEN();
+                    throw cpplox_runtime_error("Variable '" + std::string(t.lexeme()) + "' is undefined", t);
+                }
+
+                push(value);
+            } break;
+            case opcode::set_upvalue_:
+            {
+                vm_upvalue* upvalue = frame->closure->upvalues[READ_BYTE()];
+                *upvalue->location = peek(0);
+                memory_manager::write_barrier(upvalue, peek(0));
+            } break;
+            case opcode::get_property_:
+            {
+                inline_cache& cache = *code->caches[READ_SHORT()];
+                const token& name = CURRENT_TOKEN();
+                literal_value& object = peek(0);
+
+                if (object.is_instance())
+                {
+                    cpplox_instance* instance = object.as_instance();
+                    const inline_cache_entry& entry = cache.lookup_get(instance);
+
+                    if (entry.slot >= 0)
+                        object = instance->field_at(entry.slot);
+                    else
+                        object = entry.method->bind(instance);
+
+                    break;
+                }
+
+                if (object.is_callable())
+                {
+                    if (cpplox_class* klass = dynamic_cast<cpplox_class*>(object.as_callable()))
+                    {
+                        cpplox_callable* static_method = klass->find_method(name);
+                        if (!static_method)
+                            throw cpplox_runtime_error("Static method with name '" + std::string(name.lexeme()) + "' doesn't exist; are you trying to access an instance method or property?");
+
+                        object = static_method;
+                        break;
+                    }
+                }
+
+                throw cpplox_type_error("Only instances have properties", name);
+            } break;
+            case opcode::set_property_:
+            {
+                inline_cache& cache = *code->caches[READ_SHORT()];
+                const token& name = CURRENT_TOKEN();
+                if (!peek(1).is_instance())
+                    throw cpplox_type_error("Only instances have fields", name);
+
+                literal_value value = pop();
+                cpplox_instance* instance = peek(0).as_instance();
+                const inline_cache_entry& entry = cache.lookup_set(instance);
+
+                if (entry.transition)
+                    instance->add_field(entry.transition, value);
+                else
+                    instance->set_field(entry.slot, value);
+
+                peek(0) = value;
+            } break;
+            case opcode::get_super_:
+            {
+                const symbol* name = code->identifiers[READ_SHORT()];
+                const token& t = CURRENT_TOKEN();
+
+                cpplox_class* superclass = peek(0).is_class() ? peek(0).as_class() : nullptr;
+                if (!superclass)
+                    throw cpplox_runtime_error("Superclass could not be cast in visit_super", t);
+
+                if (!peek(1).is_instance())
+                    throw cpplox_runtime_error("Object could not be cast to a cpplox_instance* in visit_super", t);
+
+                cpplox_callable* method = superclass->find_method(name);
+                if (!method)
+                    throw cpplox_runtime_error("Undefined property '" + name->name + "'.");
+
+                literal_value bound = method->bind(peek(1).as_instance());
+                --_stack_top;
+                peek(0) = bound;
+            } break;
+            case opcode::equal_:
+            case opcode::not_equal_:
+            {
+                // Comparing values of two different types is a type error, like in the tree-walker
+                literal_value& lhs = peek(1);
+                const literal_value& rhs = peek(0);
+                if (lhs.type() == rhs.type())
+                    lhs = is_equal(lhs, rhs) == (instruction == opcode::equal_);
+                else
+                    lhs = apply_binary_operator(CURRENT_TOKEN(), lhs, rhs);
+                --_stack_top;
+            } break;
+            case opcode::greater_:       NUMBER_BINARY_OP(greater_numbers);       break;
+            case opcode::greater_equal_: NUMBER_BINARY_OP(greater_equal_numbers); break;
+            case opcode::less_:          NUMBER_BINARY_OP(less_numbers);          break;
+            case opcode::less_equal_:    NUMBER_BINARY_OP(less_equal_numbers);    break;
+            case opcode::add_:           NUMBER_BINARY_OP(add_numbers);           break;
+            case opcode::subtract_:      NUMBER_BINARY_OP(subtract_numbers);      break;
+            case opcode::multiply_:      NUMBER_BINARY_OP(multiply_numbers);      break;
+            case opcode::divide_:        NUMBER_BINARY_OP(divide_numbers);        break;
+            case opcode::modulo_:
+            {
+                literal_value& lhs = peek(1);
+                const literal_value& rhs = peek(0);
+                if (lhs.is_number() && rhs.is_number() && modulo_defined(lhs, rhs))
+                    lhs = modulo_numbers(lhs, rhs);
+                else
+                    lhs = apply_binary_operator(CURRENT_TOKEN(), lhs, rhs);
+                --_stack_top;
+            } break;
+            case opcode::not_:
+            {
+                literal_value& operand = peek(0);
+                operand = apply_unary_operator(CURRENT_TOKEN(), operand);
+            } break;
+            case opcode::negate_:
+            {
+                literal_value& operand = peek(0);
+                if (operand.is_number())
+                    operand = negate_number(operand);
+                else
+                    operand = apply_unary_operator(CURRENT_TOKEN(), operand);
+            } break;
+            case opcode::increment_:
+            case opcode::decrement_:
+            case opcode::postfix_increment_:
+            case opcode::postfix_decrement_:
+            {
+                if (!peek(0).is_number())
+                {
+                    const token& t = CURRENT_TOKEN();
+                    throw cpplox_type_error("Invalid type for postfix operator '" + std::string(t.lexeme()) + "'", t);
+                }
+
+                bool increment = instruction == opcode::increment_ || instruction == opcode::postfix_increment_;
+                literal_value one = int64{ 1 };
+                literal_value result = increment ? add_numbers(peek(0), one) : subtract_numbers(peek(0), one);
+
+                if (instruction == opcode::increment_ || instruction == opcode::decrement_)
+                    peek(0) = result;
+                else
+                    push(result);
+            } break;
+            case opcode::invalid_operand_:
+            {
+                std::string kind = READ_BYTE() ? "Postfix operator '" : "Unary prefix operator '";
+                const token& t = CURRENT_TOKEN();
+                throw cpplox_type_error(kind + std::string(t.lexeme()) + "' requires a variable operand", t);
+            } break;
+            case opcode::jump_:
+            {
+                uint16 offset = READ_SHORT();
+                frame->ip += offset;
+            } break;
+            case opcode::jump_if_false_:
+            {
+                uint16 offset = READ_SHORT();
+                if (!is_truthy(peek(0)))
+                    frame->ip += offset;
+            } break;
+            case opcode::loop_:
+            {
+                uint16 offset = READ_SHORT();
+                frame->ip -= offset;
+                memory_manager::instance().collect_if_needed();
+            } break;
+            case opcode::call_:
+            {
+                memory_manager::instance().collect_if_needed();
+                int arg_count = READ_BYTE();
+                call_value(peek(static_cast<size_t>(arg_count)), arg_count, CURRENT_TOKEN());
+                REFRESH_FRAME();
+            } break;
+            case opcode::invoke_:
+            {
+                memory_manager::instance().collect_if_needed();
+                inline_cache& cache = *code->caches[READ_SHORT()];
+                int arg_count = READ_BYTE();
+                invoke(cache, arg_count, CURRENT_TOKEN());
+                REFRESH_FRAME();
+            } break;
+            case opcode::closure_:
+            {
+                vm_function* function = code->functions[READ_SHORT()].get();
+                vm_closure* closure = memory_manager::instance().allocate<vm_closure>(function);
+                push(static_cast<cpplox_callable*>(closure));
+
+                for (vm_upvalue*& upvalue : closure->upvalues)
+                {
+                    uint8 is_local = READ_BYTE();
+                    uint8 index = READ_BYTE();
+
+                    if (is_local)
+                        upvalue = capture_upvalue(frame->slots + index);
+                    else
+                        upvalue = frame->closure->upvalues[index];
+                }
+            } break;
+            case opcode::close_upvalue_:
+            {
+                close_upvalues(_stack_top - 1);
+                --_stack_top;
+            } break;
+            case opcode::return_:
+            {
+                literal_value result = pop();
+                if (frame->constructs)
+                    result = *frame->slots;
+                close_upvalues(frame->slots);
+
+                _stack_top = frame->slots;
+                _frames.pop_back();
+
+                if (_frames.empty())
+                    return;
+
+                push(result);
+                REFRESH_FRAME();
+            } break;
+            case opcode::class_:
+            {
+                const symbol* name = code->identifiers[READ_SHORT()];
+                push(memory_manager::instance().allocate_class(name->name, {}, nullptr));
+            } break;
+            case opcode::inherit_:
+            {
+                cpplox_class* klass = static_cast<cpplox_class*>(pop().as_callable());
+                literal_value& superclass_slot = peek(0);
+                cpplox_class* superclass = nullptr;
+
+                if (superclass_slot.is_callable())
+                {
+                    superclass = dynamic_cast<cpplox_class*>(superclass_slot.as_callable());
+
+                    if (!superclass)
+                        throw cpplox_runtime_error("Could not superclass from attemped class, superclass specified was not a class", CURRENT_TOKEN());
+                }
+
+                klass->superclass = superclass;
+                memory_manager::write_barrier(klass, superclass);
+                superclass_slot = superclass;
+            } break;
+            case opcode::method_:
+            {
+                const symbol* name = code->identifiers[READ_SHORT()];
+                cpplox_class* klass = static_cast<cpplox_class*>(peek(1).as_callable());
+                klass->methods[name] = peek(0).as_callable();
+                memory_manager::write_barrier(klass, peek(0));
+                --_stack_top;
+            } break;
+        }
+    }
+
+#undef NUMBER_BINARY_OP
+#undef REFRESH_FRAME
+#undef CURRENT_TOKEN
+#undef READ_SHORT
+#undef READ_BYTE
+}
+
+void vm::call_value(const literal_value& callee, int arg_count, const token& t)
+{
+    if (!callee.is_callable())
+        throw cpplox_type_error("Cannot call '()' non-callable type", t);
+
+    cpplox_callable* callable = callee.as_callable();
+
+    if (vm_closure* closure = dynamic_cast<vm_closure*>(callable))
+    {
+        call_closure(closure, arg_count);
+        return;
+    }
+
+    if (vm_bound_method* bound = dynamic_cast<vm_bound_method*>(callable))
+    {
+        peek(static_cast<size_t>(arg_count)) = bound->receiver;
+        call_closure(bound->method, arg_count);
+        return;
+    }
+
+    if (cpplox_class* klass = dynamic_cast<cpplox_class*>(callable))
+    {
+        cpplox_instance* instance = memory_manager::instance().allocate_instance(klass);
+        peek(static_cast<size_t>(arg_count)) = instance;
+
+        cpplox_callable* initializer = klass->initializer();
+        if (initializer)
+        {
+            call_closure(static_cast<vm_closure*>(initializer), arg_count, true);
+        }
+        else if (arg_count != 0)
+        {
+            throw cpplox_runtime_error("Expected 0 arguments but got " + std::to_string(arg_count));
+        }
+
+        return;
+    }
+
+    if (native_function* native = dynamic_cast<native_function*>(callable))
+    {
+        if (native->arity() != arg_count)
+            throw cpplox_runtime_error("Expected " + std::to_string(native->arity()) + " arguments but got " + std::to_string(arg_count));
+
+        std::vector<literal_value> args(_stack_top - arg_count, _stack_top);
+        literal_value result = native->call_native(args);
+        _stack_top -= arg_count + 1;
+        push(result);
+        return;
+    }
+
+    throw cpplox_type_error("Cannot call '()' non-callable type", t);
+}
+
+void vm::call_closure(vm_closure* closure, int arg_count, bool constructs)
+{
+    if (closure->function->arity != arg_count)
+        throw cpplox_runtime_error("Expected " + std::to_string(closure->function->arity) + " arguments but got " + std::to_string(arg_count));
+
+    if (_frames.size() >= max_frames)
+        throw cpplox_runtime_error("Stack overflow");
+
+    // Every frame can address 256 slots, keep enough headroom for the callee's locals and temporaries
+    if (_stack_top + 512 > _stack.data() + _stack.size())
+        grow_stack();
+
+    _frames.push_back(call_frame{ closure, closure->function->code.code.data(), _stack_top - arg_count - 1, constructs });
+}
+
+void vm::grow_stack()
+{
+    std::vector<literal_value> grown(_stack.size() * 2);
+    std::move(_stack.data(), _stack_top, grown.data());
+
+    // Frames, open upvalues and the top all point into the stack, move them along with the values
+    auto rebase = [this, &grown](literal_value* slot) { return grown.data() + (slot - _stack.data()); };
+
+    for (call_frame& frame : _frames)
+        frame.slots = rebase(frame.slots);
+
+    for (vm_upvalue* upvalue = _open_upvalues; upvalue != nullptr; upvalue = upvalue->next)
+        upvalue->location = rebase(upvalue->location);
+
+    _stack_top = rebase(_stack_top);
+    _stack.swap(grown);
+}
+
+void vm::invoke(inline_cache& cache, int arg_count, const token& paren_token)
+{
+    const token& name_token = cache.name();
+    literal_value& receiver = peek(static_cast<size_t>(arg_count));
+
+    if (receiver.is_instance())
+    {
+        cpplox_instance* instance = receiver.as_instance();
+        const inline_cache_entry& entry = cache.lookup_get(instance);
+
+        // Fields shadow methods, in which case this is a plain call of the field value
+        if (entry.slot >= 0)
+        {
+            receiver = instance->field_at(entry.slot);
+            call_value(receiver, arg_count, paren_token);
+            return;
+        }
+
+        call_closure(static_cast<vm_closure*>(entry.method), arg_count);
+        return;
+    }
+
+    if (receiver.is_callable())
+    {
+        if (cpplox_class* klass = dynamic_cast<cpplox_class*>(receiver.as_callable()))
+        {
+            cpplox_callable* static_method = klass->find_method(name_token);
+            if (!static_method)
+                throw cpplox_runtime_error("Static method with name '" + std::string(name_token.lexeme()) + "' doesn't exist; are you trying to access an instance method or property?");
+
+            receiver = static_method;
+            call_closure(static_cast<vm_closure*>(static_method), arg_count);
+            return;
+        }
+    }
+
+    throw cpplox_type_error("Only instances have properties", name_token);
+}
+
+vm_upvalue* vm::capture_upvalue(literal_value* local)
+{
+    vm_upvalue* previous = nullptr;
+    vm_upvalue* upvalue = _open_upvalues;
+
+    while (upvalue != nullptr && upvalue->location > local)
+    {
+        previous = upvalue;
+        upvalue = upvalue->next;
+    }
+
+    if (upvalue != nullptr && upvalue->location == local)
+        return upvalue;
+
+    vm_upvalue* created = memory_manager::instance().allocate<vm_upvalue>(local);
+    created->next = upvalue;
+
+    if (previous == nullptr)
+        _open_upvalues = created;
+    else
+        previous->next = created;
+
+    return created;
+}
+
+void vm::close_upvalues(const literal_value* last)
+{
+    while (_open_upvalues != nullptr && _open_upvalues->location >= last)
+    {
+        vm_upvalue* upvalue = _open_upvalues;
+        upvalue->closed = *upvalue->location;
+        upvalue->location = &upvalue->closed;
+        memory_manager::write_barrier(upvalue, upvalue->closed);
+        _open_upvalues = upvalue->next;
+    }
+}
+
+NAMESPACE_END
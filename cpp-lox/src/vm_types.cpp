@@ -0,0 +1,71 @@
+#include "vm_types.h"
+#include "cpplox_types.h"
+#include "exceptions.h"
+#include "memory_manager.h"
+#include "typedefs.h"
+#include <string>
+#include <vector>
+
+NAMESPACE_BEGIN(cpplox)
+
+vm_function::vm_function(const std::string& name_, int arity_, bool is_initializer_)
+    : name(name_)
+    , arity(arity_)
+    , upvalue_count(0)
+    , is_initializer(is_initializer_)
+    , code() { }
+
+vm_upvalue::vm_upvalue(literal_value* slot)
+    : location(slot)
+    , closed(std::monostate{})
+    , next(nullptr) { }
+
+void vm_upvalue::trace(memory_manager& mm)
+{
+    // An open upvalue points into the vm stack, which is marked as a root already
+    if (location == &closed)
+        mm.mark(closed);
+}
+
+vm_closure::vm_closure(vm_function* function_)
+    : function(function_)
+    , upvalues(static_cast<size_t>(function_->upvalue_count), nullptr) { }
+
+int vm_closure::arity() { return function->arity; }
+std::string vm_closure::to_string() const { return "<user fn>" + function->name; }
+
+literal_value vm_closure::call(interpreter& i, const std::vector<literal_value>& args)
+{
+    throw cpplox_runtime_error("Compiled function '" + function->name + "' can only be called by the vm");
+}
+
+cpplox_callable* vm_closure::bind(cpplox_instance* instance)
+{
+    return memory_manager::instance().allocate<vm_bound_method>(instance, this);
+}
+
+void vm_closure::trace(memory_manager& mm)
+{
+    for (vm_upvalue* upvalue : upvalues)
+        mm.mark(upvalue);
+}
+
+vm_bound_method::vm_bound_method(const literal_value& receiver_, vm_closure* method_)
+    : receiver(receiver_)
+    , method(method_) { }
+
+int vm_bound_method::arity() { return method->arity(); }
+std::string vm_bound_method::to_string() const { return method->to_string(); }
+
+literal_value vm_bound_method::call(interpreter& i, const std::vector<literal_value>& args)
+{
+    return method->call(i, args);
+}
+
+void vm_bound_method::trace(memory_manager& mm)
+{
+    mm.mark(receiver);
+    mm.mark(method);
+}
+
+NAMESPACE_END
@@ -0,0 +1,209 @@
+#include "x64_assembler.h"
+#include "typedefs.h"
+#include <cstring>
+
+NAMESPACE_BEGIN(cpplox)
+
+namespace
+{
+    uint8 low_bits(x64_register r) { return static_cast<uint8>(r) & 7; }
+    uint8 high_bit(x64_register r) { return static_cast<uint8>(r) >> 3; }
+
+    uint8 modrm(uint8 mod, uint8 reg, uint8 rm)
+    {
+        return static_cast<uint8>((mod << 6) | ((reg & 7) << 3) | (rm & 7));
+    }
+}
+
+void x64_assembler::mov(reg dst, reg src)
+{
+    reg_reg(0x89, src, dst);
+}
+
+void x64_assembler::mov(reg dst, uint64 imm)
+{
+    emit(static_cast<uint8>(0x48 | high_bit(dst)));
+    emit(static_cast<uint8>(0xb8 + low_bits(dst)));
+    emit_uint64(imm);
+}
+
+void x64_assembler::load(reg dst, reg base, int32 disp)
+{
+    memory(0x8b, dst, base, disp);
+}
+
+void x64_assembler::store(reg base, int32 disp, reg src)
+{
+    memory(0x89, src, base, disp);
+}
+
+void x64_assembler::lea(reg dst, reg base, int32 disp)
+{
+    memory(0x8d, dst, base, disp);
+}
+
+void x64_assembler::push(reg r)
+{
+    if (high_bit(r))
+        emit(0x41);
+
+    emit(static_cast<uint8>(0x50 + low_bits(r)));
+}
+
+void x64_assembler::pop(reg r)
+{
+    if (high_bit(r))
+        emit(0x41);
+
+    emit(static_cast<uint8>(0x58 + low_bits(r)));
+}
+
+void x64_assembler::add(reg dst, reg src)   { reg_reg(0x01, src, dst); }
+void x64_assembler::sub(reg dst, reg src)   { reg_reg(0x29, src, dst); }
+void x64_assembler::and_(reg dst, reg src)  { reg_reg(0x21, src, dst); }
+void x64_assembler::or_(reg dst, reg src)   { reg_reg(0x09, src, dst); }
+void x64_assembler::xor_(reg dst, reg src)  { reg_reg(0x31, src, dst); }
+void x64_assembler::cmp(reg lhs, reg rhs)   { reg_reg(0x39, rhs, lhs); }
+void x64_assembler::test(reg lhs, reg rhs)  { reg_reg(0x85, rhs, lhs); }
+
+void x64_assembler::imul(reg dst, reg src)
+{
+    rex_w(dst, src);
+    emit(0x0f);
+    emit(0xaf);
+    emit(modrm(3, low_bits(dst), low_bits(src)));
+}
+
+void x64_assembler::add(reg dst, int32 imm) { immediate(0, dst, imm); }
+void x64_assembler::sub(reg dst, int32 imm) { immediate(5, dst, imm); }
+
+void x64_assembler::shl(reg dst, uint8 count) { shift(4, dst, count); }
+void x64_assembler::shr(reg dst, uint8 count) { shift(5, dst, count); }
+void x64_assembler::sar(reg dst, uint8 count) { shift(7, dst, count); }
+
+void x64_assembler::set(x64_condition cond, reg dst)
+{
+    // setcc on the low byte, which needs a REX prefix to mean sil, dil and r8b-r15b, then zero extend it
+    emit(static_cast<uint8>(0x40 | high_bit(dst)));
+    emit(0x0f);
+    emit(static_cast<uint8>(0x90 + static_cast<uint8>(cond)));
+    emit(modrm(3, 0, low_bits(dst)));
+
+    rex_w(dst, dst);
+    emit(0x0f);
+    emit(0xb6);
+    emit(modrm(3, low_bits(dst), low_bits(dst)));
+}
+
+void x64_assembler::call(reg target)
+{
+    if (high_bit(target))
+        emit(0x41);
+
+    emit(0xff);
+    emit(modrm(3, 2, low_bits(target)));
+}
+
+void x64_assembler::jmp(x64_label& target)
+{
+    emit(0xe9);
+    label_operand(target);
+}
+
+void x64_assembler::jcc(x64_condition cond, x64_label& target)
+{
+    emit(0x0f);
+    emit(static_cast<uint8>(0x80 + static_cast<uint8>(cond)));
+    label_operand(target);
+}
+
+void x64_assembler::bind(x64_label& label)
+{
+    label.position = static_cast<std::ptrdiff_t>(_code.size());
+
+    for (size_t use : label.uses)
+    {
+        patch_int32(use, static_cast<int32>(label.position - static_cast<std::ptrdiff_t>(use + 4)));
+    }
+
+    label.uses.clear();
+}
+
+void x64_assembler::leave() { emit(0xc9); }
+void x64_assembler::ret()   { emit(0xc3); }
+
+void x64_assembler::patch_int32(size_t offset, int32 value)
+{
+    std::memcpy(_code.data() + offset, &value, sizeof(value));
+}
+
+void x64_assembler::emit_int32(int32 value)
+{
+    size_t offset = _code.size();
+    _code.resize(offset + sizeof(value));
+    patch_int32(offset, value);
+}
+
+void x64_assembler::emit_uint64(uint64 value)
+{
+    size_t offset = _code.size();
+    _code.resize(offset + sizeof(value));
+    std::memcpy(_code.data() + offset, &value, sizeof(value));
+}
+
+void x64_assembler::rex_w(reg r, reg rm)
+{
+    emit(static_cast<uint8>(0x48 | (high_bit(r) << 2) | high_bit(rm)));
+}
+
+void x64_assembler::reg_reg(uint8 opcode, reg r, reg rm)
+{
+    rex_w(r, rm);
+    emit(opcode);
+    emit(modrm(3, low_bits(r), low_bits(rm)));
+}
+
+void x64_assembler::memory(uint8 opcode, reg r, reg base, int32 disp)
+{
+    rex_w(r, base);
+    emit(opcode);
+    emit(modrm(2, low_bits(r), low_bits(base)));
+
+    // rsp and r12 as a base can only be encoded with a SIB byte
+    if (low_bits(base) == 4)
+        emit(0x24);
+
+    emit_int32(disp);
+}
+
+void x64_assembler::shift(uint8 extension, reg dst, uint8 count)
+{
+    rex_w(reg::rax, dst);
+    emit(0xc1);
+    emit(modrm(3, extension, low_bits(dst)));
+    emit(count);
+}
+
+void x64_assembler::immediate(uint8 extension, reg dst, int32 imm)
+{
+    rex_w(reg::rax, dst);
+    emit(0x81);
+    emit(modrm(3, extension, low_bits(dst)));
+    _last_immediate = _code.size();
+    emit_int32(imm);
+}
+
+void x64_assembler::label_operand(x64_label& target)
+{
+    if (target.position >= 0)
+    {
+        emit_int32(static_cast<int32>(target.position - static_cast<std::ptrdiff_t>(_code.size() + 4)));
+    }
+    else
+    {
+        target.uses.push_back(_code.size());
+        emit_int32(0);
+    }
+}
+
+NAMESPACE_END
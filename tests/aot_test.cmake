@@ -0,0 +1,61 @@
+# Compiles SOURCE ahead of time with AOT_COMPILER and checks that the program prints exactly what the
+# interpreter prints for it, on stdout and stderr separately, and exits with the same status.  Errors the
+# compiler reports instead of building a program, like the resolver's, count as output of the program.
+#
+# Usage: cmake -DINTERPRETER=<cpp-lox> -DAOT_COMPILER=<cpp-lox-aot> -DSOURCE=<file> -DWORK_DIR=<dir> -P aot_test.cmake
+
+get_filename_component(name ${SOURCE} NAME_WE)
+file(MAKE_DIRECTORY ${WORK_DIR})
+
+set(program ${WORK_DIR}/${name})
+set(input ${WORK_DIR}/${name}.input)
+file(WRITE ${input} "aot test input\n")
+file(REMOVE ${program})
+
+# Program images go to the work directory rather than the user's cache
+set(ENV{CPPLOX_CACHE_DIR} ${WORK_DIR}/cache)
+
+execute_process(
+    COMMAND ${INTERPRETER} ${SOURCE}
+    INPUT_FILE ${input}
+    OUTPUT_VARIABLE expected_out
+    ERROR_VARIABLE expected_err
+    RESULT_VARIABLE expected_status
+)
+
+execute_process(
+    COMMAND ${AOT_COMPILER} -o ${program} ${SOURCE}
+    OUTPUT_VARIABLE actual_out
+    ERROR_VARIABLE actual_err
+    RESULT_VARIABLE actual_status
+)
+
+if(actual_status EQUAL 0)
+    execute_process(
+        COMMAND ${program}
+        INPUT_FILE ${input}
+        OUTPUT_VARIABLE program_out
+        ERROR_VARIABLE program_err
+        RESULT_VARIABLE actual_status
+    )
+
+    string(APPEND actual_out "${program_out}")
+    string(APPEND actual_err "${program_err}")
+endif()
+
+# clock() is the time in milliseconds, which differs between the two runs
+foreach(output expected_out expected_err actual_out actual_err)
+    string(REGEX REPLACE "[0-9][0-9][0-9][0-9][0-9][0-9][0-9][0-9][0-9][0-9][0-9][0-9][0-9]" "<clock>" ${output} "${${output}}")
+endforeach()
+
+if(NOT actual_out STREQUAL expected_out)
+    message(FATAL_ERROR "stdout differs from the interpreter's\n--- interpreter\n${expected_out}\n--- compiled\n${actual_out}")
+endif()
+
+if(NOT actual_err STREQUAL expected_err)
+    message(FATAL_ERROR "stderr differs from the interpreter's\n--- interpreter\n${expected_err}\n--- compiled\n${actual_err}")
+endif()
+
+if(NOT actual_status STREQUAL expected_status)
+    message(FATAL_ERROR "Exit status ${actual_status}, the interpreter's was ${expected_status}\n--- stderr\n${actual_err}")
+endif()
@@ -0,0 +1,64 @@
+# Runs SOURCE without a program image, then writing one to WORK_DIR, then from it, and again after the
+# image was damaged, and checks that every run prints exactly what the first one printed on stdout and
+# stderr.  A damaged image has to be replaced by a good one.
+#
+# Usage: cmake -DINTERPRETER=<cpp-lox> -DSOURCE=<file> -DWORK_DIR=<dir> -P image_test.cmake
+
+get_filename_component(name ${SOURCE} NAME_WE)
+set(cache_dir ${WORK_DIR}/${name})
+set(input ${WORK_DIR}/${name}.input)
+
+file(REMOVE_RECURSE ${cache_dir})
+file(MAKE_DIRECTORY ${cache_dir})
+file(WRITE ${input} "image test input\n")
+
+function(run_interpreter out err)
+    execute_process(
+        COMMAND ${INTERPRETER} ${ARGN} ${SOURCE}
+        INPUT_FILE ${input}
+        OUTPUT_VARIABLE run_out
+        ERROR_VARIABLE run_err
+    )
+
+    # clock() is the time in milliseconds, which differs between runs
+    string(REGEX REPLACE "[0-9][0-9][0-9][0-9][0-9][0-9][0-9][0-9][0-9][0-9][0-9][0-9][0-9]" "<clock>" run_out "${run_out}")
+    string(REGEX REPLACE "[0-9][0-9][0-9][0-9][0-9][0-9][0-9][0-9][0-9][0-9][0-9][0-9][0-9]" "<clock>" run_err "${run_err}")
+    set(${out} "${run_out}" PARENT_SCOPE)
+    set(${err} "${run_err}" PARENT_SCOPE)
+endfunction()
+
+function(check_run description)
+    run_interpreter(actual_out actual_err --cache-dir=${cache_dir})
+
+    if(NOT actual_out STREQUAL expected_out)
+        message(FATAL_ERROR "stdout differs ${description}\n--- without image\n${expected_out}\n--- ${description}\n${actual_out}")
+    endif()
+
+    if(NOT actual_err STREQUAL expected_err)
+        message(FATAL_ERROR "stderr differs ${description}\n--- without image\n${expected_err}\n--- ${description}\n${actual_err}")
+    endif()
+endfunction()
+
+run_interpreter(expected_out expected_err --no-cache)
+
+check_run("writing the image")
+
+# Programs the front end rejects have no image
+file(GLOB image ${cache_dir}/*.loxc)
+if(NOT image)
+    return()
+endif()
+
+file(SHA256 ${image} image_hash)
+check_run("from the image")
+
+file(APPEND ${image} "trailing garbage")
+check_run("from an image with trailing garbage")
+
+file(WRITE ${image} "LOXC not an image")
+check_run("from a corrupt image")
+
+file(SHA256 ${image} rewritten_hash)
+if(NOT rewritten_hash STREQUAL image_hash)
+    message(FATAL_ERROR "The corrupt image was not replaced by the program's image")
+endif()
@@ -2,6 +2,8 @@
 #include "typedefs.h"
 #include "lexer_test_cases.h"
 #include "lexer.h"
+#include "char_scan.h"
+#include <string>
 
 NAMESPACE_BEGIN(cpplox)
 
@@ -300,6 +302,17 @@ TEST_CASE("Lexer correctly identifies all reserved keywords", "[lexer]") {
     }
 }
 
+TEST_CASE("Lexer only recognizes keywords on an exact match", "[lexer]") {
+    for (const char* input : { "classy", "fo", "nulls", "thistle", "iff", "Var", "debugger", "_if", "continues", "staticx" }) {
+        DYNAMIC_SECTION("Input: " << input) {
+            lexer l(input);
+            const std::vector<token>& tokens = l.get_tokens();
+            REQUIRE(tokens.size() == 3);
+            REQUIRE(tokens.at(1).type == token_type::identifier_);
+        }
+    }
+}
+
 TEST_CASE("Lexer correctly get_tokenss various inputs", "[lexer]") {
     for (const auto& test : lexer_test_cases) {
         DYNAMIC_SECTION("Input: " << test.input) {
@@ -318,4 +331,42 @@ TEST_CASE("Lexer correctly get_tokenss various inputs", "[lexer]") {
     }
 }
 
+TEST_CASE("Vectorized scanning agrees with the scalar loops", "[lexer]") {
+    // Runs of every length around the block sizes, starting at every alignment
+    const std::string runs[] = { " \t\r\n", "abcXYZ_09", "0123456789", "not a quote or newline" };
+
+    for (const std::string& run : runs) {
+        for (std::size_t offset = 0; offset < 4; ++offset) {
+            for (std::size_t length = 0; length < 80; ++length) {
+                std::string input(offset, '#');
+                for (std::size_t i = 0; i < length; ++i)
+                    input += run[i % run.size()];
+                input += "\"\n* ";
+
+                const char* first = input.data() + offset;
+                const char* last = input.data() + input.size();
+
+                INFO("run: " << run << ", offset: " << offset << ", length: " << length);
+                REQUIRE(skip_whitespace(first, last) == scalar_skip_whitespace(first, last));
+                REQUIRE(skip_identifier(first, last) == scalar_skip_identifier(first, last));
+                REQUIRE(skip_digits(first, last) == scalar_skip_digits(first, last));
+                REQUIRE(find_char(first, last, '"') == scalar_find_char(first, last, '"'));
+                REQUIRE(find_either(first, last, '*', '\n') == scalar_find_either(first, last, '*', '\n'));
+            }
+        }
+    }
+}
+
+TEST_CASE("Lexer keeps line and column across long runs", "[lexer]") {
+    std::string input = "var a;" + std::string(40, ' ') + "\n\n/* one\ntwo */ \"x\ny\" // comment\n" + std::string(37, '\t') + "b";
+    lexer l(input);
+    const std::vector<token>& tokens = l.get_tokens();
+
+    REQUIRE(tokens.size() == 7);
+    REQUIRE(tokens.at(4).type == token_type::string_);
+    REQUIRE(tokens.at(4).position() == coord{ 4, 8 });
+    REQUIRE(tokens.at(5).lexeme() == "b");
+    REQUIRE(tokens.at(5).position() == coord{ 6, 38 });
+}
+
 NAMESPACE_END
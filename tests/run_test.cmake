@@ -0,0 +1,60 @@
+# Runs SOURCE with the interpreter and checks its stdout, stderr and exit status against the files in
+# EXPECTED_DIR named after it: <name>.stdout, <name>.stderr and <name>.status, where a missing file
+# stands for no output and an exit status of 0, and <name>.mask, see below.  With CHECK_STDERR=OFF only stdout and the status are
+# checked, for modes that print more than the program does.
+#
+# Usage: cmake -DINTERPRETER=<cpp-lox> [-DARGS=<arg;...>] -DSOURCE=<file> -DEXPECTED_DIR=<dir> -DWORK_DIR=<dir>
+#              [-DCHECK_STDERR=OFF] -P run_test.cmake
+
+get_filename_component(name ${SOURCE} NAME_WE)
+file(MAKE_DIRECTORY ${WORK_DIR})
+
+if(NOT DEFINED CHECK_STDERR)
+    set(CHECK_STDERR ON)
+endif()
+
+set(input ${WORK_DIR}/${name}.input)
+file(WRITE ${input} "test input\n")
+
+# Program images go to the work directory rather than the user's cache
+set(ENV{CPPLOX_CACHE_DIR} ${WORK_DIR}/cache)
+
+execute_process(
+    COMMAND ${INTERPRETER} ${ARGS} ${SOURCE}
+    INPUT_FILE ${input}
+    OUTPUT_VARIABLE actual_out
+    ERROR_VARIABLE actual_err
+    RESULT_VARIABLE actual_status
+)
+
+foreach(stream stdout stderr status)
+    set(expected_${stream} "")
+    if(EXISTS ${EXPECTED_DIR}/${name}.${stream})
+        file(READ ${EXPECTED_DIR}/${name}.${stream} expected_${stream})
+    endif()
+endforeach()
+
+string(STRIP "${expected_status}" expected_status)
+if(expected_status STREQUAL "")
+    set(expected_status 0)
+endif()
+
+# Output that differs between runs, such as what clock() returned, is matched by the regex in
+# <name>.mask and replaced by <masked> before comparing
+if(EXISTS ${EXPECTED_DIR}/${name}.mask)
+    file(STRINGS ${EXPECTED_DIR}/${name}.mask mask LIMIT_COUNT 1)
+    string(REGEX REPLACE "${mask}" "<masked>" actual_out "${actual_out}")
+    string(REGEX REPLACE "${mask}" "<masked>" actual_err "${actual_err}")
+endif()
+
+if(NOT actual_out STREQUAL expected_stdout)
+    message(FATAL_ERROR "stdout differs\n--- expected\n${expected_stdout}\n--- actual\n${actual_out}")
+endif()
+
+if(CHECK_STDERR AND NOT actual_err STREQUAL expected_stderr)
+    message(FATAL_ERROR "stderr differs\n--- expected\n${expected_stderr}\n--- actual\n${actual_err}")
+endif()
+
+if(NOT actual_status STREQUAL expected_status)
+    message(FATAL_ERROR "Exit status ${actual_status}, expected ${expected_status}\n--- stderr\n${actual_err}")
+endif()